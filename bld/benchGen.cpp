@@ -0,0 +1,182 @@
+#include "../src/globalDefs.h"
+#include "../src/constantDefs.h"
+
+// generates large, deterministic ANI programs that stress the front end (lexer, parser, semmer)
+// usage: benchGen outputDirectory scale
+
+// fixed-seed linear congruential generator, so that every run produces the same programs
+unsigned long benchSeed = 1;
+unsigned int benchRand(unsigned int n) {
+	benchSeed = benchSeed * 1103515245 + 12345;
+	return (unsigned int)((benchSeed / 65536) % 32768) % n;
+}
+
+// prints n tabs of indentation
+void indent(FILE *out, unsigned int n) {
+	for (unsigned int i=0; i < n; i++) {
+		fprintf(out, "\t");
+	}
+}
+
+// prints a random arithmetic expression over the int variables v0 ... v(numVars-1)
+void printExp(FILE *out, unsigned int numVars, unsigned int numOps) {
+	static const char *ops[] = { "+", "-", "*", "/", "%" };
+	fprintf(out, "v%u", benchRand(numVars));
+	for (unsigned int i=0; i < numOps; i++) {
+		fprintf(out, " %s ", ops[benchRand(5)]);
+		if (benchRand(2)) {
+			fprintf(out, "v%u", benchRand(numVars));
+		} else {
+			fprintf(out, "%u", 1 + benchRand(100));
+		}
+	}
+}
+
+// prints the int variable declarations that the other sections refer to
+void printVars(FILE *out, unsigned int numVars) {
+	for (unsigned int i=0; i < numVars; i++) {
+		fprintf(out, "v%u = [int](%u);\n", i, benchRand(1000));
+	}
+}
+
+// many declarations of every standard type, plus objects and the imports of their members
+void genDecls(FILE *out, unsigned int scale) {
+	unsigned int numVars = 200 * scale;
+	fprintf(out, "// declarations\n@std;\n");
+	printVars(out, numVars);
+	for (unsigned int i=0; i < numVars; i++) {
+		fprintf(out, "f%u = [float](%u.%u);\n", i, benchRand(1000), benchRand(1000));
+		fprintf(out, "b%u = [bool](%s);\n", i, benchRand(2) ? "true" : "false");
+		fprintf(out, "c%u = [char]('%c');\n", i, 'a' + benchRand(26));
+		fprintf(out, "l%u = [int\\](v%u);\n", i, benchRand(numVars));
+	}
+	unsigned int numObjs = 50 * scale;
+	for (unsigned int i=0; i < numObjs; i++) {
+		fprintf(out, "obj%u = []{\n\t=;\n\tmem%u = %u;\n};\n", i, i, benchRand(1000));
+	}
+	for (unsigned int i=0; i < numObjs; i++) {
+		fprintf(out, "{\n\t@obj%u.mem%u;\n\tx = [int](mem%u);\n};\n", i, i, i);
+	}
+}
+
+// long chains of operators and filters feeding a single sink
+void genPipes(FILE *out, unsigned int scale) {
+	unsigned int numVars = 50;
+	fprintf(out, "// pipe chains\n@std;\n");
+	printVars(out, numVars);
+	for (unsigned int i=0; i < 100 * scale; i++) {
+		printExp(out, numVars, 20 + benchRand(40));
+		fprintf(out, " ->std.out;\n");
+		fprintf(out, "\\v%u", benchRand(numVars));
+		unsigned int filters = 1 + benchRand(8);
+		for (unsigned int j=0; j < filters; j++) {
+			fprintf(out, " [int x --> int] {x + %u -->}", j);
+		}
+		fprintf(out, " ->std.out;\n");
+	}
+}
+
+// deeply nested blocks and parenthesized expressions
+void genNesting(FILE *out, unsigned int scale) {
+	unsigned int numVars = 10;
+	unsigned int depth = 64;
+	fprintf(out, "// nesting\n@std;\n");
+	printVars(out, numVars);
+	for (unsigned int i=0; i < 20 * scale; i++) {
+		for (unsigned int j=0; j < depth; j++) {
+			indent(out, j);
+			fprintf(out, "{\n");
+		}
+		indent(out, depth);
+		for (unsigned int j=0; j < depth; j++) {
+			fprintf(out, "(");
+		}
+		fprintf(out, "v%u", benchRand(numVars));
+		for (unsigned int j=0; j < depth; j++) {
+			fprintf(out, " + %u)", benchRand(10));
+		}
+		fprintf(out, " ->std.out;\n");
+		for (unsigned int j=depth; j > 0; j--) {
+			indent(out, j-1);
+			fprintf(out, "};\n");
+		}
+	}
+}
+
+// big one- and two-dimensional initializer lists
+void genInitializers(FILE *out, unsigned int scale) {
+	fprintf(out, "// initializers\n@std;\n");
+	for (unsigned int i=0; i < 20 * scale; i++) {
+		fprintf(out, "p%u = [int]{", i);
+		for (unsigned int j=0; j < 500; j++) {
+			fprintf(out, "%s%u", (j > 0) ? "," : "", benchRand(100000));
+		}
+		fprintf(out, "};\n");
+		fprintf(out, "q%u = [float]{\n", i);
+		for (unsigned int j=0; j < 50; j++) {
+			fprintf(out, "\t{");
+			for (unsigned int k=0; k < 10; k++) {
+				fprintf(out, "%s%u.%u", (k > 0) ? "," : "", benchRand(1000), benchRand(1000));
+			}
+			fprintf(out, "}%s\n", (j < 49) ? "," : "");
+		}
+		fprintf(out, "};\n");
+	}
+}
+
+// long string literals and long line and block comments
+void genLiterals(FILE *out, unsigned int scale) {
+	static const char *words[] = { "alpha", "beta", "gamma", "delta", "stream", "filter", "latch", "pool" };
+	fprintf(out, "// literals and comments\n@std;\n");
+	for (unsigned int i=0; i < 100 * scale; i++) {
+		fprintf(out, "//");
+		for (unsigned int j=0; j < 40; j++) {
+			fprintf(out, " %s", words[benchRand(8)]);
+		}
+		fprintf(out, "\n/*\n");
+		for (unsigned int j=0; j < 10; j++) {
+			fprintf(out, " *");
+			for (unsigned int k=0; k < 12; k++) {
+				fprintf(out, " %s", words[benchRand(8)]);
+			}
+			fprintf(out, "\n");
+		}
+		fprintf(out, " */\n");
+		fprintf(out, "s%u = [string](\"", i);
+		for (unsigned int j=0; j < 200; j++) {
+			fprintf(out, "%s%s", words[benchRand(8)], benchRand(10) ? " " : "\\t");
+		}
+		fprintf(out, "\");\n");
+		fprintf(out, "s%u + \"%u\" ->std.out;\n", i, i);
+	}
+}
+
+typedef void (*BenchGenerator)(FILE *out, unsigned int scale);
+
+int main(int argc, char **argv) {
+	if (argc != 3) {
+		printf("benchmark generator: expects 2 arguments\n");
+		return 1;
+	}
+	string outDir(argv[1]);
+	int scale = atoi(argv[2]);
+	if (scale < 1) {
+		printf("benchmark generator: scale must be at least 1\n");
+		return 1;
+	}
+
+	const char *names[] = { "decls", "pipes", "nesting", "initializers", "literals" };
+	BenchGenerator generators[] = { genDecls, genPipes, genNesting, genInitializers, genLiterals };
+	for (unsigned int i=0; i < sizeof(names)/sizeof(names[0]); i++) {
+		string fileName = outDir + "/" + names[i] + ".ani";
+		FILE *out = fopen(fileName.c_str(), "w");
+		if (out == NULL) { // if file open failed, return an error
+			printf("benchmark generator: cannot open '%s'\n", fileName.c_str());
+			return 1;
+		}
+		benchSeed = i + 1; // every program gets its own fixed stream of random numbers
+		generators[i](out, (unsigned int)scale);
+		fclose(out);
+	}
+	return 0;
+}
@@ -0,0 +1,45 @@
+#!/bin/sh
+
+### Notice check script
+
+# every line of a test file of the form
+#	// expect -p LEVELS: NOTICE
+# means that compiling the file on its own at each of the (space-separated) optimization LEVELS must print the verbose NOTICE
+
+target=$1
+shift
+expectations=./var/noticeExpectations.txt
+output=./var/noticeOutput.txt
+mkdir -p var
+failed=0
+
+echo
+echo ...Checking test case notices...
+echo --------------------------------
+for file in "$@"
+do
+	sed -n 's|^// expect -p \([0-9 ]*\): \(.*\)$|\1:\2|p' "$file" > $expectations
+	while IFS=: read levels notice
+	do
+		for level in $levels
+		do
+			./$target -v -p $level "$file" > $output 2>&1
+			if ! grep -qxF "$target: $notice." $output
+			then
+				echo "$file: at -p $level, expected notice: $notice"
+				grep -F "$target: $(echo "$notice" | cut -d' ' -f1) " $output | sed 's/^/	got: /'
+				failed=1
+			fi
+		done
+	done < $expectations
+done
+rm -f $expectations $output
+if test $failed -eq 0
+then
+	echo --------------------------------
+	echo Test case notices passed.
+else
+	echo --------------------------------
+	echo Failed test case notices!
+fi
+exit $failed
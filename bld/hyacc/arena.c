@@ -0,0 +1,126 @@
+/*
+   This file is part of Hyacc, a LR(0)/LALR(1)/LR(1) parser generator.
+   Copyright (C) 2007 Xin Chen. chenx@hawaii.edu
+
+   Hyacc is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   Hyacc is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with Hyacc; if not, write to the Free Software Foundation, Inc.,
+   51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/*
+ * arena.c
+ *
+ * Region allocator for the small nodes of the parsing machine:
+ * SymbolNode, Context, Configuration, State and the lane tracing
+ * lists. These are created by the hundred thousand and freed
+ * piecemeal or never, so calling malloc() for each one costs much
+ * more than the nodes themselves.
+ *
+ * Nodes are carved out of ARENA_BLOCK_SIZE blocks, which live for
+ * the whole run of hyacc, like most of the nodes. A freed node goes
+ * to a free list of its size class, and is used again by the next
+ * node of that size.
+ *
+ * With -j the closure is computed on several threads, so the
+ * current block and the free lists are per thread. A node may be
+ * freed on another thread than it was allocated on, it then simply
+ * joins the free list of that thread.
+ *
+ * Use the macros HYY_POOL_NEW and HYY_POOL_FREE in y.h.
+ */
+
+#include "y.h"
+
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+#define ARENA_ALIGN 8 /* also the size class granularity. */
+#define POOL_MAX_SIZE 256 /* larger objects are not pooled. */
+#define POOL_CLASS_COUNT (POOL_MAX_SIZE / ARENA_ALIGN)
+
+#if USE_THREADS
+#define ARENA_THREAD_LOCAL __thread
+#else
+#define ARENA_THREAD_LOCAL
+#endif
+
+
+typedef struct PoolNode {
+  struct PoolNode * next;
+} PoolNode;
+
+
+static ARENA_THREAD_LOCAL char * arena_next = NULL; /* in current block */
+static ARENA_THREAD_LOCAL size_t arena_left = 0;
+static ARENA_THREAD_LOCAL PoolNode * pool_free_list[POOL_CLASS_COUNT];
+
+
+/*
+ * Get size bytes from the current block of this thread.
+ * Memory is never given back, size must be <= POOL_MAX_SIZE.
+ */
+static void * arena_alloc(size_t size) {
+  void * p;
+
+  if (size > arena_left) {
+    HYY_NEW(arena_next, char, ARENA_BLOCK_SIZE);
+    arena_left = ARENA_BLOCK_SIZE;
+  }
+
+  p = arena_next;
+  arena_next += size;
+  arena_left -= size;
+  return p;
+}
+
+
+void * pool_alloc(size_t size) {
+  int c;
+  PoolNode * n;
+
+  if (size > POOL_MAX_SIZE) {
+    void * p;
+    HYY_NEW(p, char, size);
+    return p;
+  }
+
+  size = (size + ARENA_ALIGN - 1) & ~((size_t) ARENA_ALIGN - 1);
+  c = size / ARENA_ALIGN - 1;
+
+  if ((n = pool_free_list[c]) != NULL) {
+    pool_free_list[c] = n->next;
+    return n;
+  }
+  return arena_alloc(size);
+}
+
+
+/*
+ * size must be the size that p was allocated with.
+ */
+void pool_free(void * p, size_t size) {
+  int c;
+  PoolNode * n;
+
+  if (p == NULL) return;
+  if (size > POOL_MAX_SIZE) {
+    free(p);
+    return;
+  }
+
+  size = (size + ARENA_ALIGN - 1) & ~((size_t) ARENA_ALIGN - 1);
+  c = size / ARENA_ALIGN - 1;
+
+  n = (PoolNode *) p;
+  n->next = pool_free_list[c];
+  pool_free_list[c] = n;
+}
@@ -0,0 +1,136 @@
+/*
+   This file is part of Hyacc, a LR(0)/LALR(1)/LR(1) parser generator.
+   Copyright (C) 2007 Xin Chen. chenx@hawaii.edu
+
+   Hyacc is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   Hyacc is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with Hyacc; if not, write to the Free Software Foundation, Inc.,
+   51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/*
+ * gen_tables.c
+ *
+ * Write the final parsing table and the rule metadata to y.tables
+ * (switch -T), for programs that build their own parser from the
+ * table and would otherwise have to parse y.output.
+ *
+ * All numbers are 32-bit unsigned, little endian. A name is its
+ * length followed by its characters, without the terminating '\0'.
+ *
+ *   "HYTB"              magic
+ *   version             TABLES_VERSION
+ *   column count        then for each column:
+ *     type              0 - terminal, 1 - nonterminal
+ *     name
+ *   rule count          then for each rule, by rule number:
+ *     LHS name          "$accept" for rule 0
+ *     RHS length
+ *   state count         then for each state, for each column:
+ *     action            one byte: 0, 's', 'r', 'a' or 'g'
+ *     value             target state or rule number, 0 otherwise
+ *
+ * The columns are those of y.output: the goal symbol is left out,
+ * and so are the parent symbols when unit productions are removed.
+ * The states are those of the final parsing table: with -O2 and
+ * -O3 only the reachable states, renumbered as in
+ * printCondensedFinalParsingTable().
+ */
+
+#include "y.h"
+
+#define TABLES_MAGIC "HYTB"
+#define TABLES_VERSION 1
+
+
+static void writeTablesInt(FILE * fp, unsigned int x) {
+  fputc(x & 0xff, fp);
+  fputc((x >> 8) & 0xff, fp);
+  fputc((x >> 16) & 0xff, fp);
+  fputc((x >> 24) & 0xff, fp);
+}
+
+
+static void writeTablesName(FILE * fp, char * name) {
+  int len = strlen(name);
+  writeTablesInt(fp, len);
+  fwrite(name, sizeof(char), len, fp);
+}
+
+
+static BOOL isTablesColumn(SymbolTblNode * n) {
+  if (isGoalSymbol(n) == TRUE) return FALSE;
+  if (USE_REMOVE_UNIT_PRODUCTION == TRUE &&
+      isParentSymbol(n) == TRUE) return FALSE;
+  return TRUE;
+}
+
+
+static BOOL isTablesState(int row) {
+  if (USE_REMOVE_UNIT_PRODUCTION == FALSE) return TRUE;
+  return isReachableState(row);
+}
+
+
+void gen_tables() {
+  SymbolTblNode * n;
+  char action;
+  int row, col, i, state;
+  int col_count = 0, row_count = 0;
+  FILE * fp_tables;
+
+  if ((fp_tables = fopen(y_tables, "wb")) == NULL) {
+    printf("cannot open file %s\n", y_tables);
+    return;
+  }
+
+  fwrite(TABLES_MAGIC, sizeof(char), 4, fp_tables);
+  writeTablesInt(fp_tables, TABLES_VERSION);
+
+  for (col = 0; col < ParsingTblCols; col ++) {
+    if (isTablesColumn(ParsingTblColHdr[col]) == TRUE) col_count ++;
+  }
+  writeTablesInt(fp_tables, col_count);
+  for (col = 0; col < ParsingTblCols; col ++) {
+    n = ParsingTblColHdr[col];
+    if (isTablesColumn(n) == TRUE) {
+      writeTablesInt(fp_tables, (n->type == _NONTERMINAL) ? 1 : 0);
+      writeTablesName(fp_tables, n->symbol);
+    }
+  }
+
+  writeTablesInt(fp_tables, grammar.rule_count);
+  for (i = 0; i < grammar.rule_count; i ++) {
+    writeTablesName(fp_tables, grammar.rules[i]->nLHS->snode->symbol);
+    writeTablesInt(fp_tables, grammar.rules[i]->RHS_count);
+  }
+
+  for (row = 0; row < ParsingTblRows; row ++) {
+    if (isTablesState(row) == TRUE) row_count ++;
+  }
+  writeTablesInt(fp_tables, row_count);
+  for (row = 0; row < ParsingTblRows; row ++) {
+    if (isTablesState(row) == FALSE) continue;
+    for (col = 0; col < ParsingTblCols; col ++) {
+      n = ParsingTblColHdr[col];
+      if (isTablesColumn(n) == FALSE) continue;
+      getAction(n->type, col, row, & action, & state);
+      if (USE_REMOVE_UNIT_PRODUCTION == TRUE &&
+          (action == 's' || action == 'g'))
+        state = getActualState(state);
+      fputc(action, fp_tables);
+      writeTablesInt(fp_tables, state);
+    }
+  }
+
+  fclose(fp_tables);
+}
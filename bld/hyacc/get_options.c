@@ -37,6 +37,7 @@ static BOOL ERR_NO_INPUT_FILE = FALSE;
 static BOOL ERR_UNKNOWN_SWITCH_O = FALSE;
 static BOOL ERR_UNKNOWN_SWITCH_O_USE_LR0 = FALSE;
 static BOOL ERR_UNKNOWN_SWITCH_D = FALSE;
+static BOOL ERR_UNKNOWN_SWITCH_J = FALSE;
 static BOOL ERR_NO_OUTFILE_NAME = FALSE;
 static BOOL ERR_NO_FILENAME_PREFIX = FALSE;
 
@@ -59,7 +60,12 @@ void show_helpmsg_exit() {
 
   if (ERR_UNKNOWN_SWITCH_D) {
     printf("unknown parameter to switch -D. %s",
-           "choices are -Di (i = 0 ~ 14).\n");
+           "choices are -Di (i = 0 ~ 16).\n");
+  }
+
+  if (ERR_UNKNOWN_SWITCH_J) {
+    printf("unknown parameter to switch -j. %s",
+           "use -jn, where n >= 1 is the number of threads.\n");
   }
 
   if (ERR_NO_OUTFILE_NAME) {
@@ -70,7 +76,7 @@ void show_helpmsg_exit() {
     printf("file name prefix is not specified by -b or --file-prefix==\n");
   }
 
-  printf("Usage: hyacc [-bcCdDghlmnOPQRStvV] inputfile\n");
+  printf("Usage: hyacc [-bcCdDghjlmnOPQRStTvV] inputfile\n");
   printf("Man page: hyacc -m\n");
   exit(0);
 }
@@ -94,6 +100,8 @@ void get_outfile_name(int len, char * name) {
   sprintf(y_output, "%s.output", name);
   y_gviz = (char *) malloc(sizeof(char) * (len + 6));
   sprintf(y_gviz, "%s.gviz", name);
+  y_tables = (char *) malloc(sizeof(char) * (len + 8));
+  sprintf(y_tables, "%s.tables", name);
 }
 
 
@@ -115,6 +123,8 @@ void get_filename_prefix(int len, char * name) {
   sprintf(y_output, "%s.output", name);
   y_gviz = (char *) malloc(sizeof(char) * (len + 6));
   sprintf(y_gviz, "%s.gviz", name);
+  y_tables = (char *) malloc(sizeof(char) * (len + 8));
+  sprintf(y_tables, "%s.tables", name);
 }
 
 
@@ -131,6 +141,8 @@ void init_options() {
   USE_REMOVE_UNIT_PRODUCTION = FALSE;
   USE_REMOVE_REPEATED_STATES = FALSE;
 
+  THREAD_COUNT = 1;
+
   SHOW_GRAMMAR = FALSE;
   SHOW_PARSING_TBL = FALSE;
   DEBUG_GEN_PARSING_MACHINE = FALSE;
@@ -155,16 +167,19 @@ void init_options() {
   y_tab_h = "y.tab.h";
   y_output = "y.output";
   y_gviz = "y.gviz";
+  y_tables = "y.tables";
   USE_OUTPUT_FILENAME = FALSE;
   USE_FILENAME_PREFIX = FALSE;
   USE_HEADER_FILE = FALSE;
   USE_GRAPHVIZ = FALSE;
+  USE_TABLES = FALSE;
 
   USE_LR0 = FALSE;
   USE_LALR = FALSE;
   USE_LANE_TRACING = FALSE;
 
   SHOW_ORIGINATORS = FALSE;
+  SHOW_UPE_REPORT = FALSE;
 }
 
 
@@ -229,6 +244,18 @@ void get_single_letter_option(char * s, unsigned int pos) {
     case 'h':
               show_helpmsg_exit();
               break;
+    case 'j':        /* threads for parsing machine expansion. */
+              if (strlen(s) <= pos + 1) {
+                ERR_UNKNOWN_SWITCH_J = TRUE;
+                show_helpmsg_exit();
+              }
+              sscanf(s+pos+1, "%d", & switch_param);
+              if (switch_param < 1) {
+                ERR_UNKNOWN_SWITCH_J = TRUE;
+                show_helpmsg_exit();
+              }
+              THREAD_COUNT = switch_param;
+              break;
     case '?':
               show_helpmsg_exit();
               break;
@@ -300,6 +327,9 @@ void get_single_letter_option(char * s, unsigned int pos) {
     case 't':        /* debug: output y.parse */
               USE_YYDEBUG = TRUE;
               break;
+    case 'T':        /* create y.tables */
+              USE_TABLES = TRUE;
+              break;
     case 'v':        /* verbose */
               USE_VERBOSE = TRUE;
               break; 
@@ -328,6 +358,7 @@ void get_single_letter_option(char * s, unsigned int pos) {
                          SHOW_STATE_TRANSITION_LIST = TRUE;
                          SHOW_STATE_CONFIG_COUNT = TRUE;
                          SHOW_ACTUAL_STATE_ARRAY = TRUE;
+                         SHOW_UPE_REPORT = TRUE;
                          break;
                 case 1:  SHOW_GRAMMAR = TRUE; 
                          break;
@@ -359,6 +390,8 @@ void get_single_letter_option(char * s, unsigned int pos) {
                          break;
                 case 15: SHOW_ORIGINATORS = TRUE;
                          break;
+                case 16: SHOW_UPE_REPORT = TRUE;
+                         break;
                 default:
                          ERR_UNKNOWN_SWITCH_D = TRUE;
                          show_helpmsg_exit();
@@ -411,6 +444,8 @@ void get_mnemonic_long_option(char * s) {
   } else if (strncmp(s, "--output-file==", 15) == 0) { // -o
     // 15 for strlen("--output-file=="). 
     get_outfile_name(strlen(s) - 15, s + 15);
+  } else if (strcmp(s, "--tables") == 0) { // -T
+    USE_TABLES = TRUE;
   } else if (strcmp(s, "--verbose") == 0) { // -v
     USE_VERBOSE = TRUE;
   } else if (strcmp(s, "--version") == 0) { // -V
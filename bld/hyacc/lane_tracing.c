@@ -118,6 +118,59 @@ void dump_llist_context_set(llist_context_set * contxt_set) {
 }
 
 
+/*
+ * Context sets are also kept as dense bitsets, so that the
+ * membership and disjointness tests done over and over during
+ * regeneration are word-wide operations instead of list walks.
+ *
+ * A context only contains terminals, $end and the empty string.
+ * Bit 0 is $end, bits 1..terminal_count are the terminals in
+ * parsing table column order (snode->seq), and the bit after
+ * those is the empty string.
+ */
+#define CTXT_WORD_BITS (8 * sizeof(unsigned long))
+
+static int ctxt_words = 0; // words per bitset, set on first use.
+
+static int ctxt_bitset_words() {
+  if (ctxt_words == 0) {
+    ctxt_words = (grammar.terminal_count + 2 + CTXT_WORD_BITS - 1)
+                 / CTXT_WORD_BITS;
+  }
+  return ctxt_words;
+}
+
+static int ctxt_bit(SymbolTblNode * snode) {
+  if (snode->seq < 0 || snode->seq > grammar.terminal_count) {
+    return grammar.terminal_count + 1; // empty string.
+  }
+  return snode->seq;
+}
+
+#define ctxt_bit_test(bits, i) \
+  (((bits)[(i) / CTXT_WORD_BITS] >> ((i) % CTXT_WORD_BITS)) & 1UL)
+#define ctxt_bit_set(bits, i) \
+  ((bits)[(i) / CTXT_WORD_BITS] |= 1UL << ((i) % CTXT_WORD_BITS))
+
+static unsigned long * ctxt_bitset_create() {
+  unsigned long * bits;
+  HYY_NEW(bits, unsigned long, ctxt_bitset_words());
+  memset(bits, 0, sizeof(unsigned long) * ctxt_bitset_words());
+  return bits;
+}
+
+/*
+ * Return TRUE if bitsets a and b have no bit in common.
+ */
+static BOOL ctxt_bitset_disjoint(unsigned long * a, unsigned long * b) {
+  int i;
+  for (i = 0; i < ctxt_words; i ++) {
+    if ((a[i] & b[i]) != 0) return FALSE;
+  }
+  return TRUE;
+}
+
+
 /*
  * Assumption: contxt_set is in INC order.
  */
@@ -128,6 +181,7 @@ llist_context_set * llist_context_set_create(
 
   s->config = config;
   s->ctxt = NULL; //cloneSymbolList(contxt_set);
+  s->ctxt_bits = ctxt_bitset_create();
   s->next = NULL;
   return s;
 }
@@ -135,22 +189,28 @@ llist_context_set * llist_context_set_create(
 
 llist_context_set_destroy(llist_context_set * s) {
   freeSymbolNodeList(s->ctxt);
+  free(s->ctxt_bits);
   free(s);
 }
 
 
 /*
  * Add (merge) contxt_set to c->ctxt.
+ * Symbols already in c are found in the bitset and skipped,
+ * only new symbols are inserted into the ordered list.
  */
 void llist_context_set_addContext(
     llist_context_set * c, SymbolList contxt_set) {
   SymbolNode * n;
-  int exist;
+  int exist, bit;
 
   if (NULL == c) return;
 
   for (n = contxt_set; n != NULL; n = n->next) {
     //if (strlen(n->snode->symbol) == 0) continue; // ignore empty string.
+    bit = ctxt_bit(n->snode);
+    if (ctxt_bit_test(c->ctxt_bits, bit)) continue;
+    ctxt_bit_set(c->ctxt_bits, bit);
     c->ctxt = insertSymbolList_unique_inc(c->ctxt, n->snode, & exist);
   }
 }
@@ -166,10 +226,14 @@ llist_context_set * llist_context_set_clone(llist_context_set * c) {
 
   d_next = d = llist_context_set_create(c->config);
   d->ctxt = cloneSymbolList(c->ctxt);
+  memcpy(d->ctxt_bits, c->ctxt_bits, 
+         sizeof(unsigned long) * ctxt_bitset_words());
 
   for (c_next = c->next; c_next != NULL; c_next = c_next->next) {
     d_next->next = llist_context_set_create(c_next->config);
     d_next->next->ctxt = cloneSymbolList(c_next->ctxt);
+    memcpy(d_next->next->ctxt_bits, c_next->ctxt_bits,
+           sizeof(unsigned long) * ctxt_bitset_words());
     d_next = d_next->next;
   }
 
@@ -183,7 +247,7 @@ llist_context_set * llist_context_set_clone(llist_context_set * c) {
 
 llist_int * llist_int_create(int n) {
   llist_int * item;
-  HYY_NEW(item, llist_int, 1);
+  HYY_POOL_NEW(item, llist_int);
   item->n = n;
   item->next = NULL;
   return item;
@@ -195,7 +259,7 @@ void llist_int_destroy(llist_int * list) {
   while (list != NULL) {
     tmp = list;
     list = list->next;
-    free(tmp);
+    HYY_POOL_FREE(tmp, llist_int);
   }
 }
 
@@ -260,7 +324,7 @@ void llist_int_dump(llist_int * list) {
 
 llist_int2 * llist_int2_create(int n1, int n2) {
   llist_int2 * item;
-  HYY_NEW(item, llist_int2, 1);
+  HYY_POOL_NEW(item, llist_int2);
   item->n1 = n1;
   item->n2 = n2;
   item->next = NULL;
@@ -273,7 +337,7 @@ void llist_int2_destroy(llist_int2 * list) {
   while (list != NULL) {
     tmp = list;
     list = list->next;
-    free(tmp);
+    HYY_POOL_FREE(tmp, llist_int2);
   }
 }
 
@@ -590,25 +654,9 @@ void dump_LT_tbl() {
  */
 
 
-/*
- * Return TRUE if a and b are disjoint, FALSE otherwise.
- * Similar to the function hasEmptyIntersection() in y.c.
- * This can be put into symbol_table.c.
- */
-static BOOL symbolList_disjoint(SymbolList a, SymbolList b) {
-  while (a != NULL && b != NULL) {
-    if (a->snode == b->snode) return FALSE;
-    if (strcmp(a->snode->symbol, b->snode->symbol) < 0) {
-      a = a->next;
-    } else {
-      b = b->next;
-    }
-  }
-  return TRUE;
-}
-
 /*
  * Check the given context sets are pair_wise disjoint.
+ * Each pair is compared on the ctxt_bits bitsets.
  */
 static BOOL pairwise_disjoint(llist_context_set * ctxt_set) {
   llist_context_set * a, * b;
@@ -618,7 +666,7 @@ static BOOL pairwise_disjoint(llist_context_set * ctxt_set) {
 
   for (a = ctxt_set; a->next != NULL; a = a->next) {
     for (b = a->next; b != NULL; b = b->next) {
-      if (symbolList_disjoint(a->ctxt, b->ctxt) == FALSE) {
+      if (ctxt_bitset_disjoint(a->ctxt_bits, b->ctxt_bits) == FALSE) {
         return FALSE;
       }
     }
@@ -842,7 +890,7 @@ State * cloneState(State * s) {
   int i, ct;
   State * t; // clone
 
-  HYY_NEW(t, State, 1);
+  HYY_POOL_NEW(t, State);
   
   t->next = s->next;
   t->config_max_count = s->config_max_count;
@@ -1338,9 +1386,7 @@ static laneHead * createLaneHead(State * s, SymbolTblNode * n) {
   laneHead * h;
   HYY_NEW(h, laneHead, 1);
   h->s = s;
-  HYY_NEW(h->contexts, SymbolNode, 1);
-  h->contexts->snode = n;
-  h->contexts->next = NULL;
+  h->contexts = createSymbolNode(n);
   h->next = NULL;
   return h;
 }
@@ -1370,8 +1416,7 @@ static void addContextToLaneHead(laneHead * h, SymbolTblNode * n) {
     }
   }
 
-  HYY_NEW(tmp, SymbolNode, 1);
-  tmp->snode = n;
+  tmp = createSymbolNode(n);
   tmp->next = sn;
   if (sn_prev == NULL) { // add as the first node.
     h->contexts = tmp;
@@ -1910,52 +1955,6 @@ static void writeStateNoArray(StateNoArray * a, char * name) {
 }
 
 
-/*
- * Adapted from transition() in y.c.
- */
-static State_collection * getStateSuccessors(State * s) {
-  int i;
-  Configuration * c, * new_config;
-  SymbolTblNode * scanned_symbol = NULL;
-  State_collection * coll = createStateCollection();
-  State * new_state = NULL;
-
-  for (i = 0; i < s->config_count; i ++) {
-    c = s->config[i];
-    if (isFinalConfiguration(c)) {
-      // do nothing.
-    } else { // do transit operation.
-      scanned_symbol = getScannedSymbol(c);
-      if (strlen(scanned_symbol->symbol) == 0) { // empty reduction. 
-        continue;
-      }
-      new_state =
-        findStateForScannedSymbol(coll, scanned_symbol);
-      if (new_state == NULL) {
-        new_state = createState();
-        // record which symbol this state is a successor by.
-        new_state->trans_symbol =
-          createSymbolNode(scanned_symbol);
-        addState2Collection(coll, new_state);
-      }
-      // create a new core config for new_state.
-      new_config = createConfig(-1, 0, 1);
-
-      new_config->owner = new_state;
-      copyConfig(new_config, c);
-      new_config->isCoreConfig = 1;
-      new_config->marker ++;
-      if (new_config->nMarker != NULL)
-        new_config->nMarker = new_config->nMarker->next;
-
-      addCoreConfig2State(new_state, new_config);
-    }
-  } // end for
-
-  return coll;
-}
-
-
 /*
  * Given the trans_symbol, find the index of the 
  * successor of s that has this trans_symbol.
@@ -2448,13 +2447,34 @@ static SymbolNode * insertSymbolList_unique(
 
 /*
  * Assumption: list != NULL, c != NULL.
+ * Membership of list is marked in a bitset first, so symbols
+ * of new_list already in list cost no list walk.
+ * The bitset is a scratch one shared by all calls of the run,
+ * created on first use and cleared on entry.
  */
+static unsigned long * combine_bits = NULL;
+
 SymbolNode * combineContextList(
                     SymbolList list, SymbolList new_list) {
-  int exist;
+  int exist, bit;
+  SymbolNode * n;
+  unsigned long * bits;
 
   if (new_list == NULL) return list;
+
+  if (combine_bits == NULL) {
+    combine_bits = ctxt_bitset_create();
+  } else {
+    memset(combine_bits, 0, sizeof(unsigned long) * ctxt_words);
+  }
+  bits = combine_bits;
+  for (n = list; n != NULL; n = n->next) {
+    ctxt_bit_set(bits, ctxt_bit(n->snode));
+  }
   for (; new_list != NULL; new_list = new_list->next) {
+    bit = ctxt_bit(new_list->snode);
+    if (ctxt_bit_test(bits, bit)) continue;
+    ctxt_bit_set(bits, bit);
     list = insertSymbolList_unique(list, new_list->snode, & exist);
   }
   return list;
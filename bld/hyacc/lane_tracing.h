@@ -67,6 +67,7 @@ typedef struct _llist_context_set llist_context_set;
 struct _llist_context_set {
   Configuration * config; // in INC order of config->ruleID.
   SymbolList ctxt; // in INC order of symbol.
+  unsigned long * ctxt_bits; // same set as ctxt, indexed by ctxt_bit().
   llist_context_set * next;
 };
 
@@ -50,17 +50,16 @@ void addSuccessorConfigToState_LR0(State * s, int ruleID) {
 
 
 /*
- * Assumption: public variable config_queue contains 
- * the configurations to be processed.
+ * Assumption: queue q contains the configurations to be processed.
  */
-void getConfigSuccessors_LR0(State * s) {
+void getConfigSuccessors_LR0_do(State * s, Queue * q) {
   RuleIDNode * r;
   SymbolTblNode * scanned_symbol = NULL;
   Configuration * config;
   int index;
 
-  while (queue_count(config_queue) > 0) {
-    config = s->config[queue_pop(config_queue)];
+  while (queue_count(q) > 0) {
+    config = s->config[queue_pop(q)];
 
     if (config->marker >= 0 &&
         config->marker < grammar.rules[config->ruleID]->RHS_count) {
@@ -76,7 +75,7 @@ void getConfigSuccessors_LR0(State * s) {
 
           if (index == -1) { // new config.
             addSuccessorConfigToState_LR0(s, r->ruleID);
-            queue_push(config_queue, s->config_count - 1);
+            queue_push(q, s->config_count - 1);
             index = s->config_count - 1;
           } // else is an existing old config, do nothing.
 
@@ -87,13 +86,27 @@ void getConfigSuccessors_LR0(State * s) {
 }
 
 
-void getClosure_LR0(State * s) {
+/*
+ * Assumption: public variable config_queue contains 
+ * the configurations to be processed.
+ */
+void getConfigSuccessors_LR0(State * s) {
+  getConfigSuccessors_LR0_do(s, config_queue);
+}
+
+
+void getClosure_LR0_do(State * s, Queue * q) {
   int i;
-  //queue_clear(config_queue);
   for (i = 0; i < s->config_count; i ++) {
-    queue_push(config_queue, i);
+    queue_push(q, i);
   }
-  getConfigSuccessors_LR0(s);
+  getConfigSuccessors_LR0_do(s, q);
+}
+
+
+void getClosure_LR0(State * s) {
+  //queue_clear(config_queue);
+  getClosure_LR0_do(s, config_queue);
 }
 
 
@@ -189,54 +202,20 @@ void addTransitionStates2New_LR0(
 /*
  * Perform transition opertaion on a state to get successors.
  *
- * For each config c in the state s,
- *   If c is a final config, stop
- *   Else, get the scanned symbol x, 
- *     If a new temp state for x does not exist yet, create it.
- *     add x to the temp state.
- * (Now get several new temp states)
+ * (Get several new temp states with getStateSuccessors())
  * Add these new temp states to states_new if not existed,
  * and add transition to parsing table as well.
  */
 void transition_LR0(State * s) {
-  int i;
-  Configuration * c, * new_config;
-  SymbolTblNode * scanned_symbol = NULL;
-  State_collection * coll = createStateCollection();
-  State * new_state = NULL;
+  addStateTransitions_LR0(s, getStateSuccessors(s));
+}
 
-  for (i = 0; i < s->config_count; i ++) {
-    c = s->config[i];
-    if (isFinalConfiguration(c)) {
-      // do nothing.
-    } else { // do transit operation.
-      scanned_symbol = getScannedSymbol(c);
-      if (strlen(scanned_symbol->symbol) == 0) { // empty reduction. 
-        continue;
-      }
-      new_state = 
-        findStateForScannedSymbol(coll, scanned_symbol);
-      if (new_state == NULL) {
-        new_state = createState();
-        // record which symbol this state is a successor by.
-        new_state->trans_symbol = 
-          createSymbolNode(scanned_symbol);
-        addState2Collection(coll, new_state);
-      }
-      // create a new core config for new_state.
-      new_config = createConfig(-1, 0, 1);
-      
-      new_config->owner = new_state;
-      copyConfig(new_config, c); 
-      new_config->isCoreConfig = 1;
-      new_config->marker ++; 
-      if (new_config->nMarker != NULL)
-        new_config->nMarker = new_config->nMarker->next;
-
-      addCoreConfig2State(new_state, new_config);
-    }
-  } // end for
 
+/*
+ * Add the successor states coll of state s (from
+ * getStateSuccessors) to states_new if not existed.
+ */
+void addStateTransitions_LR0(State * s, State_collection * coll) {
   if (coll->state_count > 0) {
     addTransitionStates2New_LR0(coll, s);
   }
@@ -368,6 +347,13 @@ void generate_LR0_parsing_machine() {
   }
 
   while (new_state != NULL) {
+    // LR(0) states are never combined, so the frontier
+    // can always be expanded in parallel.
+    if (useParallelExpansion() == TRUE) {
+      new_state = expandStates_parallel(new_state, TRUE);
+      continue;
+    }
+
     if (DEBUG_GEN_PARSING_MACHINE == TRUE) {
       yyprintf3("%d states, current state is %d\n", 
                states_new->state_count, new_state->state_no);
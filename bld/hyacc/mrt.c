@@ -101,7 +101,7 @@ void checkArraySize_MRParents(MRParents * p) {
 void destroyMRParents(MRParents * p) {
   int i;
   if (p == NULL) return;
-  for (i = 0; i < p->count; i++) free(p->parents[i]);
+  for (i = 0; i < p->count; i++) freeSymbolNode(p->parents[i]);
   free(p->parents);
   free(p);
 }
@@ -221,7 +221,7 @@ MRTreeNode * createMRTreeNode(SymbolTblNode * symbol) {
 
 void destroyMRTreeNode(MRTreeNode * node) {
   if (node == NULL) return;
-  free(node->symbol);
+  freeSymbolNode(node->symbol);
   free(node->parent);
   free(node);
 }
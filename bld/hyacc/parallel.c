@@ -0,0 +1,180 @@
+/*
+   This file is part of Hyacc, a LR(0)/LALR(1)/LR(1) parser generator.
+   Copyright (C) 2007 Xin Chen. chenx@hawaii.edu
+
+   Hyacc is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 2 of the License, or
+   (at your option) any later version.
+
+   Hyacc is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with Hyacc; if not, write to the Free Software Foundation, Inc.,
+   51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+/*
+ * parallel.c
+ *
+ * Parallel expansion of the parsing machine (switch -j).
+ *
+ * The serial loop takes one state at a time from states_new:
+ * closure, successor states, then merge of the successors into
+ * states_new through the state hash table.
+ *
+ * Here the frontier, i.e. all the unexpanded states at the tail
+ * of states_new, is taken as a batch. The closure and successor
+ * states of each batch state are computed on THREAD_COUNT threads,
+ * each with its own config queue. The merges are then done on the
+ * main thread in state order, exactly as in the serial loop, so
+ * state numbers and the parsing table are identical to a serial
+ * run.
+ *
+ * This is only valid when expanding a state never changes another
+ * state, i.e. when compatible states are not combined: always for
+ * LR(0), and for LR(1) with -O0. Debug output of the closure
+ * (-D0 and the like) also forces the serial loop.
+ */
+
+#include "y.h"
+
+#if USE_THREADS
+#include <pthread.h>
+#endif
+
+
+/* frontiers smaller than this are expanded serially. */
+#define PARALLEL_MIN_BATCH 16
+
+
+typedef struct {
+  State ** batch;
+  State_collection ** successors; /* output, one per batch state. */
+  int count;
+  int first; /* expands batch[first], batch[first + step], ... */
+  int step;
+  BOOL is_LR0;
+} ExpandTask;
+
+
+static void expandTask(ExpandTask * t) {
+  Queue * q = queue_create();
+  int i;
+
+  for (i = t->first; i < t->count; i += t->step) {
+    if (t->is_LR0) {
+      getClosure_LR0_do(t->batch[i], q);
+    } else {
+      getClosure_do(t->batch[i], q);
+    }
+    t->successors[i] = getStateSuccessors(t->batch[i]);
+  }
+
+  queue_destroy(q);
+}
+
+
+#if USE_THREADS
+static void * expandTask_thread(void * t) {
+  expandTask((ExpandTask *) t);
+  return NULL;
+}
+#endif
+
+
+/*
+ * Run the tasks, task 0 on the calling thread.
+ */
+static void runExpandTasks(ExpandTask * tasks, int task_count) {
+  int i;
+#if USE_THREADS
+  pthread_t * threads;
+  BOOL * started;
+
+  HYY_NEW(threads, pthread_t, task_count);
+  HYY_NEW(started, BOOL, task_count);
+  for (i = 1; i < task_count; i ++) {
+    started[i] = (pthread_create(& threads[i], NULL,
+                    expandTask_thread, & tasks[i]) == 0);
+    if (! started[i]) expandTask(& tasks[i]);
+  }
+  expandTask(& tasks[0]);
+  for (i = 1; i < task_count; i ++) {
+    if (started[i]) pthread_join(threads[i], NULL);
+  }
+  free(threads);
+  free(started);
+#else
+  for (i = 0; i < task_count; i ++) expandTask(& tasks[i]);
+#endif
+}
+
+
+BOOL useParallelExpansion() {
+  if (THREAD_COUNT <= 1) return FALSE;
+  if (DEBUG_GEN_PARSING_MACHINE == TRUE) return FALSE;
+  if (SHOW_THEADS == TRUE) return FALSE;
+  return TRUE;
+}
+
+
+/*
+ * Expand the states from first to the end of states_new.
+ * Returns the next unexpanded state.
+ */
+State * expandStates_parallel(State * first, BOOL is_LR0) {
+  State ** batch;
+  State_collection ** successors;
+  ExpandTask * tasks;
+  State * s;
+  int i, count, task_count;
+
+  for (count = 0, s = first; s != NULL; s = s->next) count ++;
+
+  if (count < PARALLEL_MIN_BATCH) {
+    if (is_LR0) {
+      getClosure_LR0(first);
+      transition_LR0(first);
+    } else {
+      getClosure(first);
+      transition(first);
+    }
+    return first->next;
+  }
+
+  HYY_NEW(batch, State *, count);
+  HYY_NEW(successors, State_collection *, count);
+  for (i = 0, s = first; s != NULL; s = s->next) batch[i ++] = s;
+
+  task_count = (THREAD_COUNT < count) ? THREAD_COUNT : count;
+  HYY_NEW(tasks, ExpandTask, task_count);
+  for (i = 0; i < task_count; i ++) {
+    tasks[i].batch = batch;
+    tasks[i].successors = successors;
+    tasks[i].count = count;
+    tasks[i].first = i;
+    tasks[i].step = task_count;
+    tasks[i].is_LR0 = is_LR0;
+  }
+
+  runExpandTasks(tasks, task_count);
+
+  // merge in state order, as the serial loop does.
+  for (i = 0; i < count; i ++) {
+    if (is_LR0) {
+      addStateTransitions_LR0(batch[i], successors[i]);
+    } else {
+      addStateTransitions(batch[i], successors[i]);
+    }
+  }
+
+  s = batch[count - 1]->next;
+  free(tasks);
+  free(successors);
+  free(batch);
+  return s;
+}
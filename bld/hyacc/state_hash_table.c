@@ -37,12 +37,18 @@
  * sum_{k=1_to_n}(k/2) = n(n+1)/4 searches,  where  n = 1605.
  * This is 644,407.
  *
- * But using this state hash table, in average there are 5.02
- * states per list (from StateHashTbl_dump() output),  so the 
- * cost is (1 + 5.02) * 1605 = 9,662, where 1 is the  cost of
- * getting the hash value for a state.
+ * The hash value is a 64-bit mix of the (ruleID, marker) pairs
+ * of the core configurations, in the order isSameState() compa-
+ * res them. Two states can only be same or compatible if these
+ * pairs are equal, so they always have the same hash value.
  *
- * This is 644,407/9,662 = 67 times faster.
+ * The table uses open addressing with linear probing, and is
+ * doubled whenever it becomes half full. The hash value of each
+ * inserted state is cached in State.hash_val, so a probe only
+ * compares configurations when the full 64-bit values match,
+ * and resizing does not rehash any configuration. States with
+ * equal hash values are probed in insertion order, the same
+ * order in which the old collision chains were searched.
  *
  * @Author: Xin Chen
  * @Created on: 3/3/2006
@@ -53,53 +59,103 @@
 #include "y.h"
 
 
-struct StateTableNode {
-  State * state;
-  struct StateTableNode * next;
-};
-typedef struct StateTableNode StateNode;
+#define SHT_INIT_SIZE 1024 /* initial size, should be a power of 2. */
 
+static State ** StateHashTbl = NULL; /* slots, NULL when empty. */
+static int StateHashTbl_size = 0; /* number of slots. */
+static int StateHashTbl_count = 0; /* number of states stored. */
 
-typedef struct {
-  int count;
-  StateNode * next;
-} StateHashTblNode;
+/* stored states in insertion order, used when resizing. */
+static State ** StateHashTbl_states = NULL;
+static int StateHashTbl_states_max = 0;
 
 
-#define SHT_SIZE 997 /* State hash table size */
-StateHashTblNode StateHashTbl[SHT_SIZE];
+void initStateHashTbl() {
+  free(StateHashTbl);
+  free(StateHashTbl_states);
 
+  StateHashTbl_size = SHT_INIT_SIZE;
+  HYY_NEW(StateHashTbl, State *, StateHashTbl_size);
+  memset(StateHashTbl, 0, sizeof(State *) * StateHashTbl_size);
+  StateHashTbl_count = 0;
 
-StateNode * createStateNode(State * s) {
-  StateNode * n;
-  HYY_NEW(n, StateNode, 1);
-  n->state = s;
-  n->next = NULL;
-  return n;
+  StateHashTbl_states_max = SHT_INIT_SIZE / 2;
+  HYY_NEW(StateHashTbl_states, State *, StateHashTbl_states_max);
 }
 
 
-void destroyStateNode(StateNode * n) {
-  free(n);
+/*
+ * Finalizer of splitmix64, spreads every input bit
+ * over the whole 64-bit value.
+ */
+static unsigned long long mixHashVal(unsigned long long h) {
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
 }
 
 
-void initStateHashTbl() {
+static unsigned long long getStateHashVal(State * s) {
   int i;
-  for (i = 0; i < SHT_SIZE; i ++) {
-    StateHashTbl[i].count = 0;
-    StateHashTbl[i].next = NULL;
+  unsigned long long h = s->core_config_count;
+  for (i = 0; i < s->core_config_count; i ++) {
+    h = mixHashVal(h ^ (((unsigned long long) s->config[i]->ruleID << 32)
+                        | (unsigned int) s->config[i]->marker));
   }
+  return h;
 }
 
 
-static int getStateHashVal(State * s) {
-  int i, sum = 0;
-  for (i = 0; i < s->core_config_count; i ++) {
-    sum = (sum + s->config[i]->ruleID * 97 + 
-                 s->config[i]->marker * 7 + i) % SHT_SIZE;
+/*
+ * Put s into the first empty slot of its probe sequence.
+ * s->hash_val must already be set.
+ */
+static void placeState(State * s) {
+  int mask = StateHashTbl_size - 1;
+  int i = (int) (s->hash_val & mask);
+  while (StateHashTbl[i] != NULL) { i = (i + 1) & mask; }
+  StateHashTbl[i] = s;
+}
+
+
+/*
+ * Double the table, re-placing states in insertion order so
+ * that equal hash values stay in insertion order.
+ */
+static void expandStateHashTbl() {
+  int i;
+
+  free(StateHashTbl);
+  StateHashTbl_size *= 2;
+  HYY_NEW(StateHashTbl, State *, StateHashTbl_size);
+  memset(StateHashTbl, 0, sizeof(State *) * StateHashTbl_size);
+
+  for (i = 0; i < StateHashTbl_count; i ++) {
+    placeState(StateHashTbl_states[i]);
+  }
+}
+
+
+/*
+ * Store s in the table. h is the hash value of s.
+ */
+static void insertStateHashTbl(State * s, unsigned long long h) {
+  s->hash_val = h;
+
+  if (StateHashTbl_count == StateHashTbl_states_max) {
+    StateHashTbl_states_max *= 2;
+    HYY_EXPAND(StateHashTbl_states, State *, StateHashTbl_states_max);
+  }
+  StateHashTbl_states[StateHashTbl_count ++] = s;
+
+  if (StateHashTbl_count * 2 > StateHashTbl_size) {
+    expandStateHashTbl();
+  } else {
+    placeState(s);
   }
-  return sum;
 }
 
 
@@ -111,35 +167,28 @@ extern BOOL in_lanetracing;
  * else, return the found state.
  */
 State * searchStateHashTbl(State * s, int * is_compatible) {
-  int v = getStateHashVal(s);
-  StateNode * n = StateHashTbl[v].next;
-  StateNode * n_prev;
+  unsigned long long h = getStateHashVal(s);
+  int mask = StateHashTbl_size - 1;
+  int i = (int) (h & mask);
+  State * t;
 
   (* is_compatible) = 0; // default to 0 - false.
 
-  if (n == NULL) {
-    StateHashTbl[v].next = createStateNode(s);
-    StateHashTbl[v].count = 1;
-    return NULL;
-  } 
-
-  while (n != NULL) {
-    n_prev = n;
-    if (isSameState(n->state, s) == TRUE) {
-      return n->state;
+  for (; (t = StateHashTbl[i]) != NULL; i = (i + 1) & mask) {
+    if (t->hash_val != h) continue;
+    if (isSameState(t, s) == TRUE) {
+      return t;
     }
     if (USE_COMBINE_COMPATIBLE_STATES) {
-      if (isCompatibleStates(n->state, s) == TRUE) {
-        combineCompatibleStates(n->state, s);
+      if (isCompatibleStates(t, s) == TRUE) {
+        combineCompatibleStates(t, s);
         (* is_compatible) = 1;
-        return n->state;
+        return t;
       }
     }
-    n = n->next;
   }
-  // n == NULL, s does not exist. insert at end.
-  n_prev->next = createStateNode(s);
-  StateHashTbl[v].count ++;
+  // s does not exist. insert it.
+  insertStateHashTbl(s, h);
 
   return NULL;
 }
@@ -154,26 +203,18 @@ State * searchStateHashTbl(State * s, int * is_compatible) {
  * weak compatibility.
  */
 State * searchSameStateHashTbl(State * s) {
-  int v = getStateHashVal(s);
-  StateNode * n = StateHashTbl[v].next;
-  StateNode * n_prev;
-
-  if (n == NULL) {
-    StateHashTbl[v].next = createStateNode(s);
-    StateHashTbl[v].count = 1;
-    return NULL;
-  }
-
-  while (n != NULL) {
-    n_prev = n;
-    if (isSameState(n->state, s) == TRUE) {
-      return n->state;
+  unsigned long long h = getStateHashVal(s);
+  int mask = StateHashTbl_size - 1;
+  int i = (int) (h & mask);
+  State * t;
+
+  for (; (t = StateHashTbl[i]) != NULL; i = (i + 1) & mask) {
+    if (t->hash_val == h && isSameState(t, s) == TRUE) {
+      return t;
     }
-    n = n->next;
   }
-  // n == NULL, s does not exist. insert at end.
-  n_prev->next = createStateNode(s);
-  StateHashTbl[v].count ++;
+  // s does not exist. insert it.
+  insertStateHashTbl(s, h);
 
   return NULL;
 }
@@ -181,44 +222,34 @@ State * searchSameStateHashTbl(State * s) {
 
 /*
  * load factor: number of entry / hash table size.
- * hash table cell usage: 
- *   number of used hash table cells / hash table size.
+ * probe length: number of slots visited to find a state,
+ *   including its own slot.
  */
 void StateHashTbl_dump() {
-  int i, states_count = 0, list_count = 0;
-  StateNode * n;
+  int i, probes, mask = StateHashTbl_size - 1;
+  int total_probes = 0, max_probes = 0;
+  State * s;
 
   yyprintf("\n--state hash table--\n");
-  yyprintf("-----------------------\n");
-  yyprintf("cell |   count  | state\n");
-  yyprintf("-----------------------\n");
-  for (i = 0; i < SHT_SIZE; i ++) {
-    if (StateHashTbl[i].count == 0) continue;
-
-    list_count ++;
-    states_count += StateHashTbl[i].count;
-
-    yyprintf3("[%3d] (count=%d) : ", i, StateHashTbl[i].count);
-    if ((n = StateHashTbl[i].next) != NULL) {
-      yyprintf2("%d", n->state->state_no);
-
-      n = n->next;
-      while (n != NULL) {
-        yyprintf2(", %d", n->state->state_no);
-        n = n->next;
-      }
-    }
-    yyprintf("\n");
-  }
+  yyprintf("---------------------------\n");
+  yyprintf("slot  | state | probe length\n");
+  yyprintf("---------------------------\n");
+  for (i = 0; i < StateHashTbl_size; i ++) {
+    if ((s = StateHashTbl[i]) == NULL) continue;
 
-  yyprintf4("%d states, %d lists, in average %.2f states/list.\n",
-            states_count, list_count, 
-            ((double) states_count)/list_count);
-  yyprintf3("load factor: %.2f, hash table cell usage: %.2f\n", 
-            ((double) states_count)/SHT_SIZE, 
-            ((double) list_count)/SHT_SIZE);
-
-}
+    probes = ((i - (int) (s->hash_val & mask)) & mask) + 1;
+    total_probes += probes;
+    if (max_probes < probes) max_probes = probes;
 
+    yyprintf4("[%4d] %d : %d\n", i, s->state_no, probes);
+  }
 
+  yyprintf4("%d states, %d slots, in average %.2f probes/state",
+            StateHashTbl_count, StateHashTbl_size, 
+            (StateHashTbl_count == 0) ? 0.0 :
+            ((double) total_probes)/StateHashTbl_count);
+  yyprintf2(" (max: %d).\n", max_probes);
+  yyprintf2("load factor: %.2f\n", 
+            ((double) StateHashTbl_count)/StateHashTbl_size);
 
+}
@@ -104,9 +104,7 @@ SymbolNode * createSymbolNode(SymbolTblNode * sn) {
   if (sn == NULL) 
     YYERR_EXIT("createSymbolNode error: snode is NULL\n");
 
-  n = (SymbolNode *) malloc(sizeof(SymbolNode));
-  if (n == NULL) 
-    YYERR_EXIT("createSymbolNode error: out of memory\n");
+  HYY_POOL_NEW(n, SymbolNode);
   n->snode = sn;
   n->next = NULL;
   return n;
@@ -115,7 +113,7 @@ SymbolNode * createSymbolNode(SymbolTblNode * sn) {
 
 void freeSymbolNode(SymbolNode * n) {
   if (n == NULL) return;
-  free(n);
+  HYY_POOL_FREE(n, SymbolNode);
 }
 
 
@@ -125,7 +123,7 @@ void freeSymbolNodeList(SymbolNode * a) {
 
   while (a != NULL) {
     b = a->next;
-    free(a);
+    HYY_POOL_FREE(a, SymbolNode);
     a = b;
   }
 }
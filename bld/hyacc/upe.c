@@ -51,6 +51,24 @@ static int UPS_SIZE = 64;
 #define UPS_MAX_SIZE 65536   /* 2^16 */
 static UnitProdState * ups;
 static int ups_count = 0;
+/* state_no of ups[0]; ups[i].state_no is ups_first_state + i. */
+static int ups_first_state = 0;
+
+
+/*
+ * For the report of -D16: size of the parsing table and conflict
+ * counts after each step of unit production elimination.
+ */
+typedef struct {
+  char * step;
+  int states;
+  int entries; /* non-error entries */
+  int rs, rr, ss; /* conflicts so far */
+} UPEReportStep;
+
+#define UPE_REPORT_MAX_STEPS 8
+static UPEReportStep upe_report[UPE_REPORT_MAX_STEPS];
+static int upe_report_count = 0;
 
 
 /*
@@ -80,6 +98,40 @@ void print_int_array(int a[], int count) {
 }
 
 
+/*
+ * Add the states of a target state to a combination.
+ * If the target is itself a new UPS state, i.e. the leaf
+ * transition of an already processed state, add the states it
+ * combines instead. This keeps every combination a set of
+ * original states. Otherwise processing a new state gives another
+ * new state which contains the previous one, without end.
+ */
+static void addUnitProdDestState(int state_dest,
+       int unitProdDestStates[], int * unitProdCount) {
+  int i, j, count;
+  int * states;
+
+  if (state_dest >= ups_first_state &&
+      state_dest < ups_first_state + ups_count) {
+    states = ups[state_dest - ups_first_state].combined_states;
+    count = ups[state_dest - ups_first_state].combined_states_count;
+  } else {
+    states = & state_dest;
+    count = 1;
+  }
+
+  for (i = 0; i < count; i ++) {
+    for (j = 0; j < * unitProdCount; j ++) {
+      if (unitProdDestStates[j] == states[i]) break;
+    }
+    if (j == * unitProdCount) {
+      unitProdDestStates[* unitProdCount] = states[i];
+      (* unitProdCount) ++;
+    }
+  }
+}
+
+
 /*
  * Called by function remove_unit_production_step1and2() only.
  * 
@@ -123,8 +175,7 @@ void getUnitProdShift(int state, SymbolTblNode * leaf,
     getAction(n->type, getCol(n), state, & action, & state_dest);
     //printf("%c, %d\n", action, state_dest);
     if (action == 'g') {
-      unitProdDestStates[* unitProdCount] = state_dest;
-      (* unitProdCount) ++;
+      addUnitProdDestState(state_dest, unitProdDestStates, unitProdCount);
     }
   }
 
@@ -133,8 +184,7 @@ void getUnitProdShift(int state, SymbolTblNode * leaf,
   if ((* unitProdCount) > 0) {
     getAction(leaf->type, getCol(leaf), state, & action, & state_dest);
     if (action == 's' || action == 'g') { 
-      unitProdDestStates[* unitProdCount] = state_dest;
-      (* unitProdCount) ++;
+      addUnitProdDestState(state_dest, unitProdDestStates, unitProdCount);
     }
   }
 
@@ -690,10 +740,13 @@ void remove_unit_production_step1and2() {
   int * unitProdDestStates;
 
   // as discussed in the function comments of getUnitProdShift(),
-  // unitProdDestStates array is bounded by number of non_terminals + 1.
-  HYY_NEW(unitProdDestStates, int, grammar.non_terminal_count + 1);
+  // unitProdDestStates array is bounded by number of non_terminals + 1,
+  // and as a set of original states, by the number of states.
+  HYY_NEW(unitProdDestStates, int,
+          grammar.non_terminal_count + 1 + ParsingTblRows);
   HYY_NEW(ups, UnitProdState, UPS_SIZE);
   ups_count = 0;
+  ups_first_state = ParsingTblRows;
   HYY_NEW(leaf_parents, MRParents *, MRLeaves_count);
 
   // pre-calculate all parents for each leaf.
@@ -762,15 +815,140 @@ void remove_unit_production_step1and2() {
 }
 
 
+/*
+ * Count the non-error entries of a parsing table row.
+ * The goal symbol has no column in the output, and after
+ * step 3 neither have the parent symbols.
+ */
+static int countRowEntries(int row) {
+  int col, count = 0;
+  SymbolTblNode * n;
+
+  for (col = 0; col < ParsingTblCols; col ++) {
+    n = ParsingTblColHdr[col];
+    if (isGoalSymbol(n) == FALSE &&
+        ParsingTable[row * ParsingTblCols + col] != 0) count ++;
+  }
+  return count;
+}
+
+
+/*
+ * Record the table size after a step for the -D16 report.
+ * Before step 4 all rows count, after it only reachable ones.
+ */
+static void recordUPEStep(char * step, BOOL reachable_only) {
+  UPEReportStep * r;
+  int row;
+
+  if (SHOW_UPE_REPORT == FALSE ||
+      upe_report_count == UPE_REPORT_MAX_STEPS) return;
+
+  r = & upe_report[upe_report_count ++];
+  r->step = step;
+  r->states = 0;
+  r->entries = 0;
+  for (row = 0; row < ParsingTblRows; row ++) {
+    if (reachable_only == FALSE || isReachableState(row) == TRUE) {
+      r->states ++;
+      r->entries += countRowEntries(row);
+    }
+  }
+  r->rs = rs_count;
+  r->rr = rr_count;
+  r->ss = ss_count;
+}
+
+
+/*
+ * Number of unit reductions from node up to its highest parent,
+ * i.e. the longest unit production chain above node.
+ */
+static int getUnitChainLength(MRTreeNode * node, int limit) {
+  int i, len, max = 0;
+
+  if (limit == 0) return 0; // a cycle of unit productions.
+  for (i = 0; i < node->parent_count; i ++) {
+    len = 1 + getUnitChainLength(node->parent[i], limit - 1);
+    if (len > max) max = len;
+  }
+  return max;
+}
+
+
+/*
+ * Report of -D16: size of the parsing table before and after each
+ * step, the conflicts they added, and an estimate of the unit
+ * reductions a parser saves per token.
+ *
+ * Each unit production chain above a terminal, e.g.
+ * Exp -> Term -> Primary -> ID, costs one reduction per link every
+ * time the terminal is reduced all the way up. The estimate is the
+ * longest chain above each terminal, so it is an upper bound.
+ */
+void writeUPEReport() {
+  UPEReportStep * r;
+  int i, len, max = 0, sum = 0, count = 0;
+  int unit_prod_count = 0;
+
+  if (USE_REMOVE_UNIT_PRODUCTION == FALSE) {
+    yyprintf("\n--Unit production elimination report--\n");
+    yyprintf("unit productions are removed only with -O2 or -O3\n");
+    return;
+  }
+
+  for (i = 1; i < grammar.rule_count; i ++) {
+    if (isUnitProduction(i) == TRUE) unit_prod_count ++;
+  }
+
+  yyprintf("\n--Unit production elimination report--\n");
+  yyprintf3("%d unit productions, %d parent symbols\n",
+            unit_prod_count, all_parents->count);
+  yyprintf("step\tstates\tentries\ts/r\tr/r\ts/s\n");
+  for (i = 0; i < upe_report_count; i ++) {
+    r = & upe_report[i];
+    yyprintf4("%s\t%d\t%d\t", r->step, r->states, r->entries);
+    yyprintf4("%d\t%d\t%d\n", r->rs, r->rr, r->ss);
+  }
+  if (upe_report_count > 1) {
+    r = & upe_report[upe_report_count - 1];
+    if (r->rs > upe_report[0].rs || r->rr > upe_report[0].rr ||
+        r->ss > upe_report[0].ss) {
+      yyprintf("warning: unit production elimination added conflicts, ");
+      yyprintf("its table does not parse like the original one\n");
+    }
+  }
+
+  yyprintf("\nunit reductions saved per terminal (longest chain):\n");
+  for (i = 0; i < MRLeaves_count; i ++) {
+    if (isTerminal(MRLeaves[i]->symbol->snode) == FALSE) continue;
+    len = getUnitChainLength(MRLeaves[i], grammar.non_terminal_count);
+    yyprintf3("  %s\t%d\n", MRLeaves[i]->symbol->snode->symbol, len);
+    sum += len;
+    count ++;
+    if (len > max) max = len;
+  }
+  if (count > 0) {
+    yyprintf4("%d terminals in unit chains, %.2f reductions saved on "
+              "average, %d at most\n", count, (double) sum / count, max);
+  }
+  yyprintf("\n");
+}
+
+
 ////////////////////////////////////////////////////////
 // Dr. Pager, Acta Informatica 9, 31-59 (1977), page 38.
 ////////////////////////////////////////////////////////
 void remove_unit_production() {
   buildMultirootedTree();
+  recordUPEStep("before", FALSE);
 
   remove_unit_production_step1and2();
+  recordUPEStep("step1,2", FALSE);
   remove_unit_production_step3();
+  recordUPEStep("step3", FALSE);
   remove_unit_production_step4();
+  recordUPEStep("step4", TRUE);
   remove_unit_production_step5();
 
   n_state_opt12 = states_reachable_count + 1;
@@ -906,6 +1084,7 @@ void furtherOptimization() {
   }
 
   n_state_opt123 = states_reachable_count + 1;
+  recordUPEStep("repeated", TRUE);
 
   if (SHOW_PARSING_TBL && (n_state_opt12 > n_state_opt123)) {
     yyprintf("After further optimization, ");
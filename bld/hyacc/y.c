@@ -764,11 +764,11 @@ void destroyState(State * s) {
   }
 
   free(s->config);
-  free(s->trans_symbol);
+  freeSymbolNode(s->trans_symbol);
   free(s->successor_list);
   StateList_destroy(s->parents_list);
 
-  free(s);
+  HYY_POOL_FREE(s, State);
 }
 
 
@@ -1099,7 +1099,7 @@ void clearContext(Context * c) {
 void freeContext(Context * c) {
   if (c == NULL) return;
   clearContext(c);
-  free(c);
+  HYY_POOL_FREE(c, Context);
 }
 
 
@@ -1107,7 +1107,7 @@ void clearProduction(Production * p) {
   SymbolNode * a, * b;
 
   if (p == NULL) return;
-  if (p->nLHS != NULL) free(p->nLHS);
+  if (p->nLHS != NULL) freeSymbolNode(p->nLHS);
   if (p->nRHS_head != NULL) {
     a = p->nRHS_head;
     p->nRHS_head = NULL;
@@ -1129,7 +1129,7 @@ void freeProduction(Production * p) {
 void freeConfig(Configuration * c) {
   if (c == NULL) return;
   clearContext(c->context);
-  free(c);
+  HYY_POOL_FREE(c, Configuration);
 }
 
 
@@ -1375,19 +1375,20 @@ int isCompatibleSuccessorConfig(State * s, int ruleID) {
 
 
 /*
- * Assumption: public variable config_queue contains
- * the configurations to be processed.
+ * Assumption: queue q contains the configurations to be processed.
+ * Uses no other shared state, so states can be closed on several
+ * threads at once, each with its own queue.
  */
-void getConfigSuccessors(State * s) {
+void getConfigSuccessors_do(State * s, Queue * q) {
   RuleIDNode * r;
   SymbolTblNode * scanned_symbol = NULL;
   Configuration * config;
   int index;
-  static Context tmp_context;
+  Context tmp_context;
   tmp_context.nContext = NULL;
 
-  while (queue_count(config_queue) > 0) {
-    config = s->config[queue_pop(config_queue)];
+  while (queue_count(q) > 0) {
+    config = s->config[queue_pop(q)];
 
     if (config->marker >= 0 &&
         config->marker < grammar.rules[config->ruleID]->RHS_count) {
@@ -1406,7 +1407,7 @@ void getConfigSuccessors(State * s) {
 
           if (index == -1) { // new config.
             addSuccessorConfigToState(s, r->ruleID, & tmp_context);
-            queue_push(config_queue, s->config_count - 1);
+            queue_push(q, s->config_count - 1);
 
           } else if (combineContext(s->config[index]->context,
                      & tmp_context) == TRUE) { // compatible config
@@ -1416,10 +1417,10 @@ void getConfigSuccessors(State * s) {
             if (isFinalConfiguration(s->config[index]) == TRUE) continue;
             if (isTerminal(getScannedSymbol(s->config[index]))
                            == TRUE) continue;
-            if (queue_exist(config_queue, index) == 1) continue;
+            if (queue_exist(q, index) == 1) continue;
 
-            // else, insert to config_queue.
-            queue_push(config_queue, index);
+            // else, insert to q.
+            queue_push(q, index);
 
           }
           //else { // same config, do nothing. }
@@ -1428,16 +1429,32 @@ void getConfigSuccessors(State * s) {
       } // else, is a terminal, stop.
     }  // end if config-marker >= 0 ...
   } // end of while
+
+  clearContext(& tmp_context);
 }
 
 
-void getClosure(State * s) {
+/*
+ * Assumption: public variable config_queue contains
+ * the configurations to be processed.
+ */
+void getConfigSuccessors(State * s) {
+  getConfigSuccessors_do(s, config_queue);
+}
+
+
+void getClosure_do(State * s, Queue * q) {
   int i;
-  //queue_clear(config_queue);
   for (i = 0; i < s->config_count; i ++) {
-    queue_push(config_queue, i);
+    queue_push(q, i);
   }
-  getConfigSuccessors(s);
+  getConfigSuccessors_do(s, q);
+}
+
+
+void getClosure(State * s) {
+  //queue_clear(config_queue);
+  getClosure_do(s, config_queue);
 }
 
 
@@ -1530,7 +1547,7 @@ State * findStateForScannedSymbol(
 
 Context * createContext() {
   Context * c;
-  HYY_NEW(c, Context, 1);
+  HYY_POOL_NEW(c, Context);
   c->nContext = NULL;
   c->context_count = 0;
   c->next = NULL; // used by LR(k) only.
@@ -1541,11 +1558,7 @@ Context * createContext() {
 Configuration * createConfig(
     int ruleID, int marker, int isCoreConfig) {
   Configuration * c;
-  c = (Configuration *) malloc(sizeof(Configuration));
-  if (c == NULL) {
-    printf("createConfig error: out of memory\n");
-    exit(0);
-  }
+  HYY_POOL_NEW(c, Configuration);
 
   c->context = createContext();
 
@@ -1935,11 +1948,8 @@ State * isExistingState(State_collection * sc, State * s,
 
 
 State * createState() {
-  State * s = (State *) malloc(sizeof(State));
-  if (s == NULL) {
-    printf("createState error: out of memeory\n");
-    exit(0);
-  }
+  State * s;
+  HYY_POOL_NEW(s, State);
   s->next = NULL;
   s->config_max_count = STATE_INIT_SIZE;
   HYY_NEW(s->config, Configuration *, s->config_max_count);
@@ -2101,18 +2111,17 @@ BOOL addTransitionStates2New(
 
 
 /*
- * Perform transition opertaion on a state to get successors.
+ * Get the successor states of a state.
  *
  * For each config c in the state s,
- *   If c is a final config, stop
+ *   If c is a final config, or the scanned symbol is empty, skip
  *   Else, get the scanned symbol x,
  *     If a new temp state for x does not exist yet, create it.
  *     add x to the temp state.
- * (Now get several new temp states)
- * Add these new temp states to states_new if not existed,
- * and add transition to parsing table as well.
+ * Returns the new temp states. Neither states_new nor the parsing
+ * table is touched, so this can run on several threads at once.
  */
-void transition(State * s) {
+State_collection * getStateSuccessors(State * s) {
   int i;
   Configuration * c, * new_config;
   SymbolTblNode * scanned_symbol = NULL;
@@ -2121,39 +2130,55 @@ void transition(State * s) {
 
   for (i = 0; i < s->config_count; i ++) {
     c = s->config[i];
-    if (isFinalConfiguration(c)) {
-      //yyprintf("a final config. so reduce.\n");
-      //writeConfiguration(c);
-      insertReductionToParsingTable(c, s->state_no);
-    } else { // do transit operation.
-      scanned_symbol = getScannedSymbol(c);
-      if (strlen(scanned_symbol->symbol) == 0) { // insert empty reduction.
-        insertReductionToParsingTable(c, s->state_no);
-        continue;
-      }
-      new_state =
-        findStateForScannedSymbol(coll, scanned_symbol);
-      if (new_state == NULL) {
-        new_state = createState();
-        // record which symbol this state is a successor by.
-        new_state->trans_symbol =
-          createSymbolNode(scanned_symbol);
-        addState2Collection(coll, new_state);
-      }
-      // create a new core config for new_state.
-      new_config = createConfig(-1, 0, 1);
+    if (isFinalConfiguration(c)) continue;
+
+    scanned_symbol = getScannedSymbol(c);
+    if (strlen(scanned_symbol->symbol) == 0) continue;
+
+    new_state =
+      findStateForScannedSymbol(coll, scanned_symbol);
+    if (new_state == NULL) {
+      new_state = createState();
+      // record which symbol this state is a successor by.
+      new_state->trans_symbol =
+        createSymbolNode(scanned_symbol);
+      addState2Collection(coll, new_state);
+    }
+    // create a new core config for new_state.
+    new_config = createConfig(-1, 0, 1);
 
-      new_config->owner = new_state;
-      copyConfig(new_config, c);
-      new_config->isCoreConfig = 1;
-      new_config->marker ++;
-      if (new_config->nMarker != NULL)
-        new_config->nMarker = new_config->nMarker->next;
+    new_config->owner = new_state;
+    copyConfig(new_config, c);
+    new_config->isCoreConfig = 1;
+    new_config->marker ++;
+    if (new_config->nMarker != NULL)
+      new_config->nMarker = new_config->nMarker->next;
 
-      addCoreConfig2State(new_state, new_config);
-    }
+    addCoreConfig2State(new_state, new_config);
   } // end for
 
+  return coll;
+}
+
+
+/*
+ * Insert the reductions of state s into the parsing table,
+ * and add its successor states coll (from getStateSuccessors)
+ * to states_new if not existed, with their transitions.
+ */
+void addStateTransitions(State * s, State_collection * coll) {
+  int i;
+  Configuration * c;
+
+  for (i = 0; i < s->config_count; i ++) {
+    c = s->config[i];
+    if (isFinalConfiguration(c) ||
+        strlen(getScannedSymbol(c)->symbol) == 0) {
+      // final config, or empty reduction.
+      insertReductionToParsingTable(c, s->state_no);
+    }
+  }
+
   if (coll->state_count > 0) {
    BOOL src_state_changed = addTransitionStates2New(coll, s);
    if (src_state_changed == TRUE) {
@@ -2163,6 +2188,18 @@ void transition(State * s) {
 }
 
 
+/*
+ * Perform transition opertaion on a state to get successors.
+ *
+ * (Get several new temp states with getStateSuccessors())
+ * Add these new temp states to states_new if not existed,
+ * and add transition to parsing table as well.
+ */
+void transition(State * s) {
+  addStateTransitions(s, getStateSuccessors(s));
+}
+
+
 BOOL isCompatibleConfig(Configuration * c1, Configuration * c2) {
   if (c1 == NULL || c2 == NULL) return FALSE;
   if (c1->marker != c2->marker) return FALSE;
@@ -2203,6 +2240,14 @@ void generate_parsing_machine() {
   }
 
   while (new_state != NULL) {
+    // Without combining compatible states, expanding a state never
+    // changes another, so the frontier can be expanded in parallel.
+    if (USE_COMBINE_COMPATIBLE_STATES == FALSE &&
+        useParallelExpansion() == TRUE) {
+      new_state = expandStates_parallel(new_state, FALSE);
+      continue;
+    }
+
     if (DEBUG_GEN_PARSING_MACHINE == TRUE) {
       yyprintf3("%d states, current state is %d\n",
                states_new->state_count, new_state->state_no);
@@ -2939,8 +2984,10 @@ int LR1(int argc, char ** argv) {
     }
     if (USE_GRAPHVIZ) { gen_graphviz_input2(); } /*O2,O3*/
   }
+  if (SHOW_UPE_REPORT) writeUPEReport();
   get_final_state_list();
 
+  if (USE_TABLES) gen_tables();
   if (USE_GENERATE_COMPILER) generate_compiler(hyacc_filename);
 
   show_stat();
@@ -3012,8 +3059,10 @@ int LR0(int argc, char ** argv) {
     }
     if (USE_GRAPHVIZ) { gen_graphviz_input2(); } /*O2,O3*/
   }
+  if (SHOW_UPE_REPORT) writeUPEReport();
   get_final_state_list();
 
+  if (USE_TABLES) gen_tables();
   if (USE_GENERATE_COMPILER) generate_compiler(hyacc_filename);
 
   show_stat();
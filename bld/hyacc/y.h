@@ -54,6 +54,13 @@
  * This should generally always be set to 1.
  */
 #define ADD_GOAL_RULE 1
+/*
+ * Whether the parsing machine can be expanded on several
+ * threads (switch -j). Needs pthreads, see parallel.c.
+ */
+#ifndef USE_THREADS
+#define USE_THREADS 1
+#endif
 
 typedef int BOOL;
 #define TRUE  1
@@ -88,6 +95,19 @@ FILE * fp_v;
 }
 
 
+/*
+ * Allocate/free a single small node from the pools in arena.c.
+ * A node from HYY_POOL_NEW must be freed by HYY_POOL_FREE with
+ * the same type, never by free().
+ */
+#define HYY_POOL_NEW(name, type) \
+{\
+  name = (type *) pool_alloc(sizeof(type)); \
+}
+
+#define HYY_POOL_FREE(name, type) pool_free((void *) (name), sizeof(type))
+
+
 #define HYY_EXPAND(name, type, size) \
 {\
   name = (type *) realloc((void *) name, sizeof(type) * (size)); \
@@ -145,11 +165,17 @@ char * y_output;
 /* used by gen_graphviz.c, value obtained in get_options.c */
 char * y_gviz;
 BOOL USE_GRAPHVIZ;
+/* used by gen_tables.c, value obtained in get_options.c */
+char * y_tables;
+BOOL USE_TABLES;
 /* lane-tracing algorithm */
 BOOL USE_LR0;
 BOOL USE_LALR;
+/* number of threads expanding the parsing machine, 1 is serial. */
+int THREAD_COUNT;
 BOOL USE_LANE_TRACING;
 BOOL SHOW_ORIGINATORS;
+BOOL SHOW_UPE_REPORT;
 
 ////////////////////////////////////////////
 // For symbol table
@@ -358,6 +384,9 @@ struct StateNode {
 
   struct StateNode * next;
 
+  /* core hash value, set when inserted into the state hash table. */
+  unsigned long long hash_val;
+
   /* for lane-tracing */
   unsigned int ON_LANE : 1; 
   unsigned int COMPLETE : 1; 
@@ -533,7 +562,10 @@ extern SymbolNode * insertSymbolList_unique_inc(
 extern void printParsingTable(); // for DEBUG use.
 
 extern void getClosure(State * s);
+extern void getClosure_do(State * s, Queue * q);
 extern void transition(State * s);
+extern State_collection * getStateSuccessors(State * s);
+extern void addStateTransitions(State * s, State_collection * coll);
 extern BOOL hasCommonCore(State * s1, State * s2);
 extern BOOL combineContext(Context * c_dest, Context * c_src);
 extern void clearContext(Context * c);
@@ -582,6 +614,7 @@ extern void printFinalParsingTable();
 extern void furtherOptimization();
 extern void get_actual_state_no();
 extern void printCondensedFinalParsingTable();
+extern void writeUPEReport();
 
 /* Defined in get_yacc_grammar.c */
 extern void getYaccGrammar(char * infile);
@@ -656,8 +689,23 @@ extern char * strError;
 extern void gen_graphviz_input();  /* For O0, O1 */
 extern void gen_graphviz_input2(); /* For O2, O3 */
 
+/* function in gen_tables.c */
+extern void gen_tables();
+
 /* functions in lr0.c */
 extern void generate_LR0_parsing_machine();
+extern void getClosure_LR0(State * s);
+extern void getClosure_LR0_do(State * s, Queue * q);
+extern void transition_LR0(State * s);
+extern void addStateTransitions_LR0(State * s, State_collection * coll);
+
+/* functions in arena.c */
+extern void * pool_alloc(size_t size);
+extern void pool_free(void * p, size_t size);
+
+/* functions in parallel.c */
+extern BOOL useParallelExpansion();
+extern State * expandStates_parallel(State * first, BOOL is_LR0);
 extern SymbolTblNode * getScannedSymbol(Configuration * c); // in y.c
 extern State_collection * createStateCollection();
 extern State * findStateForScannedSymbol(
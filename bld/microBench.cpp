@@ -0,0 +1,783 @@
+#include "../src/driver.h"
+
+#include "../src/globalDefs.h"
+#include "../src/constantDefs.h"
+
+#include "../src/lexer.h"
+#include "../src/parser.h"
+#include "../src/types.h"
+#include "../src/semmer.h"
+
+#include "../src/runtime.h"
+
+#include <sstream>
+#include <fcntl.h>
+
+// microbenchmarks for the hot paths of the front end and the runtime, run in isolation from the rest of the compiler
+// usage: microBench [-t minimumSeconds] [nameFilter]
+//
+// every benchmark is a function that does its setup, then times the body of a while (state.keepRunning()) loop;
+// the harness reruns it with more iterations until the timed loop runs for at least the minimum time,
+// and reports the time per iteration of that last run
+
+// defined in semmer.cpp
+void initSemmerGlobals();
+pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStatus &inStatus);
+
+// harness
+
+// the front end runs in silent mode, so report setup failures directly
+void microBenchFail(const char *s) {
+	fprintf(stderr, "microbenchmark: %s\n", s);
+	exit(1);
+}
+
+class BenchState {
+	public:
+		// data members
+		unsigned long iterations; // the number of iterations to run
+		unsigned long remaining; // the number of iterations left to run
+		unsigned long items; // the number of items (tokens, lookups, ...) processed per iteration, 0 if not meaningful
+		double startTime; // wall time at the first call to keepRunning()
+		double elapsed; // wall time of the timed loop
+		string note; // any further results to report, e.g. timer lateness
+		// allocators/deallocators
+		BenchState(unsigned long iterations) : iterations(iterations), remaining(iterations), items(0), startTime(0.0), elapsed(0.0) {}
+		// core methods
+		bool keepRunning() {
+			if (remaining == iterations) { // if this is the first call, the setup is done, so start the clock
+				startTime = getWallTime();
+			}
+			if (remaining == 0) { // if we're done, stop the clock
+				elapsed = getWallTime() - startTime;
+				return false;
+			}
+			remaining--;
+			return true;
+		}
+};
+
+typedef void (*MicroBenchFunc)(BenchState &state, unsigned int arg);
+
+class MicroBench {
+	public:
+		// data members
+		string name;
+		MicroBenchFunc func;
+		unsigned int arg;
+		// allocators/deallocators
+		MicroBench(const string &name, MicroBenchFunc func, unsigned int arg) : name(name), func(func), arg(arg) {}
+};
+
+#define MICRO_BENCH_MAX_ITERATIONS (1UL << 30)
+
+void runMicroBench(const MicroBench &bench, double minTime) {
+	unsigned long iterations = 1;
+	for(;;) {
+		BenchState state(iterations);
+		bench.func(state, bench.arg);
+		if (state.elapsed >= minTime || iterations >= MICRO_BENCH_MAX_ITERATIONS) { // if the run was long enough to trust, report it
+			double nsPerOp = state.elapsed * 1000000000.0 / iterations;
+			printf("%-32s %12lu %16.1f", bench.name.c_str(), iterations, nsPerOp);
+			if (state.items > 0 && state.elapsed > 0.0) {
+				printf(" %16.0f", (double)state.items * iterations / state.elapsed);
+			}
+			if (!state.note.empty()) {
+				printf("  %s", state.note.c_str());
+			}
+			printf("\n");
+			fflush(stdout);
+			return;
+		}
+		// otherwise, scale up the iteration count, aiming a bit past the minimum time
+		if (state.elapsed <= 0.0) {
+			iterations *= 10;
+		} else {
+			double scale = 1.4 * minTime / state.elapsed;
+			unsigned long next = (unsigned long)(iterations * (scale < 10.0 ? scale : 10.0));
+			iterations = (next > iterations) ? next : iterations + 1;
+		}
+		if (iterations > MICRO_BENCH_MAX_ITERATIONS) {
+			iterations = MICRO_BENCH_MAX_ITERATIONS;
+		}
+	}
+}
+
+// source buffers of varying token mix
+
+#define BUFFER_LINES 2000
+
+string identifierBuffer() {
+	static const char *words[] = { "alpha", "beta", "gamma", "delta", "stream", "filter", "latch", "pool" };
+	string acc;
+	char line[MAX_STRING_LENGTH];
+	for (unsigned int i=0; i < BUFFER_LINES; i++) {
+		sprintf(line, "%s%u.%s.%s %s%u;\n", words[i%8], i, words[(i+3)%8], words[(i+5)%8], words[(i+1)%8], i*7);
+		acc += line;
+	}
+	return acc;
+}
+
+string numberBuffer() {
+	string acc;
+	char line[MAX_STRING_LENGTH];
+	for (unsigned int i=0; i < BUFFER_LINES; i++) {
+		sprintf(line, "%u, %u.%u, %u.%ue+%u, 0, %u.0;\n", i*131, i, i*17, i%10, i, i%30, i*3);
+		acc += line;
+	}
+	return acc;
+}
+
+string operatorBuffer() {
+	string acc;
+	for (unsigned int i=0; i < BUFFER_LINES; i++) {
+		acc += "( + - * / % << >> == != <= >= < > && || ! ~ ++ -- & | ^ ) [ --> -> \\ ] { = ? : };\n";
+	}
+	return acc;
+}
+
+string literalBuffer() {
+	string acc;
+	for (unsigned int i=0; i < BUFFER_LINES; i++) {
+		acc += "// a line comment with a few words in it\n";
+		acc += "/* a block comment\n * spanning lines */\n";
+		acc += "\"a string literal with\\ttabs\\nand escapes\" 'c' '\\n';\n";
+	}
+	return acc;
+}
+
+string programBuffer() {
+	string acc("@std;\n");
+	char line[MAX_STRING_LENGTH];
+	for (unsigned int i=0; i < 10; i++) {
+		sprintf(line, "v%u = [int](%u);\n", i, i*11);
+		acc += line;
+	}
+	for (unsigned int i=0; i < BUFFER_LINES/4; i++) {
+		sprintf(line, "v%u + %u * v%u - (v%u %% %u) ->std.out;\n", i%10, i, (i+3)%10, (i+7)%10, i+1);
+		acc += line;
+		sprintf(line, "\\v%u [int x --> int] {x + %u -->} [int y --> int] {y * 2 -->} ->std.out;\n", i%10, i);
+		acc += line;
+		sprintf(line, "{\n\tw%u = [float](%u.%u);\n\t{ (w%u + 1.0) * 2.0 ->std.out; };\n};\n", i, i, i%10, i);
+		acc += line;
+		sprintf(line, "p%u = [int]{%u, %u, %u, %u};\n", i, i, i+1, i+2, i+3);
+		acc += line;
+	}
+	return acc;
+}
+
+typedef string (*BufferGenerator)();
+
+const BufferGenerator bufferGenerators[] = { identifierBuffer, numberBuffer, operatorBuffer, literalBuffer, programBuffer };
+#define BUFFER_PROGRAM 4
+
+const string &getBuffer(unsigned int which) {
+	static map<unsigned int, string> cache;
+	map<unsigned int, string>::const_iterator cacheFind = cache.find(which);
+	if (cacheFind != cache.end()) {
+		return (*cacheFind).second;
+	}
+	return (cache[which] = bufferGenerators[which]());
+}
+
+vector<Token> *lexBuffer(const string &buffer) {
+	std::istringstream in(buffer);
+	vector<Token> *lexeme = lex(&in, 0);
+	if (lexeme == NULL || lexerErrorCode) {
+		microBenchFail("buffer failed to lex");
+	}
+	return lexeme;
+}
+
+// lexer benchmarks
+
+void benchLex(BenchState &state, unsigned int which) {
+	const string &buffer = getBuffer(which);
+	vector<Token> *lexeme = lexBuffer(buffer);
+	state.items = lexeme->size();
+	delete lexeme;
+	while (state.keepRunning()) {
+		std::istringstream in(buffer);
+		delete lex(&in, 0);
+	}
+}
+
+// parser benchmarks
+
+void benchParse(BenchState &state, unsigned int which) {
+	vector<Token> *lexeme = lexBuffer(getBuffer(which));
+	state.items = lexeme->size();
+	while (state.keepRunning()) {
+		Tree *parseme = NULL;
+		if (parse(lexeme, parseme, 0)) {
+			microBenchFail("buffer failed to parse");
+		}
+		delete parseme;
+	}
+	delete lexeme;
+}
+
+// binding benchmarks
+
+#define SCOPE_DECLARATIONS 8
+
+// a chain of depth nested blocks, each with a few declarations, under a root block that declares d0 ... d7
+SymbolTree *buildScopeChain(unsigned int depth) {
+	char id[MAX_STRING_LENGTH];
+	SymbolTree *cur = new SymbolTree(KIND_BLOCK, getUniqueId());
+	for (unsigned int i=0; i < SCOPE_DECLARATIONS; i++) {
+		sprintf(id, "d%u", i);
+		*cur *= new SymbolTree(KIND_DECLARATION, id);
+	}
+	for (unsigned int i=0; i < depth; i++) {
+		SymbolTree *block = new SymbolTree(KIND_BLOCK, getUniqueId());
+		*cur *= block;
+		cur = block;
+		for (unsigned int j=0; j < SCOPE_DECLARATIONS; j++) {
+			sprintf(id, "local%u_%u", i, j);
+			*cur *= new SymbolTree(KIND_DECLARATION, id);
+		}
+	}
+	return cur; // the innermost block
+}
+
+void benchBindIdOuter(BenchState &state, unsigned int depth) {
+	SymbolTree *env = buildScopeChain(depth);
+	state.items = 1;
+	string id("d5");
+	while (state.keepRunning()) {
+		if (bindId(id, env, TypeStatus()).first == NULL) {
+			microBenchFail("binding failed");
+		}
+	}
+}
+
+void benchBindIdMissing(BenchState &state, unsigned int depth) {
+	SymbolTree *env = buildScopeChain(depth);
+	state.items = 1;
+	string id("notDeclared");
+	while (state.keepRunning()) {
+		if (bindId(id, env, TypeStatus()).first != NULL) {
+			microBenchFail("binding unexpectedly succeeded");
+		}
+	}
+}
+
+// type benchmarks
+
+#define TYPE_GRAPH_WIDTH 4
+
+// an object with int and filter members, a nested object member, and a filter member over another nested object
+Type *buildTypeGraph(unsigned int depth) {
+	char id[MAX_STRING_LENGTH];
+	ObjectType *obj = new ObjectType(SUFFIX_LATCH);
+	obj->instructorList.add(new TypeList(new StdType(STD_INT)));
+	obj->outstructorList.add(new TypeList(new StdType(STD_STRING)));
+	for (unsigned int i=0; i < TYPE_GRAPH_WIDTH; i++) {
+		sprintf(id, "i%u", i);
+		obj->memberList.add(id, new StdType(STD_INT, SUFFIX_LATCH));
+		sprintf(id, "f%u", i);
+		obj->memberList.add(id, new FilterType(new StdType(STD_INT), new StdType(STD_FLOAT, SUFFIX_STREAM, 1), SUFFIX_LATCH));
+	}
+	if (depth > 0) {
+		obj->memberList.add("object", buildTypeGraph(depth-1));
+		obj->memberList.add("filter", new FilterType(buildTypeGraph(depth-1), new StdType(STD_BOOL), SUFFIX_LATCH));
+	}
+	return obj;
+}
+
+// a filter from one object graph to another
+Type *buildFilterGraph(unsigned int depth) {
+	return new FilterType(buildTypeGraph(depth), buildTypeGraph(depth), SUFFIX_LATCH);
+}
+
+typedef Type *(*TypeGraphBuilder)(unsigned int depth);
+
+const TypeGraphBuilder typeGraphBuilders[] = { buildTypeGraph, buildFilterGraph };
+#define GRAPH_OBJECT 0
+#define GRAPH_FILTER 1
+#define TYPE_BENCH_ARG(graph, depth) ((graph) * 100 + (depth))
+
+void benchTypeEquals(BenchState &state, unsigned int arg) {
+	// two structurally equal but distinct graphs, so that nothing short-circuits on identity
+	Type *a = typeGraphBuilders[arg / 100](arg % 100);
+	Type *b = typeGraphBuilders[arg / 100](arg % 100);
+	state.items = 1;
+	while (state.keepRunning()) {
+		if (!(*a == *b)) {
+			microBenchFail("types unexpectedly differ");
+		}
+	}
+}
+
+void benchTypeSend(BenchState &state, unsigned int arg) {
+	Type *a = typeGraphBuilders[arg / 100](arg % 100);
+	Type *b = typeGraphBuilders[arg / 100](arg % 100);
+	state.items = 1;
+	while (state.keepRunning()) {
+		if (!(*a >> *b)) {
+			microBenchFail("types unexpectedly incompatible");
+		}
+	}
+}
+
+// runtime benchmarks
+
+#define RT_BENCH_LINES 0
+#define RT_BENCH_INTS 1
+#define RT_BENCH_UNBATCHED 2
+
+int openNull() {
+	int fd = open("/dev/null", O_WRONLY);
+	if (fd < 0) {
+		microBenchFail("cannot open /dev/null");
+	}
+	return fd;
+}
+
+// prints a buffer's worth of hello-world lines or numbers through the runtime, as a long-running pipe into std.out would
+void benchRtOut(BenchState &state, unsigned int which) {
+	static const char line[] = "Hello, World!\n";
+	int nullFd = openNull();
+	rtInit();
+	rtRedirect(STDIN_FILENO, nullFd, STDERR_FILENO);
+	state.items = BUFFER_LINES;
+	while (state.keepRunning()) {
+		for (unsigned int i=0; i < BUFFER_LINES; i++) {
+			switch (which) {
+				case RT_BENCH_LINES:
+					rtOutString(RT_STREAM_OUT, line, sizeof(line)-1);
+					break;
+				case RT_BENCH_INTS:
+					rtOutInt(RT_STREAM_OUT, (int64_t)i * 7919 - 1000000);
+					rtOutChar(RT_STREAM_OUT, '\n');
+					break;
+				default: // RT_BENCH_UNBATCHED; the baseline of one write(2) per element
+					if (write(nullFd, line, sizeof(line)-1) < 0) {
+						microBenchFail("cannot write to /dev/null");
+					}
+					break;
+			}
+		}
+		rtYield();
+	}
+	rtRedirect(STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO);
+	close(nullFd);
+}
+
+// reads a buffer's worth of integers or floats through the runtime's input tokenizers
+void benchRtIn(BenchState &state, unsigned int which) {
+	FILE *in = tmpfile();
+	if (in == NULL) {
+		microBenchFail("cannot create a temporary file");
+	}
+	for (unsigned int i=0; i < BUFFER_LINES; i++) {
+		if (which == RT_BENCH_INTS) {
+			fprintf(in, "%d %u\n", (int)(i * 7919) - 1000000, i);
+		} else {
+			fprintf(in, "%u.%03u -%ue-%u\n", i, i % 1000, i, i % 20);
+		}
+	}
+	fflush(in);
+	state.items = 2 * BUFFER_LINES;
+	rtInit();
+	while (state.keepRunning()) {
+		lseek(fileno(in), 0, SEEK_SET);
+		rtRedirect(fileno(in), STDOUT_FILENO, STDERR_FILENO);
+		for (unsigned int i=0; i < 2 * BUFFER_LINES; i++) {
+			if (which == RT_BENCH_INTS) {
+				rtInInt();
+			} else {
+				rtInFloat();
+			}
+		}
+	}
+	rtRedirect(STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO);
+	fclose(in);
+}
+
+// builds a buffer's worth of calculator-style lines, as ("\r" + ms/1000.0 + ":" + a + op + b + "=" + r) would;
+// the fused form is the single rtCatString() call that the optimizer turns the chain into,
+// and the chained form is the baseline of a separate allocation for every conversion and every binary concatenation
+#define RT_BENCH_CAT_FUSED 0
+#define RT_BENCH_CAT_CHAINED 1
+
+// one step of the chained baseline; consumes both operands
+char *benchCatPair(char *left, char *right) {
+	size_t leftLength = strlen(left), rightLength = strlen(right);
+	char *acc = (char *)malloc(leftLength + rightLength + 1);
+	memcpy(acc, left, leftLength);
+	memcpy(acc + leftLength, right, rightLength + 1);
+	free(left);
+	free(right);
+	return acc;
+}
+
+char *benchCatString(const char *s) {
+	return strdup(s);
+}
+
+char *benchCatInt(int64_t x) {
+	char tempS[MAX_INT_STRING_LENGTH];
+	sprintf(tempS, "%" PRId64, x);
+	return strdup(tempS);
+}
+
+char *benchCatFloat(double x) {
+	char tempS[MAX_FLOAT_STRING_LENGTH];
+	snprintf(tempS, sizeof(tempS), FLOAT_STRING_FORMAT, x);
+	return strdup(tempS);
+}
+
+void benchRtCat(BenchState &state, unsigned int which) {
+	state.items = BUFFER_LINES;
+	size_t total = 0;
+	while (state.keepRunning()) {
+		for (unsigned int i=0; i < BUFFER_LINES; i++) {
+			int64_t a = (int64_t)i * 7919 - 1000000, b = i % 1000, r = a + b;
+			double ms = i * 16.5;
+			char *acc;
+			if (which == RT_BENCH_CAT_FUSED) {
+				RtCatPart parts[8];
+				memset(parts, 0, sizeof(parts));
+				parts[0].format = CAT_FORMAT_STRING; parts[0].s = "\r"; parts[0].length = 1;
+				parts[1].format = CAT_FORMAT_FLOAT; parts[1].f = ms / 1000.0;
+				parts[2].format = CAT_FORMAT_STRING; parts[2].s = ":"; parts[2].length = 1;
+				parts[3].format = CAT_FORMAT_INT; parts[3].word = a;
+				parts[4].format = CAT_FORMAT_CHAR; parts[4].word = '+';
+				parts[5].format = CAT_FORMAT_INT; parts[5].word = b;
+				parts[6].format = CAT_FORMAT_STRING; parts[6].s = "="; parts[6].length = 1;
+				parts[7].format = CAT_FORMAT_INT; parts[7].word = r;
+				total += rtCatString(&acc, parts, 8);
+			} else { // RT_BENCH_CAT_CHAINED
+				acc = benchCatPair(benchCatString("\r"), benchCatFloat(ms / 1000.0));
+				acc = benchCatPair(acc, benchCatString(":"));
+				acc = benchCatPair(acc, benchCatInt(a));
+				acc = benchCatPair(acc, benchCatString("+"));
+				acc = benchCatPair(acc, benchCatInt(b));
+				acc = benchCatPair(acc, benchCatString("="));
+				acc = benchCatPair(acc, benchCatInt(r));
+				total += strlen(acc);
+			}
+			free(acc);
+		}
+	}
+	if (total == 0) { // keep the results observable
+		microBenchFail("empty concatenations");
+	}
+}
+
+// a std.gen range of RT_RANGE_COUNT iterations, each doing a little arithmetic and printing its result, as
+//	RT_RANGE_COUNT std.gen <| [int i] { ... ->std.out; };
+// would after lowering; the range runs serially or split across the workers
+#define RT_RANGE_COUNT 1000000
+#define RT_RANGE_WORK 64
+
+class RangeBench {
+	public:
+		// data members
+		int parallel; // whether to run the range in parallel
+		int64_t checksum; // the sum of the iterations' results
+		pthread_mutex_t lock; // protects checksum
+};
+
+void rangeBenchBody(void *arg, int64_t begin, int64_t end) {
+	RangeBench *bench = (RangeBench *)arg;
+	int64_t sum = 0;
+	for (int64_t i = begin; i < end; i++) {
+		uint64_t x = (uint64_t)i;
+		for (unsigned int j=0; j < RT_RANGE_WORK; j++) { // a small xorshift walk stands in for the block's work
+			x ^= x << 13;
+			x ^= x >> 7;
+			x ^= x << 17;
+		}
+		rtOutInt(RT_STREAM_OUT, (int64_t)(x & 0xFFFF));
+		rtOutChar(RT_STREAM_OUT, '\n');
+		sum += (int64_t)(x & 0xFFFF);
+	}
+	pthread_mutex_lock(&(bench->lock));
+	bench->checksum += sum;
+	pthread_mutex_unlock(&(bench->lock));
+}
+
+void rangeBenchLabel(void *arg) {
+	rtRange(rangeBenchBody, arg, RT_RANGE_COUNT, ((RangeBench *)arg)->parallel);
+}
+
+void benchRtRange(BenchState &state, unsigned int parallel) {
+	int nullFd = openNull();
+	rtInit();
+	rtRedirect(STDIN_FILENO, nullFd, STDERR_FILENO);
+	RangeBench bench;
+	bench.parallel = parallel;
+	bench.checksum = 0;
+	pthread_mutex_init(&(bench.lock), NULL);
+	state.items = RT_RANGE_COUNT;
+	while (state.keepRunning()) {
+		rtRun(rangeBenchLabel, &bench);
+	}
+	rtRedirect(STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO);
+	close(nullFd);
+	pthread_mutex_destroy(&(bench.lock));
+	if (bench.checksum == 0) { // keep the results observable
+		microBenchFail("empty range");
+	}
+}
+
+// a destream body fed RT_BATCH_COUNT elements, each doing the same work as an iteration of the range bench, as
+//	\\s [int x] { ... };
+// would after lowering; the access flags decide whether the body prints its results and how its batches are run
+#define RT_BATCH_COUNT 1000000
+
+class BatchBench {
+	public:
+		// data members
+		int access; // the body's ACCESS_ flags
+		RtBatch *batch; // the batch that the elements are pushed into
+		int64_t checksum; // the sum of the elements' results
+		pthread_mutex_t lock; // protects checksum
+};
+
+void batchBenchBody(void *arg, const uint64_t *elements, int64_t begin, int64_t end) {
+	BatchBench *bench = (BatchBench *)arg;
+	int64_t sum = 0;
+	for (int64_t i = begin; i < end; i++) {
+		uint64_t x = elements[i];
+		for (unsigned int j=0; j < RT_RANGE_WORK; j++) {
+			x ^= x << 13;
+			x ^= x >> 7;
+			x ^= x << 17;
+		}
+		if (bench->access & ACCESS_WRITES_OUTPUT) {
+			rtOutInt(RT_STREAM_OUT, (int64_t)(x & 0xFFFF));
+			rtOutChar(RT_STREAM_OUT, '\n');
+		}
+		sum += (int64_t)(x & 0xFFFF);
+	}
+	pthread_mutex_lock(&(bench->lock));
+	bench->checksum += sum;
+	pthread_mutex_unlock(&(bench->lock));
+}
+
+void batchBenchLabel(void *arg) {
+	BatchBench *bench = (BatchBench *)arg;
+	for (uint64_t i=0; i < RT_BATCH_COUNT; i++) {
+		rtPushBatch(bench->batch, i + 1);
+	}
+	rtFlushBatch(bench->batch);
+}
+
+void benchRtBatch(BenchState &state, unsigned int access) {
+	int nullFd = openNull();
+	rtInit();
+	rtRedirect(STDIN_FILENO, nullFd, STDERR_FILENO);
+	BatchBench bench;
+	bench.access = access;
+	bench.batch = rtNewBatch(batchBenchBody, &bench, access);
+	bench.checksum = 0;
+	pthread_mutex_init(&(bench.lock), NULL);
+	state.items = RT_BATCH_COUNT;
+	while (state.keepRunning()) {
+		rtRun(batchBenchLabel, &bench);
+	}
+	rtFreeBatch(bench.batch);
+	rtRedirect(STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO);
+	close(nullFd);
+	pthread_mutex_destroy(&(bench.lock));
+	if (bench.checksum == 0) { // keep the results observable
+		microBenchFail("empty batch");
+	}
+}
+
+// a filter that makes RT_ALLOC_COUNT small fixed-extent array (or pool) instances of assorted sizes, as the block of
+//	[int x --> int] { a = [int : n] ...; };
+// would, freeing each array as its block completes; the arrays come out of the slabs, straight out of malloc(3), or out of the pool
+#define RT_ALLOC_COUNT 100000
+#define RT_ALLOC_LIVE 16
+#define RT_BENCH_ALLOC_SLAB 0
+#define RT_BENCH_ALLOC_MALLOC 1
+#define RT_BENCH_ALLOC_POOL 2
+
+void benchRtAlloc(BenchState &state, unsigned int which) {
+	rtInit();
+	state.items = RT_ALLOC_COUNT;
+	int64_t checksum = 0;
+	while (state.keepRunning()) {
+		int64_t *live[RT_ALLOC_LIVE];
+		size_t sizes[RT_ALLOC_LIVE];
+		void *mark = NULL;
+		for (unsigned int i=0; i < RT_ALLOC_COUNT; i++) {
+			unsigned int slot = i % RT_ALLOC_LIVE;
+			if (i >= RT_ALLOC_LIVE) { // the array made RT_ALLOC_LIVE iterations ago goes out of scope
+				checksum += live[slot][0];
+				if (which == RT_BENCH_ALLOC_SLAB) {
+					rtFreeArray(live[slot], sizes[slot]);
+				} else if (which == RT_BENCH_ALLOC_MALLOC) {
+					free(live[slot]);
+				}
+			}
+			if (which == RT_BENCH_ALLOC_POOL && slot == 0) { // the pool's block completes once every RT_ALLOC_LIVE iterations
+				if (mark != NULL) {
+					rtPoolRelease(mark);
+				}
+				mark = rtPoolMark();
+			}
+			sizes[slot] = sizeof(int64_t) * (2 + i % 61);
+			if (which == RT_BENCH_ALLOC_SLAB) {
+				live[slot] = (int64_t *)rtAllocArray(sizes[slot]);
+			} else if (which == RT_BENCH_ALLOC_MALLOC) {
+				live[slot] = (int64_t *)malloc(sizes[slot]);
+			} else { // RT_BENCH_ALLOC_POOL
+				live[slot] = (int64_t *)rtAllocPool(sizes[slot]);
+			}
+			live[slot][0] = i;
+			live[slot][sizes[slot] / sizeof(int64_t) - 1] = i;
+		}
+		for (unsigned int slot=0; slot < RT_ALLOC_LIVE; slot++) {
+			checksum += live[slot][0];
+			if (which == RT_BENCH_ALLOC_SLAB) {
+				rtFreeArray(live[slot], sizes[slot]);
+			} else if (which == RT_BENCH_ALLOC_MALLOC) {
+				free(live[slot]);
+			}
+		}
+		if (which == RT_BENCH_ALLOC_POOL) {
+			rtPoolRelease(mark);
+		}
+	}
+	if (checksum == 0) { // keep the results observable
+		microBenchFail("empty allocations");
+	}
+}
+
+// a pipe that runs through RT_DELAY_ROUNDS delays of RT_DELAY_PERIOD milliseconds each, measuring how late each delay ends;
+// the pipes start out staggered over one period, as they would be in a running program
+#define RT_DELAY_ROUNDS 5
+#define RT_DELAY_PERIOD 100
+
+class DelayPipe {
+	public:
+		// data members
+		unsigned int rounds; // the number of delays left to go through
+		double due; // the wall time at which the current delay should end, 0 before the first one
+		double latenessSum; // the total time by which the delays ended late
+		double latenessMax; // the longest time by which a delay ended late
+};
+
+void delayPipeLabel(void *arg) {
+	DelayPipe *pipe = (DelayPipe *)arg;
+	double now = getWallTime();
+	if (pipe->due > 0.0) {
+		double lateness = now - pipe->due;
+		pipe->latenessSum += lateness;
+		if (lateness > pipe->latenessMax) {
+			pipe->latenessMax = lateness;
+		}
+	}
+	if (pipe->rounds > 0) {
+		pipe->rounds--;
+		pipe->due = now + RT_DELAY_PERIOD / 1000.0;
+		rtDelay(delayPipeLabel, pipe, RT_DELAY_PERIOD);
+	}
+}
+
+void delayStartLabel(void *arg) {
+	vector<DelayPipe> &pipes = *(vector<DelayPipe> *)arg;
+	for (unsigned int i=0; i < pipes.size(); i++) {
+		unsigned int ms = 1 + i % RT_DELAY_PERIOD; // the staggered start counts as the first delay
+		pipes[i].rounds--;
+		pipes[i].due = getWallTime() + ms / 1000.0;
+		rtDelay(delayPipeLabel, &pipes[i], ms);
+	}
+}
+
+// runs the given number of concurrent delayed pipes through the scheduler's timer wheel, reporting the CPU time spent per delay and the lateness of the delays
+void benchRtDelay(BenchState &state, unsigned int numPipes) {
+	DelayPipe blank = { RT_DELAY_ROUNDS, 0.0, 0.0, 0.0 };
+	vector<DelayPipe> pipes(numPipes, blank);
+	state.items = numPipes * RT_DELAY_ROUNDS;
+	rtInit();
+	clock_t cpuStart = clock();
+	while (state.keepRunning()) {
+		for (unsigned int i=0; i < numPipes; i++) {
+			pipes[i].rounds = RT_DELAY_ROUNDS;
+			pipes[i].due = 0.0;
+		}
+		rtRun(delayStartLabel, &pipes);
+	}
+	double cpuTime = (double)(clock() - cpuStart) / CLOCKS_PER_SEC;
+	double latenessSum = 0.0;
+	double latenessMax = 0.0;
+	for (unsigned int i=0; i < numPipes; i++) {
+		latenessSum += pipes[i].latenessSum;
+		latenessMax = (pipes[i].latenessMax > latenessMax) ? pipes[i].latenessMax : latenessMax;
+	}
+	double numDelays = (double)state.items * state.iterations;
+	char tempS[MAX_STRING_LENGTH];
+	sprintf(tempS, "cpu %.0f ns/delay, late %.0f us avg, %.0f us max", cpuTime * 1000000000.0 / numDelays, latenessSum * 1000000.0 / numDelays, latenessMax * 1000000.0);
+	state.note = tempS;
+}
+
+// main
+
+int main(int argc, char **argv) {
+	double minTime = 0.5;
+	string filter;
+	for (int i=1; i < argc; i++) {
+		if (strcmp(argv[i], "-t") == 0 && i+1 < argc) {
+			minTime = atof(argv[++i]);
+		} else {
+			filter = argv[i];
+		}
+	}
+
+	// set up the global state that the front end expects
+	silentMode = true;
+	inFileNames.push_back("<microbenchmark>");
+	initSemmerGlobals();
+
+	vector<MicroBench> benches;
+	benches.push_back(MicroBench("lex/identifiers", benchLex, 0));
+	benches.push_back(MicroBench("lex/numbers", benchLex, 1));
+	benches.push_back(MicroBench("lex/operators", benchLex, 2));
+	benches.push_back(MicroBench("lex/literals", benchLex, 3));
+	benches.push_back(MicroBench("lex/program", benchLex, BUFFER_PROGRAM));
+	benches.push_back(MicroBench("parse/program", benchParse, BUFFER_PROGRAM));
+	benches.push_back(MicroBench("bindId/outer/8", benchBindIdOuter, 8));
+	benches.push_back(MicroBench("bindId/outer/64", benchBindIdOuter, 64));
+	benches.push_back(MicroBench("bindId/missing/8", benchBindIdMissing, 8));
+	benches.push_back(MicroBench("bindId/missing/64", benchBindIdMissing, 64));
+	benches.push_back(MicroBench("type==/object/2", benchTypeEquals, TYPE_BENCH_ARG(GRAPH_OBJECT, 2)));
+	benches.push_back(MicroBench("type==/object/6", benchTypeEquals, TYPE_BENCH_ARG(GRAPH_OBJECT, 6)));
+	benches.push_back(MicroBench("type==/filter/2", benchTypeEquals, TYPE_BENCH_ARG(GRAPH_FILTER, 2)));
+	benches.push_back(MicroBench("type==/filter/6", benchTypeEquals, TYPE_BENCH_ARG(GRAPH_FILTER, 6)));
+	benches.push_back(MicroBench("type>>/object/2", benchTypeSend, TYPE_BENCH_ARG(GRAPH_OBJECT, 2)));
+	benches.push_back(MicroBench("type>>/object/6", benchTypeSend, TYPE_BENCH_ARG(GRAPH_OBJECT, 6)));
+	benches.push_back(MicroBench("type>>/filter/2", benchTypeSend, TYPE_BENCH_ARG(GRAPH_FILTER, 2)));
+	benches.push_back(MicroBench("type>>/filter/6", benchTypeSend, TYPE_BENCH_ARG(GRAPH_FILTER, 6)));
+	benches.push_back(MicroBench("rt/out/lines", benchRtOut, RT_BENCH_LINES));
+	benches.push_back(MicroBench("rt/out/ints", benchRtOut, RT_BENCH_INTS));
+	benches.push_back(MicroBench("rt/out/unbatched", benchRtOut, RT_BENCH_UNBATCHED));
+	benches.push_back(MicroBench("rt/in/ints", benchRtIn, RT_BENCH_INTS));
+	benches.push_back(MicroBench("rt/in/floats", benchRtIn, RT_BENCH_LINES));
+	benches.push_back(MicroBench("rt/cat/fused", benchRtCat, RT_BENCH_CAT_FUSED));
+	benches.push_back(MicroBench("rt/cat/chained", benchRtCat, RT_BENCH_CAT_CHAINED));
+	benches.push_back(MicroBench("rt/range/serial", benchRtRange, 0));
+	benches.push_back(MicroBench("rt/range/parallel", benchRtRange, 1));
+	benches.push_back(MicroBench("rt/batch/pure", benchRtBatch, 0));
+	benches.push_back(MicroBench("rt/batch/ordered", benchRtBatch, ACCESS_WRITES_OUTPUT));
+	benches.push_back(MicroBench("rt/batch/writing", benchRtBatch, ACCESS_WRITES_LATCHES | ACCESS_WRITES_OUTPUT));
+	benches.push_back(MicroBench("rt/alloc/slab", benchRtAlloc, RT_BENCH_ALLOC_SLAB));
+	benches.push_back(MicroBench("rt/alloc/malloc", benchRtAlloc, RT_BENCH_ALLOC_MALLOC));
+	benches.push_back(MicroBench("rt/alloc/pool", benchRtAlloc, RT_BENCH_ALLOC_POOL));
+	benches.push_back(MicroBench("rt/delay/1000", benchRtDelay, 1000));
+	benches.push_back(MicroBench("rt/delay/100000", benchRtDelay, 100000));
+
+	printf("%-32s %12s %16s %16s\n", "benchmark", "iterations", "ns/op", "items/s");
+	for (unsigned int i=0; i < benches.size(); i++) {
+		if (benches[i].name.find(filter) != string::npos) {
+			runMicroBench(benches[i], minTime);
+		}
+	}
+	return 0;
+}
@@ -6,11 +6,39 @@
 
 #define NUM_RULES 512
 
-// parses the generated parse table into an includable .h file with the appropriate struct representation
+// layout of the table file written by hyacc -T; see bld/hyacc/gen_tables.c
+#define TABLES_MAGIC "HYTB"
+#define TABLES_VERSION 1
+
+// reads a 32-bit little endian number from the table file; returns false on a short read
+bool readTablesInt(FILE *in, unsigned int &x) {
+	unsigned char buf[4];
+	if (fread(buf, 1, 4, in) != 4) {
+		return false;
+	}
+	x = (unsigned int)buf[0] | ((unsigned int)buf[1] << 8) | ((unsigned int)buf[2] << 16) | ((unsigned int)buf[3] << 24);
+	return true;
+}
+
+// reads a length-prefixed name from the table file; returns false on a short read
+bool readTablesName(FILE *in, string &name) {
+	unsigned int len;
+	if (!readTablesInt(in, len) || len >= MAX_STRING_LENGTH) {
+		return false;
+	}
+	char nameBuf[MAX_STRING_LENGTH];
+	if (fread(nameBuf, 1, len, in) != len) {
+		return false;
+	}
+	name = string(nameBuf, len);
+	return true;
+}
+
+// converts the parser table written by hyacc -T into includable .h files with the appropriate struct representation
 int main() {
 	// input file
 	FILE *in;
-	in = fopen("./tmp/parserTable.txt","r");
+	in = fopen("./tmp/parserTable.bin","rb");
 	if (in == NULL) { // if file open failed, return an error
 		return -1;
 	}
@@ -40,6 +68,13 @@ int main() {
 	if (rrl == NULL) { // if file open failed, return an error
 		return -1;
 	}
+
+	// check the table file's magic and version
+	char magic[4];
+	unsigned int version;
+	if (fread(magic, 1, 4, in) != 4 || memcmp(magic, TABLES_MAGIC, 4) != 0 || !readTablesInt(in, version) || version != TABLES_VERSION) {
+		return -1;
+	}
 	
 	// print out the header notice to the .h
 	fprintf(header, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
@@ -50,70 +85,39 @@ int main() {
 	fprintf(header, "#include \"../src/parserNodeStruct.h\"\n\n");
 	fprintf(header, "#define NUM_RULES %d\n\n", NUM_RULES);
 
-	// now, process the input file
-	char lineBuf[MAX_STRING_LENGTH]; // line data buffer
-
-	// first, scan ahead to the parser table
-	bool tableFound = false;
-	for(;;) {
-		char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
-		if (retVal == NULL) { // if we've reached the end of the file, break out of the loop
-			break;
-		}
-		if (strcmp(lineBuf,"--Parsing Table--\n") == 0) { // if we've found the beginning of the parse table, break out of the loop
-			tableFound = true;
-			break;
-		}
-	}
-	// if we couldn't find a parse table block, return with an error
-	if (!tableFound) {
-		return -1;
-	}
-
-	// now, extract the token ordering from the header row
-	// read the header into the line buffer
-	char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
-	if (retVal == NULL) { // if we've reached the end of the file, return an error code
+	// read in the column ordering of the table
+	unsigned int colCount;
+	if (!readTablesInt(in, colCount)) {
 		return -1;
 	}
-	// discard the initial "State"
-	char *lbCur = lineBuf;
-	char junk[MAX_STRING_LENGTH];
-	sscanf(lbCur, "%s", junk);
-	lbCur += strlen(junk)+1; // scan past the "State"
-	// read in the token ordering itself
-	bool parsingNonTerms = false; // whether we have reached the nonterminal part yet
 	unsigned int nonTermCount = 0;
 	string token; // temporary token string
-	map<unsigned int, string> tokenOrder;
-	map<string, unsigned int> tokenClassifier;
-	for(;;) {
-		if (sscanf(lbCur, "%s", junk) < 1) {
-			break;
+	vector<unsigned int> colTokenType; // the token type that each table column maps to
+	for (unsigned int i=0; i < colCount; i++) {
+		unsigned int isNonTerm;
+		string name;
+		if (!readTablesInt(in, isNonTerm) || !readTablesName(in, name)) {
+			return -1;
 		}
-		lbCur += strlen(junk)+1;
 		// allocate a string with this token in it
 		token = "TOKEN_";
 		// $end token special-casing
-		if (strcmp(junk, "$end") == 0) {
+		if (name == "$end") {
 			token += "END";
 		} else {
-			token += junk;
-		}
-		if (token == "TOKEN_Program") {
-			parsingNonTerms = true;
+			token += name;
 		}
-		if (parsingNonTerms) {
+		if (isNonTerm) { // nonterminals get numbers following the lexer's tokens
 			fprintf(header, "#define %s NUM_TOKENS + %d\n", token.c_str(), nonTermCount);
+			colTokenType.push_back(NUM_TOKENS + nonTermCount);
 			nonTermCount++;
-		}
-		// push the string to the token ordering map
-		tokenOrder.insert( make_pair(tokenOrder.size(), token) );
-		unsigned int mapping = string2TokenType(token);
-		if (mapping != NUM_TOKENS) { // if it's a lexerStruct mapping
-			tokenClassifier.insert( make_pair(token, mapping) );
-		} else { // otherwise, if it's a parserStruct mapping
-			tokenClassifier.insert( make_pair(token, (NUM_TOKENS + (nonTermCount - 1))) );
+		} else { // terminals must have a lexerStruct mapping
+			unsigned int mapping = string2TokenType(token);
+			if (mapping == NUM_TOKENS) {
+				fprintf(stderr, "parserStructGen: grammar terminal %s has no lexer token\n", name.c_str());
+				return -1;
+			}
+			colTokenType.push_back(mapping);
 		}
 	}
 	// print out the definition of the number of nonterminals
@@ -124,24 +128,11 @@ int main() {
 	// print out the epilogue into the .h
 	fprintf(header, "#endif\n");
 
-	// now, back up in the file and scan ahead to the rule declarations
-	fseek(in, 0, SEEK_SET);
-	bool rulesFound = false;
-	for(;;) {
-		char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
-		if (retVal == NULL) { // if we've reached the end of the file, break out of the loop
-			break;
-		}
-		if (strcmp(lineBuf,"Rules: \n") == 0) { // if we've found the beginning of the rules, break out of the loop
-			rulesFound = true;
-			break;
-		}
-	}
-	// if we couldn't find a rule block, return with an error
-	if (!rulesFound) {
+	// read in the rules
+	unsigned int ruleCount;
+	if (!readTablesInt(in, ruleCount) || ruleCount > NUM_RULES) {
 		return -1;
 	}
-
 	// print out the ruleLhsTokenType, ruleLshTokenString, and ruleRhsLength header notices
 	fprintf(rltt, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
 	fprintf(rlts, "/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */\n\n");
@@ -150,53 +141,13 @@ int main() {
 	fprintf(rltt, "const int ruleLhsTokenType[NUM_RULES] = {\n");
 	fprintf(rlts, "const char *ruleLhsTokenString[NUM_RULES] = {\n");
 	fprintf(rrl, "const unsigned int ruleRhsLength[NUM_RULES] = {\n");
-	// get rule lengths
-	for (unsigned int i=0; true; i++) { // per-rule line loop
-		// read in a line
-		char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
-		if (retVal == NULL) { // if we've reached the end of the file, break out of the loop
+	for (unsigned int i=0; i < ruleCount; i++) { // per-rule loop
+		string lhs;
+		unsigned int rhsElements;
+		if (!readTablesName(in, lhs) || !readTablesInt(in, rhsElements)) {
 			return -1;
 		}
-		char *lbCur = lineBuf;
-		// discard the junk before the rule's lhs
-		char junk[MAX_STRING_LENGTH];
-		sscanf(lbCur, "%s", junk); // scan the first token of the line
-		if (junk[0] == 'N') { // break if we've reached the end of the rule set
-			break;
-		}
-		// scan over to the next token
-		lbCur += strlen(junk);
-		while (lbCur[0] == ' ' || lbCur[0] == 't') {
-			lbCur++;
-		}
-		// scan in the lhs of the rule
-		sscanf(lbCur, "%s", junk);
-		string lhs(junk); // log the lhs in a string wrapper
-		// scan over to the next token
-		lbCur += strlen(junk);
-		while (lbCur[0] == ' ' || lbCur[0] == 't') {
-			lbCur++;
-		}
-		sscanf(lbCur, "%s", junk); // scan and throw away the next "->" token in the line
-		// scan over to the next token
-		lbCur += strlen(junk);
-		while (lbCur[0] == ' ' || lbCur[0] == 't') {
-			lbCur++;
-		}
-		// now, count the number of elements on the RHS
-		int rhsElements = 0;
-		for(;;) {
-			if (sscanf(lbCur, "%s", junk) < 1 || junk[0] == '(') { // break wif we reach the end of the line
-				break;
-			}
-			// scan over to the next token
-			lbCur += strlen(junk);
-			while (lbCur[0] == ' ' || lbCur[0] == 't') {
-				lbCur++;
-			}
-			rhsElements++;
-		}
-		// then, log the lhs tokenType, lhs tokenString and rhs size of the rule in the corresponding arrays
+		// log the lhs tokenType, lhs tokenString and rhs size of the rule in the corresponding arrays
 		if (lhs != "$accept") {
 			fprintf(rltt, "\tTOKEN_%s,\n", lhs.c_str());
 			fprintf(rlts, "\t\"%s\",\n", lhs.c_str());
@@ -210,28 +161,11 @@ int main() {
 	fprintf(rlts, "};\n");
 	fprintf(rrl, "};\n");
 
-	// now, scan ahead to the parse table
-	tableFound = false;
-	for(;;) {
-		char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
-		if (retVal == NULL) { // if we've reached the end of the file, break out of the loop
-			break;
-		}
-		if (strcmp(lineBuf,"--Parsing Table--\n") == 0) { // if we've found the beginning of the parse table, break out of the loop
-			tableFound = true;
-			break;
-		}
-	}
-	if (!tableFound) { // if we couldn't find a parse table block, return with an error
+	// finally, process the raw parse table actions
+	unsigned int stateCount;
+	if (!readTablesInt(in, stateCount) || stateCount > NUM_RULES) {
 		return -1;
-	} else { // otherwise, eat the header line and return an error if this fails
-		char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
-		if (retVal == NULL) { // if we've reached the end of the file, break out of the loop
-			return -1;
-		}
 	}
-
-	// finally, process the raw parse table actions
 	ParserNode parserNode[NUM_RULES][NUM_TOKENS + nonTermCount];
 	for (unsigned int i=0; i < NUM_RULES; i++) {
 		for (unsigned int j=0; j < (NUM_TOKENS + nonTermCount); j++) {
@@ -239,40 +173,23 @@ int main() {
 			parserNode[i][j].n = ACTION_ERROR;
 		}
 	}
-	for(;;) {
-		char *retVal = fgets(lineBuf, MAX_STRING_LENGTH, in);
-		if (retVal == NULL || lineBuf[0] == 'N') { // if we've reached the end of the table, break out of the loop
-			break;
-		}
-		// the line was valid, so now try parsing the data out of it
-		int fromState;
-		// first, read the state number
-		char *lbCur = lineBuf;
-		sscanf(lbCur, "%s", junk);
-		// advance past the current token
-		lbCur += strlen(junk);
-		while(lbCur[0] == ' ' || lbCur[0] == '\t') {
-			lbCur++;
-		}
-		// parse out the state number from the string
-		fromState = atoi(junk);
-		// now, read all of the transitions for this state
-		for(unsigned int i=0; i<tokenOrder.size(); i++) {
-			sscanf(lbCur, "%s", junk); // read a transition
-			// advance past the current token
-			lbCur += strlen(junk);
-			while(lbCur[0] == ' ' || lbCur[0] == '\t') {
-				lbCur++;
+	for (unsigned int fromState=0; fromState < stateCount; fromState++) {
+		// read all of the transitions for this state
+		for (unsigned int i=0; i < colCount; i++) {
+			int action = fgetc(in);
+			unsigned int n;
+			if (action == EOF || !readTablesInt(in, n)) {
+				return -1;
 			}
 			// branch based on the type of transition action it is
-			if (junk[0] == 's') { // shift action
-				parserNode[fromState][tokenClassifier[tokenOrder[i]]] = (ParserNode){ ACTION_SHIFT, atoi(junk+1) };
-			} else if (junk[0] == 'r') { // reduce action
-				parserNode[fromState][tokenClassifier[tokenOrder[i]]] = (ParserNode){ ACTION_REDUCE, atoi(junk+1) };
-			} else if (junk[0] == 'a') { // accept action
-				parserNode[fromState][tokenClassifier[tokenOrder[i]]] = (ParserNode){ ACTION_ACCEPT, ACTION_ERROR };
-			} else if (junk[0] == 'g') { // goto action
-				parserNode[fromState][tokenClassifier[tokenOrder[i]]] = (ParserNode){ ACTION_GOTO, atoi(junk+1) };
+			if (action == 's') { // shift action
+				parserNode[fromState][colTokenType[i]] = (ParserNode){ ACTION_SHIFT, n };
+			} else if (action == 'r') { // reduce action
+				parserNode[fromState][colTokenType[i]] = (ParserNode){ ACTION_REDUCE, n };
+			} else if (action == 'a') { // accept action
+				parserNode[fromState][colTokenType[i]] = (ParserNode){ ACTION_ACCEPT, ACTION_ERROR };
+			} else if (action == 'g') { // goto action
+				parserNode[fromState][colTokenType[i]] = (ParserNode){ ACTION_GOTO, n };
 			}
 			// do nothing on error states; all states have been defaulted to ACTION_ERROR already
 		}
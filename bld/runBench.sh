@@ -0,0 +1,61 @@
+#!/bin/sh
+
+### Front-end benchmark script
+### arguments: $(TARGET) $(BENCH_SCALE) $(BENCH_RUNS)
+### generates the benchmark programs into tmp/bench, times the lexer, parser and semmer on each one
+### (keeping the fastest of the runs), and appends the results to var/benchResults.tsv
+
+RESULTS=var/benchResults.tsv
+
+mkdir -p tmp/bench
+mkdir -p var
+./bin/benchGen tmp/bench $2
+if test $? -ne 0
+then
+	echo Failed to generate benchmark programs!
+	exit 1
+fi
+
+if test ! -f $RESULTS
+then
+	echo "date	version	scale	case	bytes	tokens	nodes	lex_s	parse_s	sem_s	tokens_per_s	nodes_per_s	sem_errors" > $RESULTS
+fi
+DATE="`date '+%Y-%m-%dT%H:%M:%S'`"
+VERSION="`cat var/versionStamp.txt 2> /dev/null`"
+
+echo
+echo ...Running front-end benchmarks...
+echo --------------------------------
+printf "%-14s %10s %10s %10s %10s %10s %12s %12s\n" case tokens nodes lex_ms parse_ms sem_ms tokens/s nodes/s
+for PROGRAM in tmp/bench/*.ani
+do
+	CASE="`basename $PROGRAM .ani`"
+	BYTES="`wc -c < $PROGRAM | tr -d ' '`"
+	RUN=0
+	BEST=""
+	while test $RUN -lt $3
+	do
+		RECORD="`./$1 -s -b $PROGRAM | grep '^BENCH'`"
+		if test -z "$RECORD"
+		then
+			echo "$CASE: failed to lex or parse"
+			break
+		fi
+		BEST="`echo "$RECORD
+$BEST" | awk -F '\t' 'NF >= 7 { t = $4 + $5 + $6; if (best == "" || t < bt) { best = $0; bt = t } } END { print best }'`"
+		RUN=`expr $RUN + 1`
+	done
+	if test -z "$BEST"
+	then
+		continue
+	fi
+	echo "$BEST" | awk -F '\t' -v date="$DATE" -v version="$VERSION" -v scale="$2" -v name="$CASE" -v bytes="$BYTES" -v results="$RESULTS" '{
+		tps = ($4 > 0) ? $2 / $4 : 0;
+		nps = ($5 > 0) ? $3 / $5 : 0;
+		printf "%-14s %10d %10d %10.2f %10.2f %10.2f %12.0f %12.0f\n", name, $2, $3, $4 * 1000, $5 * 1000, $6 * 1000, tps, nps;
+		printf "%s\t%s\t%s\t%s\t%s\t%d\t%d\t%.6f\t%.6f\t%.6f\t%.0f\t%.0f\t%d\n", date, version, scale, name, bytes, $2, $3, $4, $5, $6, tps, nps, $7 >> results;
+	}'
+done
+echo --------------------------------
+echo Results appended to $RESULTS.
+exit 0
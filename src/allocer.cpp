@@ -0,0 +1,435 @@
+#include "allocer.h"
+
+#include "outputOperators.h"
+
+// allocer-global variables
+
+// allocation orders of the register classes; caller-saved registers come first so that short intervals leave the callee-saved ones (which must be preserved in the prologue) to values living across calls
+int intRegOrder[] = {REG_RAX, REG_RCX, REG_RDX, REG_RSI, REG_RDI, REG_R8, REG_R9, REG_R10, REG_R11, REG_RBX, REG_R12, REG_R13, REG_R14, REG_R15};
+int floatRegOrder[] = {REG_XMM0, REG_XMM0+1, REG_XMM0+2, REG_XMM0+3, REG_XMM0+4, REG_XMM0+5, REG_XMM0+6, REG_XMM0+7,
+	REG_XMM0+8, REG_XMM0+9, REG_XMM0+10, REG_XMM0+11, REG_XMM0+12, REG_XMM0+13, REG_XMM0+14, REG_XMM0+15};
+#define NUM_INT_REGS (sizeof(intRegOrder)/sizeof(intRegOrder[0]))
+#define NUM_FLOAT_REGS (sizeof(floatRegOrder)/sizeof(floatRegOrder[0]))
+
+// the registers that the System V x86-64 calling convention lets a callee clobber
+int callerSavedRegs[] = {REG_RAX, REG_RCX, REG_RDX, REG_RSI, REG_RDI, REG_R8, REG_R9, REG_R10, REG_R11};
+#define NUM_CALLER_SAVED_INT_REGS (sizeof(callerSavedRegs)/sizeof(callerSavedRegs[0]))
+
+const char *regNames[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+	"xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "xmm10", "xmm11", "xmm12", "xmm13", "xmm14", "xmm15"};
+
+// register helper functions
+
+string regToString(int reg) {
+	if (reg == NULL_REG) {
+		return "-";
+	}
+	return regNames[reg];
+}
+
+bool isCalleeSaved(int reg) {
+	return (reg == REG_RBX || reg == REG_RBP || (reg >= REG_R12 && reg <= REG_R15));
+}
+
+// returns whether the given operator kind computes a float
+bool isFloatResult(int kind) {
+	switch (kind) {
+		case BINOP_TIMES_FLOAT:
+		case BINOP_DIVIDE_FLOAT:
+		case BINOP_MOD_FLOAT:
+		case UNOP_MINUS_FLOAT:
+		case BINOP_PLUS_FLOAT:
+		case BINOP_MINUS_FLOAT:
+		case CONVOP_INT2FLOAT:
+			return true;
+		default:
+			return false;
+	}
+}
+
+// returns whether the given operator kind is implemented as a call into the runtime
+bool isRuntimeCall(int kind) {
+	switch (kind) {
+		case BINOP_MOD_FLOAT:
+		case BINOP_PLUS_STRING:
+		case UNOP_HASH_STRING:
+		case CONVOP_BOOL2STRING:
+		case CONVOP_INT2STRING:
+		case CONVOP_FLOAT2STRING:
+		case CONVOP_CHAR2STRING:
+		case CATOP_STRING:
+			return true;
+		default:
+			return false;
+	}
+}
+
+// VirtualReg functions
+VirtualReg::VirtualReg(IRId node, int regClass) : node(node), regClass(regClass), spillSlot(-1) {}
+VirtualReg::~VirtualReg() {}
+
+// LiveInterval functions
+LiveInterval::LiveInterval(unsigned int value, unsigned int start) : value(value), start(start), end(start), reg(NULL_REG) {}
+LiveInterval::~LiveInterval() {}
+unsigned int LiveInterval::nextUse(unsigned int position) const {
+	vector<unsigned int>::const_iterator useFind = lower_bound(uses.begin(), uses.end(), position);
+	return (useFind != uses.end()) ? *useFind : NULL_POSITION;
+}
+
+// RegAlloc functions
+RegAlloc::RegAlloc(const IRModule &module, IRId label) : module(module), label(label), clobbers(NUM_REGS), position(0), numSpillSlots(0), numSplits(0), usedRegs(0) {
+	linearizeCode(module.operand(label, 0));
+}
+RegAlloc::~RegAlloc() {}
+
+// linearization functions
+
+// creates a virtual register holding the result of the instruction at the current position
+unsigned int RegAlloc::addValue(IRId node, int regClass) {
+	values.push_back(VirtualReg(node, regClass));
+	unsigned int value = values.size() - 1;
+	intervals.push_back(LiveInterval(value, position+1));
+	intervals.back().uses.push_back(position+1);
+	values[value].intervals.push_back(intervals.size() - 1);
+	valueMap.insert(make_pair(node, value));
+	return value;
+}
+void RegAlloc::addUse(unsigned int value, unsigned int position) {
+	if (value == NULL_VALUE) {
+		return;
+	}
+	LiveInterval &interval = intervals[values[value].intervals[0]];
+	interval.uses.push_back(position);
+	interval.end = position;
+}
+void RegAlloc::clobber(int reg, unsigned int position) {
+	clobbers[reg].push_back(position);
+}
+// blocks all of the caller-saved registers across the instruction at the given position
+void RegAlloc::clobberCall(unsigned int position) {
+	for (unsigned int i = 0; i < NUM_CALLER_SAVED_INT_REGS; i++) {
+		clobber(callerSavedRegs[i], position+1);
+	}
+	for (unsigned int i = 0; i < NUM_FLOAT_REGS; i++) { // every xmm register is caller-saved
+		clobber(floatRegOrder[i], position+1);
+	}
+}
+
+// numbers the instructions that compute the given data node, returning the virtual register that holds its result, or NULL_VALUE if it's an immediate
+unsigned int RegAlloc::linearizeData(IRId id) {
+	if (id == NULL_IR_ID) {
+		return NULL_VALUE;
+	}
+	map<IRId, unsigned int>::const_iterator valueFind = valueMap.find(id);
+	if (valueFind != valueMap.end()) { // the node is shared, so its result is already available
+		return (*valueFind).second;
+	}
+	vector<unsigned int> operandValues;
+	switch (module.categories[id]) {
+		case CATEGORY_LIST: // the compound (or the view's pointer and extent) is built on the stack, and its address is the result
+		case CATEGORY_SLICE: {
+			for (unsigned int i = 0; i < module.operandCounts[id]; i++) {
+				operandValues.push_back(linearizeData(module.operand(id, i)));
+			}
+			position += 2;
+			for (unsigned int i = 0; i < operandValues.size(); i++) {
+				addUse(operandValues[i], position);
+			}
+			return addValue(id, REG_CLASS_INT);
+		}
+		case CATEGORY_TEMP: {
+			IRId opNode = module.operand(id, 0);
+			int kind = module.kinds[opNode];
+			for (unsigned int i = 0; i < module.operandCounts[opNode]; i++) {
+				operandValues.push_back(linearizeData(module.operand(opNode, i)));
+			}
+			position += 2;
+			for (unsigned int i = 0; i < operandValues.size(); i++) {
+				addUse(operandValues[i], position);
+			}
+			if (isRuntimeCall(kind)) {
+				clobberCall(position);
+			} else if (kind == BINOP_DIVIDE_INT || kind == BINOP_MOD_INT) { // idiv uses rdx:rax
+				clobber(REG_RAX, position+1);
+				clobber(REG_RDX, position+1);
+			} else if (kind == BINOP_LS_INT || kind == BINOP_RS_INT) { // variable shift counts live in cl
+				clobber(REG_RCX, position+1);
+			}
+			return addValue(id, isFloatResult(kind) ? REG_CLASS_FLOAT : REG_CLASS_INT);
+		}
+		case CATEGORY_READ: {
+			unsigned int address = linearizeData(module.operand(id, 0));
+			position += 2;
+			addUse(address, position);
+			return addValue(id, (module.kinds[id] == READ_FLOAT) ? REG_CLASS_FLOAT : REG_CLASS_INT); // the semmer tags reads with the type of the value they read
+		}
+		default: // words and arrays are immediates
+			return NULL_VALUE;
+	}
+}
+
+// numbers the instructions of the given code node in execution order; the branches of a conditional are laid out one after the other
+void RegAlloc::linearizeCode(IRId id) {
+	if (id == NULL_IR_ID) {
+		return;
+	}
+	switch (module.categories[id]) {
+		case CATEGORY_SEQ:
+			for (unsigned int i = 0; i < module.operandCounts[id]; i++) {
+				linearizeCode(module.operand(id, i));
+			}
+			break;
+		case CATEGORY_LOCK:
+		case CATEGORY_UNLOCK: {
+			unsigned int address = linearizeData(module.operand(id, 0));
+			position += 2;
+			addUse(address, position);
+			clobberCall(position);
+			break;
+		}
+		case CATEGORY_COND: {
+			unsigned int test = linearizeData(module.operand(id, 0));
+			position += 2;
+			addUse(test, position);
+			linearizeCode(module.operand(id, 1));
+			linearizeCode(module.operand(id, 2));
+			break;
+		}
+		case CATEGORY_JUMP: {
+			unsigned int test = linearizeData(module.operand(id, 0));
+			position += 2;
+			addUse(test, position);
+			for (unsigned int i = 1; i < module.operandCounts[id]; i++) {
+				linearizeCode(module.operand(id, i));
+			}
+			break;
+		}
+		case CATEGORY_WRITE:
+		case CATEGORY_COPY: {
+			unsigned int source = linearizeData(module.operand(id, 0));
+			unsigned int address = linearizeData(module.operand(id, 1));
+			position += 2;
+			addUse(source, position);
+			addUse(address, position);
+			if (module.categories[id] == CATEGORY_COPY) { // block copies are done with memcpy
+				clobberCall(position);
+			}
+			break;
+		}
+		case CATEGORY_SCHED:
+			position += 2;
+			clobberCall(position);
+			break;
+		case CATEGORY_LOOP: {
+			unsigned int loopStart = position + 1;
+			unsigned int numOuterValues = values.size();
+			unsigned int test = linearizeData(module.operand(id, 0));
+			position += 2;
+			addUse(test, position);
+			linearizeCode(module.operand(id, 1));
+			position += 2; // the back-edge
+			// values defined before the loop and used inside it must survive the back-edge, so they're kept live to the end of the loop
+			for (unsigned int i = 0; i < numOuterValues; i++) {
+				if (intervals[values[i].intervals[0]].end >= loopStart) {
+					addUse(i, position);
+				}
+			}
+			break;
+		}
+		case CATEGORY_RANGE:
+		case CATEGORY_BATCH: {
+			unsigned int source = linearizeData(module.operand(id, 0)); // the count of a range, or the stream of a batch
+			position += 2;
+			addUse(source, position);
+			if (module.categories[id] == CATEGORY_BATCH || module.auxes[id]) { // a parallel range or a batch hands its body to the runtime as a function of its own
+				clobberCall(position);
+			}
+			unsigned int rangeStart = position + 1;
+			unsigned int numOuterValues = values.size();
+			unsigned int address = linearizeData(module.operand(id, 1));
+			position += 2; // the index (or element) write
+			addUse(address, position);
+			linearizeCode(module.operand(id, 2));
+			position += 2; // the back-edge
+			// as with loops, values defined before the range and used inside it must survive the back-edge
+			for (unsigned int i = 0; i < numOuterValues; i++) {
+				if (intervals[values[i].intervals[0]].end >= rangeStart) {
+					addUse(i, position);
+				}
+			}
+			break;
+		}
+		default: // CATEGORY_NOP; no instructions
+			break;
+	}
+}
+
+// allocation functions
+
+// returns the first position after start at which the given register is no longer free, or NULL_POSITION if it stays free
+unsigned int RegAlloc::freeUntil(int reg, unsigned int start, const vector<unsigned int> &active) const {
+	for (vector<unsigned int>::const_iterator iter = active.begin(); iter != active.end(); iter++) {
+		if (intervals[*iter].reg == reg) {
+			return 0;
+		}
+	}
+	vector<unsigned int>::const_iterator clobberFind = upper_bound(clobbers[reg].begin(), clobbers[reg].end(), start);
+	return (clobberFind != clobbers[reg].end()) ? *clobberFind : NULL_POSITION;
+}
+
+// moves the uses of the given interval at or after position into a new child interval, which starts with a reload from the value's spill slot;
+// returns the index of the child, or NULL_VALUE if there were no such uses
+unsigned int RegAlloc::splitInterval(unsigned int interval, unsigned int position) {
+	vector<unsigned int> &uses = intervals[interval].uses;
+	vector<unsigned int>::iterator splitPoint = lower_bound(uses.begin(), uses.end(), position);
+	if (splitPoint == uses.end()) {
+		return NULL_VALUE;
+	}
+	unsigned int value = intervals[interval].value;
+	LiveInterval child(value, *splitPoint);
+	child.uses.assign(splitPoint, uses.end());
+	child.end = child.uses.back();
+	uses.erase(splitPoint, uses.end());
+	intervals[interval].end = uses.back();
+	// the value is stored to its spill slot right after its definition, so every later part can be reloaded from there
+	if (values[value].spillSlot == -1) {
+		values[value].spillSlot = numSpillSlots++;
+	}
+	intervals.push_back(child);
+	unsigned int childIndex = intervals.size() - 1;
+	vector<unsigned int> &valueIntervals = values[value].intervals;
+	valueIntervals.insert(find(valueIntervals.begin(), valueIntervals.end(), interval) + 1, childIndex);
+	numSplits++;
+	return childIndex;
+}
+
+// assigns a physical register to every live interval, in order of increasing start position; intervals that can't keep a register for their whole lifetime are split
+void RegAlloc::allocate() {
+	multimap<unsigned int, unsigned int> unhandled;
+	for (unsigned int i = 0; i < intervals.size(); i++) {
+		unhandled.insert(make_pair(intervals[i].start, i));
+	}
+	vector<unsigned int> active;
+	while (!unhandled.empty()) {
+		unsigned int cur = (*(unhandled.begin())).second;
+		unhandled.erase(unhandled.begin());
+		unsigned int start = intervals[cur].start;
+		// expire the intervals that have ended
+		for (unsigned int i = 0; i < active.size(); ) {
+			if (intervals[active[i]].end < start) {
+				active.erase(active.begin() + i);
+			} else {
+				i++;
+			}
+		}
+		int *regOrder = (values[intervals[cur].value].regClass == REG_CLASS_FLOAT) ? floatRegOrder : intRegOrder;
+		unsigned int numRegs = (values[intervals[cur].value].regClass == REG_CLASS_FLOAT) ? NUM_FLOAT_REGS : NUM_INT_REGS;
+		// first, try to find a register that's free for the whole interval, or failing that, for as long as possible
+		int bestReg = NULL_REG;
+		unsigned int bestUntil = 0;
+		for (unsigned int i = 0; i < numRegs; i++) {
+			unsigned int until = freeUntil(regOrder[i], start, active);
+			if (until > intervals[cur].end) {
+				bestReg = regOrder[i];
+				bestUntil = until;
+				break;
+			} else if (until > bestUntil) {
+				bestReg = regOrder[i];
+				bestUntil = until;
+			}
+		}
+		// if every register is occupied, evict the occupant whose next use is furthest away
+		if (bestUntil <= start) {
+			unsigned int bestUse = 0;
+			for (unsigned int i = 0; i < numRegs; i++) {
+				unsigned int nextUse = NULL_POSITION;
+				for (vector<unsigned int>::const_iterator iter = active.begin(); iter != active.end(); iter++) {
+					if (intervals[*iter].reg == regOrder[i]) {
+						nextUse = min(nextUse, intervals[*iter].nextUse(start));
+					}
+				}
+				if (nextUse > bestUse) {
+					bestReg = regOrder[i];
+					bestUse = nextUse;
+				}
+			}
+			for (unsigned int i = 0; i < active.size(); ) {
+				if (intervals[active[i]].reg == bestReg) {
+					unsigned int child = splitInterval(active[i], start);
+					if (child != NULL_VALUE) {
+						unhandled.insert(make_pair(intervals[child].start, child));
+					}
+					active.erase(active.begin() + i);
+				} else {
+					i++;
+				}
+			}
+			bestUntil = freeUntil(bestReg, start, active);
+		}
+		// assign the register, splitting off the part of the interval that outlives it
+		intervals[cur].reg = bestReg;
+		usedRegs |= ((uint32_t)1 << bestReg);
+		if (bestUntil <= intervals[cur].end) {
+			unsigned int child = splitInterval(cur, bestUntil);
+			if (child != NULL_VALUE) {
+				unhandled.insert(make_pair(intervals[child].start, child));
+			}
+		}
+		active.push_back(cur);
+	}
+}
+
+// returns the physical register holding the result of the given node at the given position, or NULL_REG if it's in its spill slot (or not live)
+int RegAlloc::location(IRId node, unsigned int position) const {
+	map<IRId, unsigned int>::const_iterator valueFind = valueMap.find(node);
+	if (valueFind == valueMap.end()) {
+		return NULL_REG;
+	}
+	const vector<unsigned int> &valueIntervals = values[(*valueFind).second].intervals;
+	for (vector<unsigned int>::const_iterator iter = valueIntervals.begin(); iter != valueIntervals.end(); iter++) {
+		if (intervals[*iter].start <= position && position <= intervals[*iter].end) {
+			return intervals[*iter].reg;
+		}
+	}
+	return NULL_REG;
+}
+
+// returns the number of callee-saved registers that the label's prologue must preserve
+unsigned int RegAlloc::calleeSavedUsed() const {
+	unsigned int acc = 0;
+	for (int reg = 0; reg < NUM_REGS; reg++) {
+		if ((usedRegs & ((uint32_t)1 << reg)) && isCalleeSaved(reg)) {
+			acc++;
+		}
+	}
+	return acc;
+}
+
+string RegAlloc::toString() const {
+	string acc(module.labelIds[module.auxes[label]]);
+	acc += ":";
+	char tempS[MAX_INT_STRING_LENGTH*2+4];
+	if (numSplits > 0 || numSpillSlots > 0) { // if the label ran out of registers, say by how much
+		sprintf(tempS, " %u splits,", numSplits);
+		acc += tempS;
+		sprintf(tempS, " %u spill slots", numSpillSlots);
+		acc += tempS;
+	}
+	acc += '\n';
+	for (unsigned int i = 0; i < values.size(); i++) {
+		sprintf(tempS, "\tv%u", i);
+		acc += tempS;
+		acc += (values[i].regClass == REG_CLASS_FLOAT) ? " (float):" : " (int):";
+		for (vector<unsigned int>::const_iterator iter = values[i].intervals.begin(); iter != values[i].intervals.end(); iter++) {
+			sprintf(tempS, " [%u,%u]", intervals[*iter].start, intervals[*iter].end);
+			acc += tempS;
+			acc += regToString(intervals[*iter].reg);
+		}
+		if (values[i].spillSlot != -1) {
+			sprintf(tempS, " slot%d", values[i].spillSlot);
+			acc += tempS;
+		}
+		acc += '\n';
+	}
+	return acc;
+}
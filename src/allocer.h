@@ -0,0 +1,108 @@
+#ifndef _ALLOCER_H_
+#define _ALLOCER_H_
+
+#include "globalDefs.h"
+#include "constantDefs.h"
+#include "driver.h"
+
+#include "genner.h"
+
+// register class specifiers
+#define REG_CLASS_INT 0
+#define REG_CLASS_FLOAT 1
+
+// x86-64 physical register numbers
+#define REG_RAX 0
+#define REG_RCX 1
+#define REG_RDX 2
+#define REG_RBX 3
+#define REG_RSP 4
+#define REG_RBP 5
+#define REG_RSI 6
+#define REG_RDI 7
+#define REG_R8 8
+#define REG_R9 9
+#define REG_R10 10
+#define REG_R11 11
+#define REG_R12 12
+#define REG_R13 13
+#define REG_R14 14
+#define REG_R15 15
+#define REG_XMM0 16
+#define NUM_REGS 32
+
+#define NULL_REG (-1)
+#define NULL_VALUE 0xFFFFFFFF
+#define NULL_POSITION 0xFFFFFFFF
+
+// RegAlloc classes
+
+// usage: a virtual register; holds the result of a single data node of a label
+class VirtualReg {
+	public:
+		// data members
+		IRId node; // the data node whose result this virtual register holds
+		int regClass; // the register class that this value must be allocated from (REG_CLASS_ defines above)
+		int spillSlot; // the stack slot that this value is spilled to when split, or -1 if it's never spilled
+		vector<unsigned int> intervals; // indices of the live intervals of this value, in position order
+		// allocators/deallocators
+		VirtualReg(IRId node, int regClass);
+		~VirtualReg();
+};
+
+// usage: a contiguous range of positions during which a value lives in a single physical register
+class LiveInterval {
+	public:
+		// data members
+		unsigned int value; // index of the VirtualReg that this interval belongs to
+		unsigned int start; // the position of the definition or reload that begins this interval
+		unsigned int end; // the position of the last use covered by this interval
+		vector<unsigned int> uses; // the positions at which the value must be in a register, in increasing order
+		int reg; // the physical register assigned to this interval, or NULL_REG if unassigned
+		// allocators/deallocators
+		LiveInterval(unsigned int value, unsigned int start);
+		~LiveInterval();
+		// core methods
+		unsigned int nextUse(unsigned int position) const;
+};
+
+// usage: a linear-scan register allocation of a single LABEL node of an IRModule
+// instructions are numbered 2, 4, 6... in the linear order of the label's code; operands are read at the instruction's position, the result is written at position+1,
+// and registers clobbered by the instruction (calls, divisions, shifts) are blocked at position+1, so only values living across the instruction are kept out of them
+class RegAlloc {
+	public:
+		// data members
+		const IRModule &module; // the module that holds the label's code
+		IRId label; // the label being allocated
+		vector<VirtualReg> values; // all of the virtual registers of the label, in definition order
+		vector<LiveInterval> intervals; // the live intervals of all virtual registers, including split children
+		map<IRId, unsigned int> valueMap; // maps data nodes to the virtual registers that hold their results
+		vector<vector<unsigned int> > clobbers; // the positions at which each physical register is clobbered, in increasing order
+		unsigned int position; // the position of the last instruction numbered
+		unsigned int numSpillSlots; // the number of stack slots needed for spilled values
+		unsigned int numSplits; // the number of times an interval was split
+		uint32_t usedRegs; // bitmask of the physical registers that were assigned to some interval
+		// allocators/deallocators
+		RegAlloc(const IRModule &module, IRId label);
+		~RegAlloc();
+		// core methods
+		void allocate();
+		int location(IRId node, unsigned int position) const;
+		unsigned int calleeSavedUsed() const;
+		string toString() const;
+		// linearization methods
+		unsigned int addValue(IRId node, int regClass);
+		void addUse(unsigned int value, unsigned int position);
+		void clobber(int reg, unsigned int position);
+		void clobberCall(unsigned int position);
+		unsigned int linearizeData(IRId id);
+		void linearizeCode(IRId id);
+		// allocation methods
+		unsigned int freeUntil(int reg, unsigned int start, const vector<unsigned int> &active) const;
+		unsigned int splitInterval(unsigned int interval, unsigned int position);
+};
+
+string regToString(int reg);
+bool isCalleeSaved(int reg);
+
+#endif
@@ -0,0 +1,268 @@
+#include "cacher.h"
+
+#include <new>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+// the parse cache (-i) keeps the parse tree of every successfully parsed source file in the cache directory,
+// in a file named after a hash of the file's contents, the compiler's version stamp, and the tab modulus (which the token columns depend on);
+// a later run over the same source loads the tree back instead of lexing and parsing it again
+//
+// a cache file holds the magic string, the version stamp, the source's check (its length and CRC-32, which is independent of the FNV-1a hash in the
+// file name, so a collision of the name alone can't load another source's tree), the number of tokens the source lexed to, the number of tree nodes,
+// and then the nodes in preorder, each as its flags, token type, row and column (unless they repeat the previous node's), and string;
+// all numbers are unsigned LEB128 varints, and a string is its length followed by its characters
+
+string readSource(istream *in) {
+	string acc;
+	// if the stream knows its length, size the buffer for all of it up front
+	std::streampos begin = in->tellg();
+	if (begin != std::streampos(-1)) {
+		if (in->seekg(0, std::ios::end)) {
+			std::streampos end = in->tellg();
+			if (end != std::streampos(-1) && end > begin) {
+				acc.reserve((size_t)(end - begin));
+			}
+		}
+		in->clear();
+		in->seekg(begin);
+	}
+	char buf[MAX_STRING_LENGTH * 16];
+	while (in->read(buf, sizeof(buf)) || in->gcount() > 0) {
+		acc.append(buf, in->gcount());
+	}
+	return acc;
+}
+
+string getParseCacheKey(const string &source) {
+	uint64_t hash = FNV_OFFSET_BASIS;
+	string stamp(VERSION_STAMP);
+	hash = hashBytes(hash, (const uint8_t *)stamp.c_str(), stamp.size() + 1);
+	hash = hashBytes(hash, (const uint8_t *)&tabModulus, sizeof(tabModulus));
+	hash = hashBytes(hash, (const uint8_t *)source.data(), source.size());
+	char tempS[MAX_INT_STRING_LENGTH];
+	sprintf(tempS, "%016" PRIx64, hash);
+	return tempS;
+}
+
+// returns the CRC-32 of the given bytes
+uint32_t crc32Bytes(const uint8_t *bytes, size_t length) {
+	static uint32_t table[256];
+	static bool tableBuilt = false;
+	if (!tableBuilt) {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t c = i;
+			for (unsigned int bit = 0; bit < 8; bit++) {
+				c = (c & 1) ? ((c >> 1) ^ PARSE_CACHE_CRC_POLYNOMIAL) : (c >> 1);
+			}
+			table[i] = c;
+		}
+		tableBuilt = true;
+	}
+	uint32_t crc = 0xFFFFFFFF;
+	for (size_t i = 0; i < length; i++) {
+		crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+	}
+	return (crc ^ 0xFFFFFFFF);
+}
+
+string getParseCacheFileName(const string &key) {
+	return (parseCacheDir + "/" + key + PARSE_CACHE_FILE_SUFFIX);
+}
+
+// serialization
+
+void writeCacheInt(string &buf, unsigned int x) {
+	while (x >= 0x80) {
+		buf += (char)((x & 0x7F) | 0x80);
+		x >>= 7;
+	}
+	buf += (char)x;
+}
+
+void writeCacheString(string &buf, const string &s) {
+	writeCacheInt(buf, s.size());
+	buf += s;
+}
+
+string getParseCacheCheck(const string &source) {
+	string acc;
+	writeCacheInt(acc, source.size());
+	writeCacheInt(acc, crc32Bytes((const uint8_t *)source.data(), source.size()));
+	return acc;
+}
+
+// writes the sibling list starting at tree, and all of its descendants
+// prev is the node written last; a nonterminal usually shares its position with its first child, which follows it
+void writeCacheTree(string &buf, const Tree *tree, const Tree *parent, const Tree *&prev, unsigned long &numNodes) {
+	for (const Tree *cur = tree; cur != NULL; cur = cur->next) {
+		unsigned int flags = 0;
+		if (cur->child != NULL) {
+			flags |= CACHE_NODE_CHILD;
+		}
+		if (cur->next != NULL) {
+			flags |= CACHE_NODE_NEXT;
+		}
+		if (cur->parent != NULL && cur->parent == parent) {
+			flags |= CACHE_NODE_PARENT;
+		}
+		if (cur->back != NULL && cur != tree) {
+			flags |= CACHE_NODE_BACK;
+		}
+		bool samePos = (prev != NULL && cur->t.row == prev->t.row && cur->t.col == prev->t.col);
+		if (samePos) {
+			flags |= CACHE_NODE_SAME_POS;
+		}
+		writeCacheInt(buf, flags);
+		writeCacheInt(buf, cur->t.tokenType);
+		if (!samePos) {
+			writeCacheInt(buf, cur->t.row);
+			writeCacheInt(buf, cur->t.col);
+		}
+		writeCacheString(buf, cur->t.s);
+		prev = cur;
+		numNodes++;
+		if (cur->child != NULL) {
+			writeCacheTree(buf, cur->child, cur, prev, numNodes);
+		}
+	}
+}
+
+// deserialization; the readers return false if the cache file is truncated or corrupt
+
+bool readCacheInt(const string &buf, size_t &pos, unsigned int &x) {
+	x = 0;
+	for (unsigned int shift = 0; shift < 32; shift += 7) {
+		if (pos >= buf.size()) {
+			return false;
+		}
+		unsigned char c = buf[pos++];
+		x |= (unsigned int)(c & 0x7F) << shift;
+		if (!(c & 0x80)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool readCacheString(const string &buf, size_t &pos, string &s) {
+	unsigned int length;
+	if (!readCacheInt(buf, pos, length) || length > buf.size() - pos) {
+		return false;
+	}
+	s.assign(buf, pos, length);
+	pos += length;
+	return true;
+}
+
+// reads a sibling list and all of its descendants into the nodes of the given block, starting at slab, which is left past the last node read; returns NULL on failure
+// row and col hold the position of the node read last
+Tree *readCacheTree(const string &buf, size_t &pos, Tree *parent, unsigned int fileIndex, unsigned int &row, unsigned int &col, Tree *&slab, Tree *slabEnd) {
+	Tree *first = NULL;
+	Tree *prev = NULL;
+	for(;;) {
+		unsigned int flags, tokenType;
+		if (slab == slabEnd || !readCacheInt(buf, pos, flags) || !readCacheInt(buf, pos, tokenType) ||
+				(!(flags & CACHE_NODE_SAME_POS) && (!readCacheInt(buf, pos, row) || !readCacheInt(buf, pos, col)))) {
+			return NULL;
+		}
+		Tree *cur = new (slab++) Tree(Token(tokenType), NULL, (flags & CACHE_NODE_BACK) ? prev : NULL, NULL, (flags & CACHE_NODE_PARENT) ? parent : NULL);
+		cur->t.fileIndex = fileIndex;
+		cur->t.row = row;
+		cur->t.col = col;
+		// link in the new node
+		if (prev != NULL) {
+			*prev += cur;
+		} else {
+			first = cur;
+		}
+		prev = cur;
+		if (!readCacheString(buf, pos, cur->t.s)) {
+			return NULL;
+		}
+		if (flags & CACHE_NODE_CHILD) {
+			Tree *child = readCacheTree(buf, pos, cur, fileIndex, row, col, slab, slabEnd);
+			if (child == NULL) {
+				return NULL;
+			}
+			*cur *= child;
+		}
+		if (!(flags & CACHE_NODE_NEXT)) {
+			return first;
+		}
+	}
+}
+
+// frees a block of nodes that failed to load, up to (but not including) slabEnd; the nodes are unlinked first, since a Tree deletes its next and child
+void freeCacheTree(Tree *slab, Tree *slabEnd) {
+	for (Tree *cur = slab; cur != slabEnd; cur++) {
+		cur->next = NULL;
+		cur->child = NULL;
+		cur->~Tree();
+	}
+	operator delete(slab);
+}
+
+// core cache functions
+
+Tree *loadParseCache(const string &key, const string &check, unsigned int fileIndex, unsigned long &numTokens) {
+	ifstream in(getParseCacheFileName(key).c_str(), std::ios::in | std::ios::binary);
+	if (!in.good()) { // if there's no cache file for this source, this is a cache miss
+		return NULL;
+	}
+	string buf = readSource(&in);
+	// verify the header
+	size_t pos = PARSE_CACHE_MAGIC_LENGTH;
+	string stamp, fileCheck;
+	unsigned int tokens, nodes;
+	if (buf.compare(0, PARSE_CACHE_MAGIC_LENGTH, PARSE_CACHE_MAGIC) != 0 || !readCacheString(buf, pos, stamp) || stamp != VERSION_STAMP ||
+			!readCacheString(buf, pos, fileCheck) || fileCheck != check || !readCacheInt(buf, pos, tokens) || !readCacheInt(buf, pos, nodes)) {
+		return NULL;
+	}
+	// every node takes up at least three bytes (its flags, its token type, and its string's length), which bounds the node count of an intact file
+	if (nodes == 0 || nodes > (buf.size() - pos) / 3) {
+		return NULL;
+	}
+	// rebuild the tree, which must account for exactly the rest of the file; the nodes are allocated in a single block, which is never freed unless loading fails,
+	// since parse trees live for the rest of the compilation
+	Tree *slab = (Tree *)operator new(sizeof(Tree) * nodes);
+	Tree *slabCur = slab;
+	Tree *slabEnd = slab + nodes;
+	unsigned int row = 0, col = 0;
+	Tree *parseme = readCacheTree(buf, pos, NULL, fileIndex, row, col, slabCur, slabEnd);
+	if (parseme == NULL || slabCur != slabEnd || pos != buf.size()) {
+		freeCacheTree(slab, slabCur);
+		return NULL;
+	}
+	numTokens = tokens;
+	return parseme;
+}
+
+void storeParseCache(const string &key, const string &check, const Tree *parseme, unsigned long numTokens) {
+	// serialize the tree first, since the header needs its node count
+	string body;
+	unsigned long numNodes = 0;
+	const Tree *prev = NULL;
+	writeCacheTree(body, parseme, NULL, prev, numNodes);
+	string buf(PARSE_CACHE_MAGIC);
+	writeCacheString(buf, VERSION_STAMP);
+	writeCacheString(buf, check);
+	writeCacheInt(buf, numTokens);
+	writeCacheInt(buf, numNodes);
+	buf += body;
+	// write to a temporary file and rename it into place, so that concurrent compilations never see a partial cache file
+	mkdir(parseCacheDir.c_str(), 0777);
+	string fileName = getParseCacheFileName(key);
+	char tempS[MAX_INT_STRING_LENGTH];
+	sprintf(tempS, ".%d", (int)getpid());
+	string tempFileName = fileName + tempS;
+	ofstream out(tempFileName.c_str(), std::ios::out | std::ios::binary);
+	if (!out.good()) { // if we can't write to the cache, just go on without it
+		return;
+	}
+	out.write(buf.data(), buf.size());
+	out.close();
+	if (out.fail() || rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+		remove(tempFileName.c_str());
+	}
+}
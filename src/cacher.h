@@ -0,0 +1,30 @@
+#ifndef _CACHER_H_
+#define _CACHER_H_
+
+#include "globalDefs.h"
+#include "constantDefs.h"
+#include "driver.h"
+
+#include "lexer.h"
+#include "parser.h"
+
+// parse cache file layout
+#define PARSE_CACHE_MAGIC "ANPC"
+#define PARSE_CACHE_MAGIC_LENGTH 4
+#define PARSE_CACHE_FILE_SUFFIX ".apc"
+#define PARSE_CACHE_CRC_POLYNOMIAL 0xEDB88320 /* the reflected CRC-32 polynomial, as in zlib */
+
+// parse cache node flags
+#define CACHE_NODE_CHILD 0x1 // the node has a child list, which follows it
+#define CACHE_NODE_NEXT 0x2 // the node has a next sibling, which follows its child list
+#define CACHE_NODE_PARENT 0x4 // the node links up to its parent
+#define CACHE_NODE_BACK 0x8 // the node links back to its previous sibling
+#define CACHE_NODE_SAME_POS 0x10 // the node has the same row and column as the node before it, which are left out
+
+string readSource(istream *in);
+string getParseCacheKey(const string &source);
+string getParseCacheCheck(const string &source);
+Tree *loadParseCache(const string &key, const string &check, unsigned int fileIndex, unsigned long &numTokens);
+void storeParseCache(const string &key, const string &check, const Tree *parseme, unsigned long numTokens);
+
+#endif
@@ -6,22 +6,75 @@
 #define SILENT_MODE_DEFAULT false
 #define CODED_OUTPUT_DEFAULT false
 #define EVENTUALLY_GIVE_UP_DEFAULT true
+#define PARSER_PROFILE_DEFAULT false
+#define BENCHMARK_MODE_DEFAULT false
+#define PARSE_CACHE_DIR_DEFAULT "" /* no parse cache */
 
 #define MIN_OPTIMIZATION_LEVEL 0
 #define MAX_OPTIMIZATION_LEVEL 3
 #define DEFAULT_OPTIMIZATION_LEVEL 1
 
+#define OPTIMIZATION_LEVEL_FOLD 1
+#define OPTIMIZATION_LEVEL_REDUCE 2
+#define OPTIMIZATION_LEVEL_FIXPOINT 3
+#define MAX_OPTIMIZATION_PASSES 16
+
+#define INLINE_BUDGET_FOLD 16
+#define INLINE_BUDGET_REDUCE 64
+#define INLINE_BUDGET_FIXPOINT 256
+
+#define MIN_SWITCH_DISPATCH_CASES 4
+#define MIN_JUMP_TABLE_DENSITY 40
+#define MAX_JUMP_TABLE_SIZE 1024
+#define MIN_HASH_DISPATCH_CASES 8
+
 #define MIN_TAB_MODULUS 1
 #define MAX_TAB_MODULUS 80
 #define TAB_MODULUS_DEFAULT 4
 
 #define TOLERABLE_ERROR_LIMIT 256
 
+#define PARSER_PROFILE_HOT_RULES 10
+
 #define MAX_STRING_LENGTH (sizeof(char)*4096)
 #define MAX_INT_STRING_LENGTH 21
+#define MAX_FLOAT_STRING_LENGTH 32
+#define FLOAT_STRING_FORMAT "%g"
+
+#define CAT_FORMAT_STRING 0
+#define CAT_FORMAT_BOOL 1
+#define CAT_FORMAT_INT 2
+#define CAT_FORMAT_FLOAT 3
+#define CAT_FORMAT_CHAR 4
+
+#define ACCESS_READS_LATCHES 0x1
+#define ACCESS_WRITES_LATCHES 0x2
+#define ACCESS_WRITES_OUTPUT 0x4
+
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
 
 #define STD_IN_FILE_NAME "<stdin>"
 
+#define RT_OUT_CHUNK_SIZE (64*1024)
+#define RT_OUT_BATCH_SIZE (1024*1024)
+#define RT_IN_BUFFER_SIZE (64*1024)
+#define RT_IN_TOKEN_LENGTH 128
+#define RT_TIMER_TICK_NS 100000
+#define RT_TIMER_SLOT_BITS 8
+#define RT_TIMER_LEVELS 5
+#define RT_RANGE_MIN_CHUNK 16384
+#define RT_RANGE_CHUNKS_PER_WORKER 4
+#define RT_BATCH_SIZE 65536
+#define RT_BATCH_MIN_CHUNK 256
+#define RT_SLAB_MIN_SIZE 16
+#define RT_SLAB_CLASSES 9
+#define RT_SLAB_SIZE (256*1024)
+#define RT_SLAB_BATCH 32
+#define RT_POOL_REGION_SIZE (256*1024)
+#define RT_POOL_ALIGN 16
+#define RT_POOL_SPARE_REGIONS 4
+
 #define MAX_TOKEN_LENGTH 1024*128
 #define ESCAPE_CHARACTER '\\'
 #define TOKEN_RAW_VECTOR INT_MAX
@@ -37,11 +90,13 @@
 #define OUTSTRUCTOR_NODE_STRING "=[-->]"
 #define INSTANTIATION_NODE_STRING "[T]"
 #define FAKE_RECALL_NODE_PREFIX ".."
+#define SWITCH_NODE_STRING "[??]"
 #define IMPORT_DECL_STRING "<UNRESOLVED_IMPORT>"
 #define STANDARD_IMPORT_DECL_STRING "<STD_IMPORT>"
 
 #define UNIQUE_ID_PREFIX "idLabel"
 
 #define VERBOSE(s) if (verboseOutput) {s}
+#define PROFILE(s) if (parserProfile) {s}
 
 #endif
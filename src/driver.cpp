@@ -7,9 +7,13 @@
 
 #include "lexer.h"
 #include "parser.h"
+#include "cacher.h"
 #include "semmer.h"
+#include "opter.h"
 #include "genner.h"
 
+#include <sys/time.h>
+
 // global variables
 
 int driverErrorCode;
@@ -20,6 +24,9 @@ bool silentMode = SILENT_MODE_DEFAULT;
 bool codedOutput = CODED_OUTPUT_DEFAULT;
 int tabModulus = TAB_MODULUS_DEFAULT;
 bool eventuallyGiveUp = EVENTUALLY_GIVE_UP_DEFAULT;
+bool parserProfile = PARSER_PROFILE_DEFAULT;
+bool benchmarkMode = BENCHMARK_MODE_DEFAULT;
+string parseCacheDir(PARSE_CACHE_DIR_DEFAULT);
 
 vector<string> inFileNames; // source file name vector
 
@@ -64,9 +71,35 @@ unsigned int getUniqueInt() {
 }
 string getUniqueId() {
 	string acc(UNIQUE_ID_PREFIX);
-	acc += getUniqueInt();
+	char tempS[MAX_INT_STRING_LENGTH];
+	sprintf(tempS, "%u", getUniqueInt());
+	acc += tempS;
 	return acc;
 }
+// returns the 64-bit FNV-1a hash of the given bytes, continuing from the given hash (FNV_OFFSET_BASIS to start a new one)
+uint64_t hashBytes(uint64_t hash, const uint8_t *bytes, size_t length) {
+	for (size_t i=0; i < length; i++) {
+		hash ^= bytes[i];
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+// benchmark helper functions
+
+double getWallTime() {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+unsigned long countTreeNodes(const Tree *tree) {
+	unsigned long count = 0;
+	for (const Tree *cur = tree; cur != NULL; cur = cur->next) {
+		count += 1 + countTreeNodes(cur->child);
+	}
+	return count;
+}
 
 int containsString(vector<string> inFileNames, string &s) {
 	for (unsigned int i=0; i < inFileNames.size(); i++) { // scan the vector for matches
@@ -80,6 +113,8 @@ int containsString(vector<string> inFileNames, string &s) {
 
 // main driver function
 
+#ifndef NO_DRIVER_MAIN
+
 int main(int argc, char **argv) {
 	
 	// initialize local error code
@@ -103,6 +138,9 @@ int main(int argc, char **argv) {
 	bool cHandled = false;
 	bool tHandled = false;
 	bool eHandled = false;
+	bool rHandled = false;
+	bool bHandled = false;
+	bool iHandled = false;
 	for (int i=1; i<argc; i++) {
 		if (argv[i][0] == '-' && argv[i][1] != '\0') { // option argument
 			if (argv[i][1] == 'o' && argv[i][2] == '\0' && !oHandled) { // output file name
@@ -140,7 +178,7 @@ int main(int argc, char **argv) {
 				)
 				// flag this option as handled
 				vHandled = true;
-			} else if (argv[i][1] == 's' && argv[i][2] == '\0' && !vHandled && !sHandled && !cHandled) { // silent compilation option
+			} else if (argv[i][1] == 's' && argv[i][2] == '\0' && !vHandled && !sHandled && !cHandled && !rHandled) { // silent compilation option
 				silentMode = true;
 				// flag this option as handled
 				sHandled = true;
@@ -171,6 +209,22 @@ int main(int argc, char **argv) {
 				eventuallyGiveUp = false;
 				// flag this option as handled
 				eHandled = true;
+			} else if (argv[i][1] == 'r' && argv[i][2] == '\0' && !rHandled && !sHandled) { // parser profile option
+				parserProfile = true;
+				// flag this option as handled
+				rHandled = true;
+			} else if (argv[i][1] == 'b' && argv[i][2] == '\0' && !bHandled) { // benchmark mode option
+				benchmarkMode = true;
+				// flag this option as handled
+				bHandled = true;
+			} else if (argv[i][1] == 'i' && argv[i][2] == '\0' && !iHandled) { // parse cache option
+				if (++i >= argc) { // jump to the next argument, test if it doesn't exist
+					printError("-i expected cache directory argument");
+					die();
+				}
+				parseCacheDir = argv[i];
+				// flag this option as handled
+				iHandled = true;
 			} else if (argv[i][1] == 'h' && argv[i][2] == '\0' && argc == 2) {
 				// test to see if a command interpreter is available
 				int systemRetVal = system(NULL);
@@ -214,25 +268,67 @@ int main(int argc, char **argv) {
 		die();
 	}
 
+	// phase timers and workload counters for benchmark mode
+	double lexTime = 0.0, parseTime = 0.0, semTime = 0.0;
+	unsigned long benchTokens = 0, benchNodes = 0;
+	double phaseStart;
+
 	// lex files
+	phaseStart = getWallTime();
 	int lexerError = 0; // error flag
-	vector<vector<Token> *> lexemes; // per-file vector of the lexemes that the lexer is about to generate
+	vector<vector<Token> *> lexemes; // per-file vector of the lexemes that the lexer is about to generate; NULL for files whose parse was cached
+	vector<Tree *> cachedParsemes; // per-file parse tree loaded from the parse cache; NULL for files that must be parsed
+	vector<string> parseCacheKeys; // per-file parse cache key; empty for files that aren't cached
+	vector<string> parseCacheChecks; // per-file parse cache check, which the cache file must repeat
 	for (unsigned int i=0; i<inFiles.size(); i++) {
 		// check file arguments
 		string fileName(inFileNames[i]);
 		if (fileName == "-") {
 			fileName = STD_IN_FILE_NAME;
 		}
+		// if there's a parse cache, look up this file's parse tree in it
+		string cacheKey;
+		string cacheCheck;
+		Tree *cachedParseme = NULL;
+		unsigned long cachedTokens = 0;
+		string source;
+		if (!parseCacheDir.empty() && inFiles[i] != NULL) {
+			source = readSource(inFiles[i]);
+			cacheKey = getParseCacheKey(source);
+			cacheCheck = getParseCacheCheck(source);
+			if (!parserProfile) { // the parser profile needs the parser to actually run
+				cachedParseme = loadParseCache(cacheKey, cacheCheck, i, cachedTokens);
+			}
+		}
+		parseCacheKeys.push_back(cacheKey);
+		parseCacheChecks.push_back(cacheCheck);
+		cachedParsemes.push_back(cachedParseme);
+		if (cachedParseme != NULL) { // if we found a cached parse tree, skip lexing and parsing this file
+			lexemes.push_back(NULL);
+			benchTokens += cachedTokens;
+			VERBOSE(
+				printNotice(COLOREXP(SET_TERM(GREEN_CODE)) << "loaded cached parse of file \'" << fileName << "\'" << COLOREXP(SET_TERM(RESET_CODE)));
+				print(""); // new line
+			)
+			continue;
+		}
 		VERBOSE(
 			printNotice("lexing file \'" << fileName << "\'...");
 		)
 		// do the actual lexing
 		int thisLexError = 0; // one-shot error flag
-		vector<Token> *lexeme = lex(inFiles[i], i);
+		vector<Token> *lexeme;
+		if (!cacheKey.empty()) { // if we've already read in the file to hash it, lex the copy in memory
+			istringstream sourceStream(source);
+			lexeme = lex(&sourceStream, i);
+		} else {
+			lexeme = lex(inFiles[i], i);
+		}
 		if (lexeme == NULL) { // if lexing failed with an error, log the error condition
 			thisLexError = 1;
 		} else { // else if lexing was successful, log the lexeme to the vector
 			lexemes.push_back(lexeme);
+			benchTokens += lexeme->size();
 		}
 		// print out the tokens if we're in verbose mode
 		VERBOSE(
@@ -248,21 +344,30 @@ int main(int argc, char **argv) {
 			lexerError = thisLexError;
 		}
 	}
+	lexTime = getWallTime() - phaseStart;
 	// now, check if lexing failed and if so, kill the system as appropriate
 	if (lexerError) {
 		die(1);
 	}
 
 	// parse lexemes
+	phaseStart = getWallTime();
 	int parserError = 0; // error flag
 	Tree *treeRoot = NULL; // the root parseme of the parse tree
 	Tree *treeCur = NULL; // the tail of the linked list of parsemes
 	unsigned int fileIndex = 0; // current lexeme's file name index
 	for (vector<vector<Token> *>::iterator lexemeIter = lexemes.begin(); lexemeIter != lexemes.end(); lexemeIter++) {
-		VERBOSE(printNotice("parsing file \'" << inFileNames[fileIndex] << "\'...");)
-		// do the actual parsing
-		Tree *thisParseme;
-		int thisParseError = parse(*lexemeIter, thisParseme, fileIndex);
+		// do the actual parsing, unless the parse tree came from the parse cache
+		Tree *thisParseme = cachedParsemes[fileIndex];
+		int thisParseError = 0;
+		if (thisParseme == NULL) {
+			VERBOSE(printNotice("parsing file \'" << inFileNames[fileIndex] << "\'...");)
+			thisParseError = parse(*lexemeIter, thisParseme, fileIndex);
+			// store the new parse tree in the parse cache
+			if (!thisParseError && !parseCacheKeys[fileIndex].empty()) {
+				storeParseCache(parseCacheKeys[fileIndex], parseCacheChecks[fileIndex], thisParseme, (*lexemeIter)->size());
+			}
+		}
 		if (thisParseError) { // if parsing failed with an error, log the error condition
 			VERBOSE(
 				printNotice(COLOREXP(SET_TERM(RED_CODE)) << "failed to parse file \'" << inFileNames[fileIndex] << "\'" << COLOREXP(SET_TERM(RESET_CODE)));
@@ -292,6 +397,9 @@ int main(int argc, char **argv) {
 		// advance the file index
 		fileIndex++;
 	}
+	parseTime = getWallTime() - phaseStart;
+	// print the parser profile accumulated over all of the files, if it was requested
+	PROFILE(printParserProfile();)
 	// now, check if parsing failed and if so, kill the system as appropriate
 	if (parserError) {
 		die(1);
@@ -303,10 +411,22 @@ int main(int argc, char **argv) {
 
 	// allocate symbol tree root (will be filled with user-level definitions during parsing)
 	SymbolTree *stRoot;
-	// allocate the intermediate representation tree root (will be bound at the end of parsing)
-	SchedTree *codeRoot;
+	// allocate the intermediate code module (will be filled in as the semmer types the tree)
+	IRModule codeModule;
+
+	if (benchmarkMode) { // count the workload before the semmer starts decorating the tree
+		benchNodes = countTreeNodes(treeRoot);
+	}
 
-	int semmerErrorCode = sem(treeRoot, stRoot, codeRoot);
+	phaseStart = getWallTime();
+	int semmerErrorCode = sem(treeRoot, stRoot, codeModule);
+	semTime = getWallTime() - phaseStart;
+	// in benchmark mode, report the front end's workload and phase times as one machine-readable record
+	if (benchmarkMode) {
+		char tempS[MAX_STRING_LENGTH];
+		sprintf(tempS, "BENCH\t%lu\t%lu\t%.6f\t%.6f\t%.6f\t%d", benchTokens, benchNodes, lexTime, parseTime, semTime, semmerErrorCode);
+		cout << tempS << "\n";
+	}
 	// now, check if semming failed and kill the system as appropriate
 	if (semmerErrorCode) {
 		VERBOSE(
@@ -324,6 +444,28 @@ int main(int argc, char **argv) {
 		die(1);
 	}
 
+	// optimize the intermediate code module
+
+	VERBOSE(printNotice("optimizing intermediate code...");)
+
+	int opterErrorCode = opt(codeModule);
+	// now, check if optimizing failed and kill the system as appropriate
+	if (opterErrorCode) {
+		VERBOSE(
+			printNotice(COLOREXP(SET_TERM(RED_CODE)) << "failed to optimize intermediate code" << COLOREXP(SET_TERM(RESET_CODE)));
+			print(""); // new line
+		)
+	} else {
+		VERBOSE(
+			printNotice(COLOREXP(SET_TERM(GREEN_CODE)) << "successfully optimized intermediate code" << COLOREXP(SET_TERM(RESET_CODE)));
+			print(""); // new line
+		)
+	}
+	// now, check if optimizing failed and if so, kill the system as appropriate
+	if (opterErrorCode) {
+		die(1);
+	}
+
 	// generate the intermediate code tree
 
 	VERBOSE(printNotice("generating code dump...");)
@@ -332,7 +474,7 @@ int main(int argc, char **argv) {
 	string asmString;
 
 	// generate the actual assembly code
-	int gennerErrorCode = gen(codeRoot, asmString);
+	int gennerErrorCode = gen(codeModule, asmString);
 	// now, check if genning failed and kill the system as appropriate
 	if (gennerErrorCode) {
 		VERBOSE(
@@ -360,3 +502,5 @@ int main(int argc, char **argv) {
 	// terminate the program successfully
 	return 0;
 }
+
+#endif
@@ -33,7 +33,7 @@
 #define WARNING_STRING COLOREXP(SET_TERM(BRIGHT_CODE AND YELLOW_CODE))<<"WARNING"<<COLOREXP(SET_TERM(RESET_CODE))
 
 #define HEADER_LITERAL PROGRAM_STRING<<" -- "<<LANGUAGE_STRING<<" Compiler v.["<<VERSION_STRING<<"."<<VERSION_STAMP<<"] (c) "<<VERSION_YEAR<<" Kajetan Adrian Biedrzycki\n" /* compiler header */
-#define USAGE_LITERAL "\n\tusage:\t"<<PROGRAM_STRING<<" sourceFile... [-] [-o outputFile] [-p optimizationLevel]\n\t\t[-v] [-s] [-c] [-t tabWidth] [-e] [-h]\n" /* info literal */
+#define USAGE_LITERAL "\n\tusage:\t"<<PROGRAM_STRING<<" sourceFile... [-] [-o outputFile] [-p optimizationLevel]\n\t\t[-v] [-s] [-c] [-t tabWidth] [-e] [-r] [-b]\n\t\t[-i cacheDirectory] [-h]\n" /* info literal */
 #define SEE_ALSO_LITERAL "\n\tFor more information, type '"<<PROGRAM_STRING<<" -h'.\n" /* see also literal */
 #define LINK_LITERAL "\thome page: "<<HOME_PAGE<<"\n" /* link literal */
 
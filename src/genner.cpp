@@ -2,295 +2,15 @@
 
 #include "outputOperators.h"
 
+#include "allocer.h"
+
 // genner-global variables
 
 int gennerErrorCode;
 
-// IRTree functions
-IRTree::IRTree(int category) : category(category) {}
-IRTree::~IRTree() {}
-void IRTree::asmDump(string &asmString) const {
-	switch(category) {
-		case CATEGORY_LABEL:
-			((LabelTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_SEQ:
-			((SeqTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WORD8:
-			((WordTree8 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WORD16:
-			((WordTree16 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WORD32:
-			((WordTree32 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WORD64:
-			((WordTree64 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_ARRAY:
-			((ArrayTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_LIST:
-			((CompoundTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_TEMP:
-			((TempTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_READ:
-			((ReadTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_UNOP:
-			((UnOpTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_BINOP:
-			((BinOpTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_CONVOP:
-			((ConvOpTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_LOCK:
-			((LockTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_UNLOCK:
-			((UnlockTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_COND:
-			((CondTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_JUMP:
-			((JumpTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WRITE:
-			((WriteTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_COPY:
-			((CopyTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_SCHED:
-			((SchedTree *)this)->asmDump(asmString);
-			break;
-		default: // can't happen; the above should cover all cases
-			break;
-	}
-}
-
-// LabelTree functions
-LabelTree::LabelTree(SeqTree *code) : IRTree(CATEGORY_LABEL), id(getUniqueId()), code(code) {}
-LabelTree::~LabelTree() {
-	delete code;
-}
-string LabelTree::toString(unsigned int tabDepth) const {
-	string acc(id);
-	acc += '(';
-	acc += code->toString(tabDepth+1);
-	acc += ')';
-	return acc;
-}
-void LabelTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// SeqTree functions
-SeqTree::SeqTree(const vector<CodeTree *> &codeList) : IRTree(CATEGORY_SEQ), codeList(codeList) {}
-SeqTree::~SeqTree() {
-	for (vector<CodeTree *>::const_iterator iter = codeList.begin(); iter != codeList.end(); iter++) {
-		delete (*iter);
-	}
-}
-string SeqTree::toString(unsigned int tabDepth) const {
-	string acc;
-	for (vector<CodeTree *>::const_iterator iter = codeList.begin(); iter != codeList.end(); iter++) {
-		acc += (*iter)->toString(tabDepth+1);
-		if (iter + 1 != codeList.end()) {
-			acc += ',';
-		}
-	}
-	return acc;
-}
-void SeqTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// DataTree functions
-DataTree::DataTree(int category) : IRTree(category) {}
-DataTree::~DataTree() {}
-string DataTree::toString(unsigned int tabDepth) const {
-	switch(category) {
-		case CATEGORY_WORD8:
-			return ((WordTree8 *)this)->toString(tabDepth);
-		case CATEGORY_WORD16:
-			return ((WordTree16 *)this)->toString(tabDepth);
-		case CATEGORY_WORD32:
-			return ((WordTree32 *)this)->toString(tabDepth);
-		case CATEGORY_WORD64:
-			return ((WordTree64 *)this)->toString(tabDepth);
-		case CATEGORY_ARRAY:
-			return ((ArrayTree *)this)->toString(tabDepth);
-		case CATEGORY_LIST:
-			return ((CompoundTree *)this)->toString(tabDepth);
-		case CATEGORY_TEMP:
-			return ((TempTree *)this)->toString(tabDepth);
-		case CATEGORY_READ:
-			return ((ReadTree *)this)->toString(tabDepth);
-		default: // can't happen; the above should cover all cases
-			return "";
-	}
-}
-void DataTree::asmDump(string &asmString) const {
-	switch(category) {
-		case CATEGORY_WORD8:
-			((WordTree8 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WORD16:
-			((WordTree16 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WORD32:
-			((WordTree32 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_WORD64:
-			((WordTree64 *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_ARRAY:
-			((ArrayTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_LIST:
-			((CompoundTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_TEMP:
-			((TempTree *)this)->asmDump(asmString);
-			break;
-		case CATEGORY_READ:
-			((ReadTree *)this)->asmDump(asmString);
-			break;
-		default: // can't happen; the above should cover all cases
-			break;
-	}
-}
-
-// WordTree functions
-WordTree8::WordTree8(uint8_t data) : DataTree(CATEGORY_WORD8), data(data) {}
-WordTree8::~WordTree8() {}
-string WordTree8::toString(unsigned int tabDepth) const {
-	string acc("W08[");
-	char tempS[3];
-	sprintf(tempS, "%08X", data);
-	acc += tempS;
-	acc += ']';
-	return acc;
-}
-void WordTree8::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-WordTree16::WordTree16(uint16_t data) : DataTree(CATEGORY_WORD16), data(data) {}
-WordTree16::~WordTree16() {}
-string WordTree16::toString(unsigned int tabDepth) const {
-	string acc("W16[");
-	char tempS[3];
-	sprintf(tempS, "%08hX", data);
-	acc += tempS;
-	acc += ']';
-	return acc;
-}
-void WordTree16::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-WordTree32::WordTree32(uint32_t data) : DataTree(CATEGORY_WORD32), data(data) {}
-WordTree32::~WordTree32() {}
-string WordTree32::toString(unsigned int tabDepth) const {
-	string acc("W32[");
-	char tempS[3];
-	sprintf(tempS, "%08X", data);
-	acc += tempS;
-	acc += ']';
-	return acc;
-}
-void WordTree32::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-WordTree64::WordTree64(uint64_t data) : DataTree(CATEGORY_WORD64), data(data) {}
-WordTree64::~WordTree64() {}
-string WordTree64::toString(unsigned int tabDepth) const {
-	string acc("W64[");
-	char tempS[3];
-	sprintf(tempS, "%08"PRIx64, data);
-	acc += tempS;
-	acc += ']';
-	return acc;
-}
-void WordTree64::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// ArrayTree functions
-ArrayTree::ArrayTree(const vector<uint8_t> &data) : DataTree(CATEGORY_ARRAY), data(data) {}
-ArrayTree::~ArrayTree() {}
-string ArrayTree::toString(unsigned int tabDepth) const {
-	string acc("A[");
-	for (vector<uint8_t>::const_iterator iter = data.begin(); iter != data.end(); iter++) {
-		char tempS[3];
-		sprintf(tempS, "%02X", (*iter));
-		acc += tempS;
-	}
-	acc += ']';
-	return acc;
-}
-void ArrayTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// CompoundTree functions
-CompoundTree::CompoundTree(const vector<DataTree *> &dataList) : DataTree(CATEGORY_LIST), dataList(dataList) {}
-CompoundTree::~CompoundTree() {}
-string CompoundTree::toString(unsigned int tabDepth) const {
-	string acc("L[");
-	for (vector<DataTree *>::const_iterator iter = dataList.begin(); iter != dataList.end(); iter++) {
-		acc += (*iter)->toString(tabDepth+1);
-		if (iter + 1 != dataList.end()) {
-			acc += ',';
-		}
-	}
-	acc += ']';
-	return acc;
-}
-void CompoundTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// TempTree functions
-TempTree::TempTree(OpTree *opNode) : DataTree(CATEGORY_TEMP), opNode(opNode) {}
-TempTree::~TempTree() {delete opNode;}
-string TempTree::toString(unsigned int tabDepth) const {
-	string acc("(");
-	acc += opNode->toString(tabDepth+1);
-	acc += ')';
-	return acc;
-}
-void TempTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// ReadTree functions
-ReadTree::ReadTree(DataTree *address) : DataTree(CATEGORY_READ), address(address) {}
-ReadTree::~ReadTree() {delete address;}
-string ReadTree::toString(unsigned int tabDepth) const {
-	string acc("R(");
-	acc += address->toString(tabDepth+1);
-	acc += ')';
-	return acc;
-}
-void ReadTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// OpTree functions
-OpTree::OpTree(int category, int kind) : IRTree(category), kind(kind) {}
-OpTree::~OpTree() {}
-string OpTree::kindToString() const {
+// operator functions
+// returns the string representation of the given kind of operator
+string opKindToString(int kind) {
 	switch(kind) {
 		case UNOP_NOT_BOOL:
 			return "!";
@@ -337,7 +57,10 @@ string OpTree::kindToString() const {
 			return "%";
 		case BINOP_PLUS_INT:
 		case BINOP_PLUS_FLOAT:
+		case BINOP_PLUS_STRING:
 			return "+";
+		case UNOP_HASH_STRING:
+			return "hash";
 		case UNOP_MINUS_INT:
 		case UNOP_MINUS_FLOAT:
 		case BINOP_MINUS_INT:
@@ -355,259 +78,505 @@ string OpTree::kindToString() const {
 			return "float2String";
 		case CONVOP_CHAR2STRING:
 			return "char2String";
+		case CATOP_STRING:
+			return "cat";
 		// can't happen; the above should cover all cases
 		default:
 			return "";
 	}
 }
-string OpTree::toString(unsigned int tabDepth) const {
-	switch(category) {
-		case CATEGORY_UNOP:
-			return ((UnOpTree *)this)->toString(tabDepth);
-		case CATEGORY_BINOP:
-			return ((BinOpTree *)this)->toString(tabDepth);
-		case CATEGORY_CONVOP:
-			return ((ConvOpTree *)this)->toString(tabDepth);
-		default: // can't happen; the above should cover all cases
-			return "";
+// returns the hash of the given array's bytes; this is the run-time semantics of UNOP_HASH_STRING
+uint64_t hashBytes(const vector<uint8_t> &data) {
+	return hashBytes(FNV_OFFSET_BASIS, data.empty() ? NULL : &(data[0]), data.size());
+}
+// returns the kind of the string conversion that the given concatenation format performs, or -1 for CAT_FORMAT_STRING
+int catFormatConvKind(int format) {
+	switch (format) {
+		case CAT_FORMAT_BOOL:
+			return CONVOP_BOOL2STRING;
+		case CAT_FORMAT_INT:
+			return CONVOP_INT2STRING;
+		case CAT_FORMAT_FLOAT:
+			return CONVOP_FLOAT2STRING;
+		case CAT_FORMAT_CHAR:
+			return CONVOP_CHAR2STRING;
+		default: // CAT_FORMAT_STRING
+			return -1;
 	}
 }
-void OpTree::asmDump(string &asmString) const {
-	switch(category) {
-		case CATEGORY_UNOP:
-			((UnOpTree *)this)->asmDump(asmString);
+// returns the concatenation format that performs the given kind of string conversion, or CAT_FORMAT_STRING if it's not a string conversion
+int convKindCatFormat(int kind) {
+	switch (kind) {
+		case CONVOP_BOOL2STRING:
+			return CAT_FORMAT_BOOL;
+		case CONVOP_INT2STRING:
+			return CAT_FORMAT_INT;
+		case CONVOP_FLOAT2STRING:
+			return CAT_FORMAT_FLOAT;
+		case CONVOP_CHAR2STRING:
+			return CAT_FORMAT_CHAR;
+		default:
+			return CAT_FORMAT_STRING;
+	}
+}
+
+// IRModule functions
+IRModule::IRModule() : root(NULL_IR_ID) {}
+IRModule::~IRModule() {}
+unsigned int IRModule::size() const {
+	return categories.size();
+}
+IRId IRModule::addNode(int category, int kind, const vector<IRId> &operandList, uint32_t aux) {
+	categories.push_back((uint8_t)category);
+	kinds.push_back((uint8_t)kind);
+	operandStarts.push_back(operands.size());
+	operandCounts.push_back(operandList.size());
+	auxes.push_back(aux);
+	operands.insert(operands.end(), operandList.begin(), operandList.end());
+	return (categories.size() - 1);
+}
+IRId IRModule::addWord(int category, uint64_t word) {
+	words.push_back(word);
+	return addNode(category, 0, vector<IRId>(), words.size() - 1);
+}
+IRId IRModule::addWord(uint64_t word) {
+	return addWord(CATEGORY_WORD64, word);
+}
+// appends the given bytes to the byte-array side table, returning their index in arrayStarts
+uint32_t IRModule::addBytes(const vector<uint8_t> &data) {
+	arrayStarts.push_back(bytes.size());
+	arrayLengths.push_back(data.size());
+	bytes.insert(bytes.end(), data.begin(), data.end());
+	return (arrayStarts.size() - 1);
+}
+IRId IRModule::addArray(const vector<uint8_t> &data) {
+	return addNode(CATEGORY_ARRAY, 0, vector<IRId>(), addBytes(data));
+}
+IRId IRModule::addCompound(const vector<IRId> &dataList) {
+	return addNode(CATEGORY_LIST, 0, dataList);
+}
+IRId IRModule::addSlice(IRId base, IRId begin, IRId end, uint32_t stride) {
+	vector<IRId> operandList;
+	operandList.push_back(base);
+	operandList.push_back(begin);
+	operandList.push_back(end);
+	return addNode(CATEGORY_SLICE, 0, operandList, stride);
+}
+IRId IRModule::addTemp(IRId opNode) {
+	return addNode(CATEGORY_TEMP, 0, vector<IRId>(1, opNode));
+}
+IRId IRModule::addRead(IRId address, int kind) {
+	return addNode(CATEGORY_READ, kind, vector<IRId>(1, address));
+}
+IRId IRModule::addUnOp(int kind, IRId subNode) {
+	return addNode(CATEGORY_UNOP, kind, vector<IRId>(1, subNode));
+}
+IRId IRModule::addBinOp(int kind, IRId subNodeLeft, IRId subNodeRight) {
+	vector<IRId> operandList;
+	operandList.push_back(subNodeLeft);
+	operandList.push_back(subNodeRight);
+	return addNode(CATEGORY_BINOP, kind, operandList);
+}
+IRId IRModule::addConvOp(int kind, IRId subNode) {
+	return addNode(CATEGORY_CONVOP, kind, vector<IRId>(1, subNode));
+}
+IRId IRModule::addCat(int kind, const vector<IRId> &operandList, const vector<uint8_t> &formats) {
+	return addNode(CATEGORY_CATOP, kind, operandList, addBytes(formats));
+}
+IRId IRModule::addLabel(const string &id, IRId code) {
+	labelIds.push_back(id);
+	return addNode(CATEGORY_LABEL, 0, vector<IRId>(1, code), labelIds.size() - 1);
+}
+IRId IRModule::addSeq(const vector<IRId> &codeList) {
+	return addNode(CATEGORY_SEQ, 0, codeList);
+}
+IRId IRModule::addLock(IRId address) {
+	return addNode(CATEGORY_LOCK, 0, vector<IRId>(1, address));
+}
+IRId IRModule::addUnlock(IRId address) {
+	return addNode(CATEGORY_UNLOCK, 0, vector<IRId>(1, address));
+}
+IRId IRModule::addCond(IRId test, IRId trueBranch, IRId falseBranch) {
+	vector<IRId> operandList;
+	operandList.push_back(test);
+	operandList.push_back(trueBranch);
+	operandList.push_back(falseBranch);
+	return addNode(CATEGORY_COND, 0, operandList);
+}
+IRId IRModule::addJump(IRId test, const vector<IRId> &jumpTable) {
+	vector<IRId> operandList(1, test);
+	operandList.insert(operandList.end(), jumpTable.begin(), jumpTable.end());
+	return addNode(CATEGORY_JUMP, 0, operandList);
+}
+IRId IRModule::addLoop(IRId test, IRId body) {
+	vector<IRId> operandList;
+	operandList.push_back(test);
+	operandList.push_back(body);
+	return addNode(CATEGORY_LOOP, 0, operandList);
+}
+IRId IRModule::addRange(IRId count, IRId address, IRId body, bool parallel) {
+	vector<IRId> operandList;
+	operandList.push_back(count);
+	operandList.push_back(address);
+	operandList.push_back(body);
+	return addNode(CATEGORY_RANGE, 0, operandList, parallel ? 1 : 0);
+}
+IRId IRModule::addBatch(IRId stream, IRId address, IRId body, int access) {
+	vector<IRId> operandList;
+	operandList.push_back(stream);
+	operandList.push_back(address);
+	operandList.push_back(body);
+	return addNode(CATEGORY_BATCH, 0, operandList, access);
+}
+IRId IRModule::addWrite(IRId source, IRId address) {
+	vector<IRId> operandList;
+	operandList.push_back(source);
+	operandList.push_back(address);
+	return addNode(CATEGORY_WRITE, 0, operandList);
+}
+IRId IRModule::addCopy(IRId sourceAddress, IRId destinationAddress, uint32_t length) {
+	vector<IRId> operandList;
+	operandList.push_back(sourceAddress);
+	operandList.push_back(destinationAddress);
+	return addNode(CATEGORY_COPY, 0, operandList, length);
+}
+IRId IRModule::addSched(const vector<IRId> &labelList) {
+	return addNode(CATEGORY_SCHED, 0, labelList);
+}
+// replaces the operands of the given node in place, so that everything that already refers to the node sees the new operands;
+// the old operands are left behind in operands, to be dropped by the next compaction
+void IRModule::setOperands(IRId id, const vector<IRId> &operandList) {
+	operandStarts[id] = operands.size();
+	operandCounts[id] = operandList.size();
+	operands.insert(operands.end(), operandList.begin(), operandList.end());
+}
+// recursively appends a copy of the given node of the source module (and everything it refers to) to this module, returning the id of the copy;
+// copied maps the source nodes that are already in this module to their copies, so shared nodes stay shared; operands are copied before the nodes that use them
+IRId IRModule::copyNode(const IRModule &source, IRId id, map<IRId, IRId> &copied) {
+	if (id == NULL_IR_ID) {
+		return NULL_IR_ID;
+	}
+	map<IRId, IRId>::const_iterator copiedFind = copied.find(id);
+	if (copiedFind != copied.end()) {
+		return (*copiedFind).second;
+	}
+	int category = source.categories[id];
+	vector<IRId> operandList;
+	for (unsigned int i = 0; i < source.operandCounts[id]; i++) {
+		operandList.push_back(copyNode(source, source.operand(id, i), copied));
+	}
+	IRId acc;
+	switch (category) {
+		case CATEGORY_LABEL:
+			acc = addLabel(source.labelIds[source.auxes[id]], operandList[0]);
 			break;
-		case CATEGORY_BINOP:
-			((BinOpTree *)this)->asmDump(asmString);
+		case CATEGORY_WORD8:
+		case CATEGORY_WORD16:
+		case CATEGORY_WORD32:
+		case CATEGORY_WORD64:
+			acc = addWord(category, source.word(id));
 			break;
-		case CATEGORY_CONVOP:
-			((ConvOpTree *)this)->asmDump(asmString);
+		case CATEGORY_ARRAY:
+			acc = addArray(source.array(id));
 			break;
-		default: // can't happen; the above should cover all cases
+		case CATEGORY_CATOP:
+			acc = addCat(source.kinds[id], operandList, source.array(id));
+			break;
+		default:
+			acc = addNode(category, source.kinds[id], operandList, source.auxes[id]);
 			break;
 	}
-}
-
-// UnOpTree functions
-UnOpTree::UnOpTree(int kind, DataTree *subNode) : OpTree(CATEGORY_UNOP, kind), subNode(subNode) {}
-UnOpTree::~UnOpTree() {delete subNode;}
-string UnOpTree::toString(unsigned int tabDepth) const {
-	string acc(kindToString());
-	acc += '(';
-	acc += subNode->toString(tabDepth+1);
-	acc += ')';
+	copied.insert(make_pair(id, acc));
 	return acc;
 }
-void UnOpTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
+// drops every node that isn't reachable from the root (the garbage left behind by folding, lowering, and setOperands()), along with its side table entries;
+// this renumbers the nodes, so no ids into the module may be held across a compaction
+void IRModule::compact() {
+	IRModule compacted;
+	map<IRId, IRId> copied;
+	compacted.root = compacted.copyNode(*this, root, copied);
+	*this = compacted;
+}
+// returns the number of distinct nodes reachable from the given node, including the node itself
+unsigned int IRModule::reachableSize(IRId id) const {
+	map<IRId, bool> seen;
+	vector<IRId> workList(1, id);
+	while (!workList.empty()) {
+		IRId cur = workList.back();
+		workList.pop_back();
+		if (cur == NULL_IR_ID || seen.find(cur) != seen.end()) {
+			continue;
+		}
+		seen.insert(make_pair(cur, true));
+		for (unsigned int i = 0; i < operandCounts[cur]; i++) {
+			workList.push_back(operand(cur, i));
+		}
+	}
+	return seen.size();
 }
-
-// BinOpTree functions
-BinOpTree::BinOpTree(int kind, DataTree *subNodeLeft, DataTree *subNodeRight) : OpTree(CATEGORY_BINOP, kind), subNodeLeft(subNodeLeft), subNodeRight(subNodeRight) {}
-BinOpTree::~BinOpTree() {delete subNodeLeft; delete subNodeRight;}
-string BinOpTree::toString(unsigned int tabDepth) const {
-	string acc(kindToString());
-	acc += '(';
-	acc += subNodeLeft->toString(tabDepth+1);
-	acc += ',';
-	acc += subNodeRight->toString(tabDepth+1);
-	acc += ')';
-	return acc;
+IRId IRModule::operand(IRId id, unsigned int index) const {
+	return operands[operandStarts[id] + index];
 }
-void BinOpTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
+uint32_t IRModule::operandSlot(IRId id, unsigned int index) const {
+	return (operandStarts[id] + index);
 }
-
-// ConvOpTree functions
-ConvOpTree::ConvOpTree(int kind, DataTree *subNode) : OpTree(CATEGORY_CONVOP, kind), subNode(subNode) {}
-ConvOpTree::~ConvOpTree() {delete subNode;}
-string ConvOpTree::toString(unsigned int tabDepth) const {
-	string acc(kindToString());
-	acc += '(';
-	acc += subNode->toString(tabDepth+1);
-	acc += ')';
-	return acc;
+uint64_t IRModule::word(IRId id) const {
+	return words[auxes[id]];
 }
-void ConvOpTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
+vector<uint8_t> IRModule::array(IRId id) const {
+	vector<uint8_t>::const_iterator start = bytes.begin() + arrayStarts[auxes[id]];
+	return vector<uint8_t>(start, start + arrayLengths[auxes[id]]);
 }
-
-// CodeTree functions
-CodeTree::CodeTree(int category) : IRTree(category) {}
-CodeTree::~CodeTree() {}
-string CodeTree::toString(unsigned int tabDepth) const {
-	switch(category) {
-		case CATEGORY_LOCK:
-			return ((LockTree *)this)->toString(tabDepth);
-		case CATEGORY_UNLOCK:
-			return ((UnlockTree *)this)->toString(tabDepth);
-		case CATEGORY_COND:
-			return ((CondTree *)this)->toString(tabDepth);
-		case CATEGORY_JUMP:
-			return ((JumpTree *)this)->toString(tabDepth);
-		case CATEGORY_WRITE:
-			return ((WriteTree *)this)->toString(tabDepth);
-		case CATEGORY_COPY:
-			return ((CopyTree *)this)->toString(tabDepth);
-		case CATEGORY_SCHED:
-			return ((SchedTree *)this)->toString(tabDepth);
-		default: // can't happen; the above should cover all cases
-			return "";
+// returns the string representation of the given node
+string IRModule::toString(IRId id, unsigned int tabDepth) const {
+	if (id == NULL_IR_ID) {
+		return "";
 	}
-}
-void CodeTree::asmDump(string &asmString) const {
-	switch(category) {
+	char tempS[MAX_INT_STRING_LENGTH];
+	string acc;
+	switch (categories[id]) {
+		case CATEGORY_LABEL:
+			acc += labelIds[auxes[id]];
+			acc += '(';
+			acc += toString(operand(id, 0), tabDepth+1);
+			acc += ')';
+			return acc;
+		case CATEGORY_WORD8:
+			sprintf(tempS, "W08[%02X]", (unsigned int)word(id));
+			return tempS;
+		case CATEGORY_WORD16:
+			sprintf(tempS, "W16[%04X]", (unsigned int)word(id));
+			return tempS;
+		case CATEGORY_WORD32:
+			sprintf(tempS, "W32[%08X]", (unsigned int)word(id));
+			return tempS;
+		case CATEGORY_WORD64:
+			acc += "W64[";
+			sprintf(tempS, "%016" PRIX64, word(id));
+			acc += tempS;
+			acc += ']';
+			return acc;
+		case CATEGORY_ARRAY:
+			acc += "A[";
+			for (unsigned int i = 0; i < arrayLengths[auxes[id]]; i++) {
+				sprintf(tempS, "%02X", bytes[arrayStarts[auxes[id]] + i]);
+				acc += tempS;
+			}
+			acc += ']';
+			return acc;
+		case CATEGORY_SEQ:
+		case CATEGORY_NOP:
+			break;
+		case CATEGORY_LIST:
+			acc += "L[";
+			break;
+		case CATEGORY_SLICE:
+			acc += "S(";
+			break;
+		case CATEGORY_TEMP:
+			acc += '(';
+			break;
+		case CATEGORY_READ:
+			acc += (kinds[id] == READ_FLOAT) ? "RF(" : "R(";
+			break;
+		case CATEGORY_UNOP:
+		case CATEGORY_BINOP:
+		case CATEGORY_CONVOP:
+			acc += opKindToString(kinds[id]);
+			acc += '(';
+			break;
+		case CATEGORY_CATOP: {
+			vector<uint8_t> formats = array(id);
+			acc += opKindToString(kinds[id]);
+			acc += '(';
+			for (unsigned int i = 0; i < operandCounts[id]; i++) {
+				int convKind = catFormatConvKind(formats[i]);
+				if (convKind >= 0) {
+					acc += opKindToString(convKind);
+					acc += '(';
+				}
+				acc += toString(operand(id, i), tabDepth+1);
+				if (convKind >= 0) {
+					acc += ')';
+				}
+				if (i + 1 != operandCounts[id]) {
+					acc += ',';
+				}
+			}
+			acc += ')';
+			return acc;
+		}
 		case CATEGORY_LOCK:
-			((LockTree *)this)->asmDump(asmString);
+			acc += "L(";
 			break;
 		case CATEGORY_UNLOCK:
-			((UnlockTree *)this)->asmDump(asmString);
+			acc += "U(";
 			break;
 		case CATEGORY_COND:
-			((CondTree *)this)->asmDump(asmString);
+			acc += "?(";
 			break;
 		case CATEGORY_JUMP:
-			((JumpTree *)this)->asmDump(asmString);
+			acc += "J(";
 			break;
 		case CATEGORY_WRITE:
-			((WriteTree *)this)->asmDump(asmString);
+			acc += "W(";
 			break;
 		case CATEGORY_COPY:
-			((CopyTree *)this)->asmDump(asmString);
+			acc += "C(";
 			break;
 		case CATEGORY_SCHED:
-			((SchedTree *)this)->asmDump(asmString);
+			acc += "#(";
+			break;
+		case CATEGORY_LOOP:
+			acc += "@(";
+			break;
+		case CATEGORY_RANGE:
+			acc += auxes[id] ? "%|(" : "%(";
+			break;
+		case CATEGORY_BATCH:
+			acc += (auxes[id] & ACCESS_WRITES_LATCHES) ? "\\\\(" : "\\\\|(";
 			break;
 		default: // can't happen; the above should cover all cases
 			break;
 	}
-}
-
-// LockTree functions
-LockTree::LockTree(DataTree *address) : CodeTree(CATEGORY_LOCK), address(address) {}
-LockTree::~LockTree() {delete address;}
-string LockTree::toString(unsigned int tabDepth) const {
-	string acc("L(");
-	acc += address->toString(tabDepth+1);
-	acc += ')';
-	return acc;
-}
-void LockTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
-
-// UnlockTree functions
-UnlockTree::UnlockTree(DataTree *address) : CodeTree(CATEGORY_UNLOCK), address(address) {}
-UnlockTree::~UnlockTree() {delete address;}
-string UnlockTree::toString(unsigned int tabDepth) const {
-	string acc("U(");
-	acc += address->toString(tabDepth+1);
-	acc += ')';
+	for (unsigned int i = 0; i < operandCounts[id]; i++) {
+		if (categories[id] == CATEGORY_JUMP && i > 0) { // jump table entries are prefixed with their index
+			sprintf(tempS, "%u:", i - 1);
+			acc += tempS;
+		}
+		acc += toString(operand(id, i), tabDepth+1);
+		if (i + 1 != operandCounts[id]) {
+			acc += ',';
+		}
+	}
+	if (categories[id] == CATEGORY_COPY || categories[id] == CATEGORY_SLICE) {
+		sprintf(tempS, ",%u", auxes[id]);
+		acc += tempS;
+	}
+	if (categories[id] == CATEGORY_LIST) {
+		acc += ']';
+	} else if (categories[id] != CATEGORY_SEQ && categories[id] != CATEGORY_NOP) {
+		acc += ')';
+	}
 	return acc;
 }
-void UnlockTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
 
-// CondTree functions
-CondTree::CondTree(DataTree *test, CodeTree *trueBranch, CodeTree *falseBranch) : CodeTree(CATEGORY_COND), test(test), trueBranch(trueBranch), falseBranch(falseBranch) {}
-CondTree::~CondTree() {delete test; delete trueBranch; delete falseBranch;}
-string CondTree::toString(unsigned int tabDepth) const {
-	string acc("?(");
-	acc += test->toString(tabDepth+1);
-	acc += ',';
-	acc += trueBranch->toString(tabDepth+1);
-	acc += ',';
-	acc += falseBranch->toString(tabDepth+1);
-	acc += ')';
-	return acc;
-}
-void CondTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
-}
+// IRModule serialization helpers
 
-// JumpTree functions
-JumpTree::JumpTree(DataTree *test, const vector<SeqTree *> &jumpTable) : CodeTree(CATEGORY_JUMP), test(test), jumpTable(jumpTable) {}
-JumpTree::~JumpTree() {
-	for (vector<SeqTree *>::const_iterator iter = jumpTable.begin(); iter != jumpTable.end(); iter++) {
-		delete (*iter);
+// appends the little-endian encoding of the given value to acc
+void serializeWord(string &acc, uint64_t value, unsigned int size) {
+	for (unsigned int i = 0; i < size; i++) {
+		acc += (char)((value >> (8*i)) & 0xFF);
 	}
 }
-string JumpTree::toString(unsigned int tabDepth) const {
-	string acc("J(");
-	for (unsigned int i = 0; i < jumpTable.size(); i++) {
-		acc += i;
-		acc += ':';
-		acc += (jumpTable[i])->toString(tabDepth+1);
-		if (i != jumpTable.size() - 1) {
-			acc += ',';
-		}
+// decodes the little-endian value at the given position of data, advancing the position; returns false if data is too short
+bool deserializeWord(const string &data, unsigned int &pos, uint64_t &value, unsigned int size) {
+	if (pos + size > data.size()) {
+		return false;
 	}
-	acc += ')';
-	return acc;
-}
-void JumpTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
+	value = 0;
+	for (unsigned int i = 0; i < size; i++) {
+		value |= ((uint64_t)(uint8_t)data[pos+i]) << (8*i);
+	}
+	pos += size;
+	return true;
 }
-
-// WriteTree functions
-WriteTree::WriteTree(DataTree *source, DataTree *address) : CodeTree(CATEGORY_WRITE), source(source), address(address) {}
-WriteTree::~WriteTree() {delete source; delete address;}
-string WriteTree::toString(unsigned int tabDepth) const {
-	string acc("W(");
-	acc += source->toString(tabDepth+1);
-	acc += ',';
-	acc += address->toString(tabDepth+1);
-	acc += ')';
-	return acc;
+template <class T> void serializeVector(string &acc, const vector<T> &v) {
+	serializeWord(acc, v.size(), sizeof(uint32_t));
+	for (typename vector<T>::const_iterator iter = v.begin(); iter != v.end(); iter++) {
+		serializeWord(acc, *iter, sizeof(T));
+	}
 }
-void WriteTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
+template <class T> bool deserializeVector(const string &data, unsigned int &pos, vector<T> &v) {
+	uint64_t length;
+	if (!deserializeWord(data, pos, length, sizeof(uint32_t)) || pos + length*sizeof(T) > data.size()) {
+		return false;
+	}
+	v.resize(length);
+	for (unsigned int i = 0; i < length; i++) {
+		uint64_t value = 0;
+		deserializeWord(data, pos, value, sizeof(T));
+		v[i] = (T)value;
+	}
+	return true;
 }
 
-// CopyTree functions
-CopyTree::CopyTree(DataTree *sourceAddress, DataTree *destinationAddress, uint32_t length) : CodeTree(CATEGORY_COPY), sourceAddress(sourceAddress), destinationAddress(destinationAddress), length(length) {}
-CopyTree::~CopyTree() {delete sourceAddress; delete destinationAddress;}
-string CopyTree::toString(unsigned int tabDepth) const {
-	string acc("C(");
-	acc += sourceAddress->toString(tabDepth+1);
-	acc += ',';
-	acc += destinationAddress->toString(tabDepth+1);
-	acc += ',';
-	acc += length;
-	acc += ')';
-	return acc;
-}
-void CopyTree::asmDump(string &asmString) const {
-	asmString += ""; // LOL
+// appends a self-contained binary image of this module to acc; all integers are stored little-endian, so images are portable between hosts
+void IRModule::serialize(string &acc) const {
+	acc += IR_MODULE_MAGIC;
+	serializeWord(acc, IR_MODULE_VERSION, sizeof(uint32_t));
+	serializeWord(acc, root, sizeof(IRId));
+	serializeVector(acc, categories);
+	serializeVector(acc, kinds);
+	serializeVector(acc, operandStarts);
+	serializeVector(acc, operandCounts);
+	serializeVector(acc, auxes);
+	serializeVector(acc, operands);
+	serializeVector(acc, words);
+	serializeVector(acc, arrayStarts);
+	serializeVector(acc, arrayLengths);
+	serializeVector(acc, bytes);
+	serializeWord(acc, labelIds.size(), sizeof(uint32_t));
+	for (vector<string>::const_iterator iter = labelIds.begin(); iter != labelIds.end(); iter++) {
+		serializeWord(acc, (*iter).size(), sizeof(uint32_t));
+		acc += *iter;
+	}
 }
-
-// SchedTree functions
-SchedTree::SchedTree(const vector<LabelTree *> &labelList) : CodeTree(CATEGORY_SCHED), labelList(labelList) {}
-SchedTree::~SchedTree() {}
-string SchedTree::toString(unsigned int tabDepth) const {
-	string acc("#(");
-	for (vector<LabelTree *>::const_iterator iter = labelList.begin(); iter != labelList.end(); iter++) {
-		acc += (*iter)->toString(tabDepth+1);
-		if (iter + 1 != labelList.end()) {
-			acc += ',';
+// replaces the contents of this module with the given binary image; returns false if the image is malformed
+bool IRModule::deserialize(const string &data) {
+	unsigned int pos = strlen(IR_MODULE_MAGIC);
+	uint64_t version, rootValue, numLabels;
+	if (data.compare(0, pos, IR_MODULE_MAGIC) != 0 ||
+			!deserializeWord(data, pos, version, sizeof(uint32_t)) || version != IR_MODULE_VERSION ||
+			!deserializeWord(data, pos, rootValue, sizeof(IRId)) ||
+			!deserializeVector(data, pos, categories) || !deserializeVector(data, pos, kinds) ||
+			!deserializeVector(data, pos, operandStarts) || !deserializeVector(data, pos, operandCounts) ||
+			!deserializeVector(data, pos, auxes) || !deserializeVector(data, pos, operands) ||
+			!deserializeVector(data, pos, words) || !deserializeVector(data, pos, arrayStarts) ||
+			!deserializeVector(data, pos, arrayLengths) || !deserializeVector(data, pos, bytes) ||
+			!deserializeWord(data, pos, numLabels, sizeof(uint32_t))) {
+		return false;
+	}
+	root = rootValue;
+	labelIds.clear();
+	for (unsigned int i = 0; i < numLabels; i++) {
+		uint64_t length;
+		if (!deserializeWord(data, pos, length, sizeof(uint32_t)) || pos + length > data.size()) {
+			return false;
 		}
+		labelIds.push_back(data.substr(pos, length));
+		pos += length;
 	}
-	acc += ')';
-	return acc;
+	return true;
 }
-void SchedTree::asmDump(string &asmString) const {
+void IRModule::asmDump(IRId id, string &asmString) const {
 	asmString += ""; // LOL
 }
 
 // main code generation function; asmDump is the assembler text generated
-int gen(SchedTree *codeRoot, string &asmString) {
+int gen(IRModule &codeModule, string &asmString) {
 
 	// initialize local error code
 	gennerErrorCode = 0;
+
+	// allocate registers for the code of every label
+	unsigned int numSplits = 0;
+	unsigned int numSpillSlots = 0;
+	unsigned int numCalleeSaved = 0;
+	for (IRId label = 0; label < codeModule.size(); label++) {
+		if (codeModule.categories[label] == CATEGORY_LABEL) {
+			RegAlloc regAlloc(codeModule, label);
+			regAlloc.allocate();
+			VERBOSE( cout << regAlloc.toString(); )
+			numSplits += regAlloc.numSplits;
+			numSpillSlots += regAlloc.numSpillSlots;
+			numCalleeSaved += regAlloc.calleeSavedUsed();
+		}
+	}
+	VERBOSE( printNotice("allocated registers with " << numSplits << " interval splits, " << numSpillSlots << " spill slots, and " << numCalleeSaved << " callee-saved registers"); )
 	
 	// recursively generate the assembly code for the program
-	codeRoot->asmDump(asmString);
+	codeModule.asmDump(codeModule.root, asmString);
 
 	// finally, return to the caller
 	return gennerErrorCode ? 1 : 0;
@@ -10,209 +10,37 @@
 #include "types.h"
 #include "semmer.h"
 
-// CodeTree category specifiers
-#define CATEGORY_NOP 0
-#define CATEGORY_LABEL 1
-#define CATEGORY_SEQ 2
-#define CATEGORY_WORD8 3
-#define CATEGORY_WORD16 4
-#define CATEGORY_WORD32 5
-#define CATEGORY_WORD64 6
-#define CATEGORY_ARRAY 7
-#define CATEGORY_LIST 8
-#define CATEGORY_TEMP 9
-#define CATEGORY_READ 10
-#define CATEGORY_UNOP 11
-#define CATEGORY_BINOP 12
-#define CATEGORY_CONVOP 13
-#define CATEGORY_LOCK 14
-#define CATEGORY_UNLOCK 15
-#define CATEGORY_COND 16
-#define CATEGORY_JUMP 17
-#define CATEGORY_WRITE 18
-#define CATEGORY_COPY 19
-#define CATEGORY_SCHED 20
-
-// WordTree default size
-#define WordTree WordTree64
-
-// IRTree classes
-
-class IRTree {
-	public:
-		// data members
-		int category; // the category that this IRTree belongs to
-		// allocators/deallocators
-		IRTree(int category);
-		virtual ~IRTree();
-		// core methods
-		string toString(unsigned int tabDepth = 1) const;
-		void asmDump(string &asmString) const;
-};
-
-// LabelTree classes
-
-// usage: identifier-labeled sequential code block; an atomic unit of execution
-class LabelTree : public IRTree {
-	public:
-		// data members
-		string id; // string representation of this label
-		SeqTree *code; // pointer to the tree node containing the sequence of code trees to run
-		// allocators/deallocators
-		LabelTree(SeqTree *code);
-		~LabelTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// SeqTree classes
-
-// usage: a sequence of code to execute
-class SeqTree : public IRTree {
-	public:
-		// data members
-		vector<CodeTree *> codeList; // vector representing the sequence of code trees to execute in order
-		// allocators/deallocators
-		SeqTree(const vector<CodeTree *> &seqList);
-		~SeqTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// DataTree classes
-
-// usage: abstract class; never used directly
-class DataTree : public IRTree {
-	public:
-		// allocators/deallocators
-		DataTree(int category);
-		virtual ~DataTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: an in-place inclusion of an 8-bit data word
-class WordTree8 : public DataTree {
-	public:
-		// data members
-		uint8_t data; // the raw data word contained in this node
-		// allocators/deallocators
-		WordTree8(uint8_t data);
-		~WordTree8();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: an in-place inclusion of a 16-bit data word
-class WordTree16 : public DataTree {
-	public:
-		// data members
-		uint16_t data; // the raw data word contained in this node
-		// allocators/deallocators
-		WordTree16(uint16_t data);
-		~WordTree16();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: an in-place inclusion of a 32-bit data word
-class WordTree32 : public DataTree {
-	public:
-		// data members
-		uint32_t data; // the raw data word contained in this node
-		// allocators/deallocators
-		WordTree32(uint32_t data);
-		~WordTree32();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: an in-place inclusion of a 64-bit data word
-class WordTree64 : public DataTree {
-	public:
-		// data members
-		uint64_t data; // the raw data word contained in this node
-		// allocators/deallocators
-		WordTree64(uint64_t data);
-		~WordTree64();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: an in-place inclusion of a byte-array of data
-class ArrayTree : public DataTree {
-	public:
-		// data members
-		vector<uint8_t> data; // vector of the raw byte-array of data contained in this node
-		// allocators/deallocators
-		ArrayTree(const vector<uint8_t> &data);
-		~ArrayTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: a compounding of several data trees to be computed separately but treated atomically
-class CompoundTree : public DataTree {
-	public:
-		// data members
-		vector<DataTree *> dataList; // vector of the data trees that make up this node
-		// allocators/deallocators
-		CompoundTree(const vector<DataTree *> &dataList);
-		~CompoundTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: allocate temporary storage for the result of an operation
-class TempTree : public DataTree {
-	public:
-		// data members
-		OpTree *opNode; // pointer to the operation that this temporary is holding the result of
-		// allocators/deallocators
-		TempTree(OpTree *opNode);
-		~TempTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: read memory from the specified memory address
-class ReadTree : public DataTree {
-	public:
-		// data members
-		DataTree *address; // pointer to the data subnode specifying the memory address to read from
-		// allocators/deallocators
-		ReadTree(DataTree *address);
-		~ReadTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// OpTree classes
-
-// usage: abstract class; never used directly
-class OpTree : public IRTree {
-	public:
-		// data members
-		int kind; // the kind of operator to apply to the subnode(s); the valid values are defined above the subclass that they apply to
-		// allocators/deallocators
-		OpTree(int category, int kind);
-		virtual ~OpTree();
-		// core methods
-		string kindToString() const;
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
+// IR node category specifiers; each one is followed by the operands of its nodes, in order, and what the node does
+#define CATEGORY_NOP 0 // (none): do nothing
+#define CATEGORY_LABEL 1 // code: identifier-labeled sequential code block; an atomic unit of execution
+#define CATEGORY_SEQ 2 // code...: a sequence of code to execute
+#define CATEGORY_WORD8 3 // (none): an in-place inclusion of an 8-bit data word
+#define CATEGORY_WORD16 4 // (none): an in-place inclusion of a 16-bit data word
+#define CATEGORY_WORD32 5 // (none): an in-place inclusion of a 32-bit data word
+#define CATEGORY_WORD64 6 // (none): an in-place inclusion of a 64-bit data word
+#define CATEGORY_ARRAY 7 // (none): an in-place inclusion of a byte-array of data
+#define CATEGORY_LIST 8 // data...: a compounding of several data nodes to be computed separately but treated atomically
+#define CATEGORY_TEMP 9 // op: allocate temporary storage for the result of an operation; after optimization, a TEMP may be shared among several consumers, in which case the operation is only computed once
+#define CATEGORY_READ 10 // address: read memory from the specified memory address
+#define CATEGORY_UNOP 11 // sub: perform the given kind of unary operation on sub
+#define CATEGORY_BINOP 12 // left, right: perform the given kind of binary operation on left and right
+#define CATEGORY_CONVOP 13 // sub: perform the given kind of data representation conversion operation on sub
+#define CATEGORY_LOCK 14 // address: grab a lock on the specified memory address
+#define CATEGORY_UNLOCK 15 // address: release a lock on the specified memory address
+#define CATEGORY_COND 16 // test, trueBranch, falseBranch: if the boolean data word test is true, run trueBranch; otherwise, run falseBranch
+#define CATEGORY_JUMP 17 // test, jumpTable...: use the value of test to index into the jumpTable SEQs and run the code contained there; test is guaranteed to be a valid index
+#define CATEGORY_WRITE 18 // source, address: write the source data to the specified destination memory address
+#define CATEGORY_COPY 19 // sourceAddress, destinationAddress: copy a length of memory bytes from sourceAddress to destinationAddress
+#define CATEGORY_SCHED 20 // label...: schedule all of the labels for execution
+#define CATEGORY_LOOP 21 // test, body: run the body SEQ for as long as the boolean test is true; the test is re-evaluated before every iteration, so the end of body is a back-edge to it
+#define CATEGORY_CATOP 22 // sub...: concatenate the text of all of the subs into a single string, which is sized once up front; the formats (CAT_FORMAT_ defines in constantDefs.h) specify how each sub is converted to text
+#define CATEGORY_RANGE 23 // count, address, body: run body once for every index from 0 up to (but not including) count, writing the index to address first; if the node is parallel, the iterations may run concurrently
+#define CATEGORY_BATCH 24 // stream, address, body: run body once for every element destreamed from the stream at stream, writing the element to address first; the node's ACCESS_ flags decide how batches may run
+#define CATEGORY_SLICE 25 // base, begin, end: a view of the elements from index begin up to (but not including) index end of the array (or view) at base, sharing its storage; the node's stride is the size of an element
+
+// definitions of read kinds, which tell what kind of register the read value belongs in
+#define READ_WORD 0
+#define READ_FLOAT 1
 
 // definitions of arithmetic operator kinds
 #define UNOP_NOT_BOOL 0
@@ -255,32 +83,10 @@ class OpTree : public IRTree {
 #define BINOP_MINUS_FLOAT 28
 #define BINOP_PLUS_STRING 29
 
-// usage: perform the given kind of unary operation on the subnode
-class UnOpTree : public OpTree {
-	public:
-		// data members
-		DataTree *subNode; // pointer to the data subnode that we're applying the operator to
-		// allocators/deallocators
-		UnOpTree(int kind, DataTree *subNode);
-		~UnOpTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
+#define UNOP_HASH_STRING 36
 
-// usage: perform the given kind of binary operation on subNodeLeft and subNodeRight
-class BinOpTree : public OpTree {
-	public:
-		// data members
-		DataTree *subNodeLeft; // pointer to the data subnode representing the left operand
-		DataTree *subNodeRight; // pointer to the data subnode representing the right operand
-		// allocators/deallocators
-		BinOpTree(int kind, DataTree *subNodeLeft, DataTree *subNodeRight);
-		~BinOpTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
+string opKindToString(int kind);
+uint64_t hashBytes(const vector<uint8_t> &data);
 
 // definitions of conversion operator kinds
 #define CONVOP_INT2FLOAT 30
@@ -291,131 +97,81 @@ class BinOpTree : public OpTree {
 #define CONVOP_FLOAT2STRING 34
 #define CONVOP_CHAR2STRING 35
 
-// usage: perform the given kind of data representation conversion operation on the specified subNode
-class ConvOpTree : public OpTree {
-	public:
-		// data members
-		DataTree *subNode; // pointer to the data subnode representing the source of the conversion
-		// allocators/deallocators
-		ConvOpTree(int kind, DataTree *subNode);
-		~ConvOpTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// CodeTree classes
-
-// usage: abstract class; never used directly
-class CodeTree : public IRTree {
-	public:
-		// allocators/deallocators
-		CodeTree(int category);
-		virtual ~CodeTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: grab a lock on the specified memory address
-class LockTree : public CodeTree {
-	public:
-		// data members
-		DataTree *address; // pointer to the data subnode specifying the memory address to lock
-		// allocators/deallocators
-		LockTree(DataTree *address);
-		~LockTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: release a lock on the specified memory address
-class UnlockTree : public CodeTree {
-	public:
-		// data members
-		DataTree *address; // pointer to the data subnode specifying the memory address to unlock
-		// allocators/deallocators
-		UnlockTree(DataTree *address);
-		~UnlockTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: if the boolean data word test is true, run trueBranch; otherwise, run falseBranch
-class CondTree : public CodeTree {
-	public:
-		// data members
-		DataTree *test; // pointer to the data subnode specifying the boolean value of the test condition
-		CodeTree *trueBranch; // pointer to the code tree to jump to on a true test value
-		CodeTree *falseBranch; // pointer to the code tree to jump to on a true test value
-		// allocators/deallocators
-		CondTree(DataTree *test, CodeTree *trueBranch, CodeTree *falseBranch);
-		~CondTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: use the value of a test word to index into the given jumpTable and jump to the code contained there; the test word is guaranteed to be a valid index into the jumpTable
-class JumpTree : public CodeTree {
-	public:
-		// data members
-		DataTree *test; // pointer to the data subnode specifying the value of the test condition
-		vector<SeqTree *> jumpTable; // vector of pointers to the sequential code trees to run for each index value
-		// allocators/deallocators
-		JumpTree(DataTree *test, const vector<SeqTree *> &jumpTable);
-		~JumpTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: write the source data to the specified destination memory address
-class WriteTree : public CodeTree {
-	public:
-		// data members
-		DataTree *source; // pointer to the source data subnode
-		DataTree *address; // pointer to the subnode specifying the destination memory address
-		// allocators/deallocators
-		WriteTree(DataTree *source, DataTree *address);
-		~WriteTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: copy a length of memory bytes from the specified sourceAddress to the specified destinationAddress
-class CopyTree : public CodeTree {
-	public:
-		// data members
-		DataTree *sourceAddress; // pointer to the data subnode specifying the base address to start copying from
-		DataTree *destinationAddress; // pointer to the data subnode specifying the destination address to copy into
-		uint32_t length;
-		// allocators/deallocators
-		CopyTree(DataTree *sourceAddress, DataTree *destinationAddress, uint32_t length);
-		~CopyTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
-};
-
-// usage: schedule all of the label nodes in the labelList for execution
-class SchedTree : public CodeTree {
-	public:
-		// data members
-		vector<LabelTree *> labelList; // vector of the label nodes to schedule
-		// allocators/deallocators
-		SchedTree(const vector<LabelTree *> &labelList);
-		~SchedTree();
-		// core methods
-		string toString(unsigned int tabDepth) const;
-		void asmDump(string &asmString) const;
+// definitions of concatenation operator kinds
+#define CATOP_STRING 37
+
+int catFormatConvKind(int format);
+int convKindCatFormat(int kind);
+
+// IRModule classes
+
+// IRModule serialization format
+#define IR_MODULE_MAGIC "ANIR"
+#define IR_MODULE_VERSION 7
+
+// usage: the intermediate code of a program in structure-of-arrays form; nodes are addressed by IRId, and every node field lives in a parallel array so that the whole module occupies a handful of contiguous allocations;
+// the semmer appends nodes as it types the program, and nodes may be shared among several consumers (operand layouts are listed with the CATEGORY_ defines above)
+class IRModule {
+	public:
+		// data members
+		vector<uint8_t> categories; // the category of each node (CATEGORY_ defines above)
+		vector<uint8_t> kinds; // the operator kind of each UNOP, BINOP, CONVOP, and CATOP node, and the read kind of each READ node; 0 for all other nodes
+		vector<uint32_t> operandStarts; // the index in operands of the first operand of each node
+		vector<uint32_t> operandCounts; // the number of operands of each node
+		vector<uint32_t> auxes; // per-node side table index: into words for WORD nodes, into arrayStarts for ARRAY nodes (and for the formats of CATOP nodes), into labelIds for LABEL nodes; the length of COPY nodes; the parallel flag of RANGE nodes; the access flags of BATCH nodes; the element stride of SLICE nodes
+		vector<IRId> operands; // the operand ids of all nodes, concatenated; NULL_IR_ID marks a missing subnode
+		vector<uint64_t> words; // side table of data word constants
+		vector<uint32_t> arrayStarts; // side table of the offsets of byte-array constants in bytes
+		vector<uint32_t> arrayLengths; // side table of the lengths of byte-array constants
+		vector<uint8_t> bytes; // the raw data of all byte-array constants, concatenated
+		vector<string> labelIds; // side table of label identifiers
+		IRId root; // the id of the root SCHED node
+		// allocators/deallocators
+		IRModule();
+		~IRModule();
+		// core methods
+		unsigned int size() const;
+		IRId addNode(int category, int kind, const vector<IRId> &operandList, uint32_t aux = 0);
+		IRId addWord(int category, uint64_t word);
+		IRId addWord(uint64_t word);
+		uint32_t addBytes(const vector<uint8_t> &data);
+		IRId addArray(const vector<uint8_t> &data);
+		IRId addCompound(const vector<IRId> &dataList);
+		IRId addSlice(IRId base, IRId begin, IRId end, uint32_t stride);
+		IRId addTemp(IRId opNode);
+		IRId addRead(IRId address, int kind = READ_WORD);
+		IRId addUnOp(int kind, IRId subNode);
+		IRId addBinOp(int kind, IRId subNodeLeft, IRId subNodeRight);
+		IRId addConvOp(int kind, IRId subNode);
+		IRId addCat(int kind, const vector<IRId> &operandList, const vector<uint8_t> &formats);
+		IRId addLabel(const string &id, IRId code);
+		IRId addSeq(const vector<IRId> &codeList);
+		IRId addLock(IRId address);
+		IRId addUnlock(IRId address);
+		IRId addCond(IRId test, IRId trueBranch, IRId falseBranch);
+		IRId addJump(IRId test, const vector<IRId> &jumpTable);
+		IRId addLoop(IRId test, IRId body);
+		IRId addRange(IRId count, IRId address, IRId body, bool parallel);
+		IRId addBatch(IRId stream, IRId address, IRId body, int access);
+		IRId addWrite(IRId source, IRId address);
+		IRId addCopy(IRId sourceAddress, IRId destinationAddress, uint32_t length);
+		IRId addSched(const vector<IRId> &labelList);
+		void setOperands(IRId id, const vector<IRId> &operandList);
+		IRId copyNode(const IRModule &source, IRId id, map<IRId, IRId> &copied);
+		void compact();
+		unsigned int reachableSize(IRId id) const;
+		IRId operand(IRId id, unsigned int index) const;
+		uint32_t operandSlot(IRId id, unsigned int index) const;
+		uint64_t word(IRId id) const;
+		vector<uint8_t> array(IRId id) const;
+		string toString(IRId id, unsigned int tabDepth = 1) const;
+		void serialize(string &acc) const;
+		bool deserialize(const string &data);
+		void asmDump(IRId id, string &asmString) const;
 };
 
 // main code generation function
 
-int gen(SchedTree *codeRoot, string &asmString);
+int gen(IRModule &codeModule, string &asmString);
 
 #endif
@@ -5,11 +5,13 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <map>
 #include <deque>
 #include <stack>
+#include <algorithm>
 
 #include <stdlib.h>
 #include <unistd.h>
@@ -17,6 +19,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <limits.h>
+#include <math.h>
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 
@@ -25,16 +28,24 @@ using std::cout;
 using std::cerr;
 using std::endl;
 using std::flush;
+using std::istream;
 using std::ifstream;
+using std::istringstream;
 using std::ofstream;
 using std::ostream;
 using std::string;
 using std::vector;
 using std::deque;
 using std::map;
+using std::multimap;
 using std::stack;
 using std::pair;
 using std::make_pair;
+using std::min;
+using std::find;
+using std::lower_bound;
+using std::upper_bound;
+using std::stable_sort;
 
 // class forward declarations
 
@@ -51,30 +62,11 @@ class MemberList;
 class ObjectType;
 class ErrorType;
 class TypeStatus;
-class IRTree;
-	class LabelTree;
-	class SeqTree;
-	class DataTree;
-		class WordTree8;
-		class WordTree16;
-		class WordTree32;
-		class WordTree64;
-		class ArrayTree;
-		class CompoundTree;
-		class TempTree;
-		class ReadTree;
-	class OpTree;
-		class UnOpTree;
-		class BinOpTree;
-		class ConvTree;
-	class CodeTree;
-		class LockTree;
-		class UnlockTree;
-		class CondTree;
-		class JumpTree;
-		class WriteTree;
-		class CopyTree;
-		class SchedTree;
+class IRModule;
+
+// identifier of an intermediate code node within an IRModule
+typedef uint32_t IRId;
+#define NULL_IR_ID 0xFFFFFFFF
 
 // global variable linkage specifiers
 
@@ -84,6 +76,9 @@ extern bool silentMode;
 extern bool codedOutput;
 extern int tabModulus;
 extern bool eventuallyGiveUp;
+extern bool parserProfile;
+extern bool benchmarkMode;
+extern string parseCacheDir;
 
 extern vector<string> inFileNames;
 
@@ -91,6 +86,7 @@ extern int driverErrorCode;
 extern int lexerErrorCode;
 extern int parserErrorCode;
 extern int semmerErrorCode;
+extern int opterErrorCode;
 extern int gennerErrorCode;
 
 extern Type *nullType;
@@ -122,11 +118,14 @@ extern ObjectType *stringCompOpType;
 extern StdType *stdLibType;
 extern SymbolTree *stdLib;
 
-extern IRTree *nopCode;
+extern IRModule *irModule;
+extern IRId nopCode;
 
 // global function forward declarations
 
 unsigned int getUniqueInt();
 string getUniqueId();
+uint64_t hashBytes(uint64_t hash, const uint8_t *bytes, size_t length);
+double getWallTime();
 
 #endif
@@ -75,7 +75,7 @@ string hex(unsigned char c) {
 }
 
 // discard input up until the end of the current token
-void discardToken(ifstream *in, char c, int &row, int &col, bool &done) {
+void discardToken(istream *in, char c, int &row, int &col, bool &done) {
 	for(;;) {
 		bool retVal = (in == NULL ? cin.get(c) : in->get(c));
 		// handle newline cursor logging properly
@@ -96,7 +96,7 @@ void discardToken(ifstream *in, char c, int &row, int &col, bool &done) {
 	}
 }
 
-vector<Token> *lex(ifstream *in, unsigned int fileIndex) {
+vector<Token> *lex(istream *in, unsigned int fileIndex) {
 
 	// initialize local error code
 	lexerErrorCode = 0;
@@ -25,7 +25,7 @@ class Token {
 		operator string() const;
 };
 
-vector<Token> *lex(ifstream *in, unsigned int fileIndex);
+vector<Token> *lex(istream *in, unsigned int fileIndex);
 
 // post-includes
 
@@ -0,0 +1,1413 @@
+#include "opter.h"
+
+#include "outputOperators.h"
+
+// opter-global variables
+
+int opterErrorCode;
+
+// ConstData functions
+ConstData::ConstData(int valueType, uint64_t word) : valueType(valueType), word(word) {}
+ConstData::ConstData(const vector<uint8_t> &array) : valueType(VALUE_STRING), word(0), array(array) {}
+ConstData::~ConstData() {}
+int64_t ConstData::intValue() const {
+	return (int64_t)word;
+}
+double ConstData::floatValue() const {
+	double value;
+	memcpy(&value, &word, sizeof(value));
+	return value;
+}
+void ConstData::setFloat(double value) {
+	valueType = VALUE_FLOAT;
+	memcpy(&word, &value, sizeof(value));
+}
+void ConstData::setString(const string &s) {
+	valueType = VALUE_STRING;
+	word = 0;
+	array.assign(s.begin(), s.end());
+}
+string ConstData::toString() const {
+	char tempS[MAX_FLOAT_STRING_LENGTH];
+	switch (valueType) {
+		case VALUE_BOOL:
+			return (word ? "true" : "false");
+		case VALUE_INT:
+			sprintf(tempS, "%" PRId64, intValue());
+			return tempS;
+		case VALUE_FLOAT:
+			sprintf(tempS, FLOAT_STRING_FORMAT, floatValue());
+			return tempS;
+		case VALUE_CHAR: {
+			string acc("\'");
+			acc += (char)word;
+			acc += '\'';
+			return acc;
+		}
+		case VALUE_STRING: {
+			string acc("\"");
+			acc += string(array.begin(), array.end());
+			acc += '\"';
+			return acc;
+		}
+		default:
+			sprintf(tempS, "0x%" PRIx64, word);
+			return tempS;
+	}
+}
+
+// constant evaluation functions
+
+// derives the data type of the result of the given kind of operation
+int opResultType(int kind) {
+	switch (kind) {
+		case UNOP_NOT_BOOL:
+		case BINOP_DOR_BOOL:
+		case BINOP_DAND_BOOL:
+		case BINOP_DEQUALS:
+		case BINOP_NEQUALS:
+		case BINOP_LT:
+		case BINOP_GT:
+		case BINOP_LE:
+		case BINOP_GE:
+			return VALUE_BOOL;
+		case BINOP_TIMES_FLOAT:
+		case BINOP_DIVIDE_FLOAT:
+		case BINOP_MOD_FLOAT:
+		case UNOP_MINUS_FLOAT:
+		case BINOP_PLUS_FLOAT:
+		case BINOP_MINUS_FLOAT:
+		case CONVOP_INT2FLOAT:
+			return VALUE_FLOAT;
+		case BINOP_PLUS_STRING:
+		case CONVOP_BOOL2STRING:
+		case CONVOP_INT2STRING:
+		case CONVOP_FLOAT2STRING:
+		case CONVOP_CHAR2STRING:
+		case CATOP_STRING:
+			return VALUE_STRING;
+		default: // all of the remaining operations produce integers
+			return VALUE_INT;
+	}
+}
+
+// derives the data type that the given kind of operation expects of its operands; comparisons accept any type, provided that both operands agree
+int opOperandType(int kind) {
+	switch (kind) {
+		case UNOP_NOT_BOOL:
+		case BINOP_DOR_BOOL:
+		case BINOP_DAND_BOOL:
+		case CONVOP_BOOL2STRING:
+			return VALUE_BOOL;
+		case BINOP_DEQUALS:
+		case BINOP_NEQUALS:
+		case BINOP_LT:
+		case BINOP_GT:
+		case BINOP_LE:
+		case BINOP_GE:
+			return VALUE_UNKNOWN;
+		case BINOP_TIMES_FLOAT:
+		case BINOP_DIVIDE_FLOAT:
+		case BINOP_MOD_FLOAT:
+		case UNOP_MINUS_FLOAT:
+		case BINOP_PLUS_FLOAT:
+		case BINOP_MINUS_FLOAT:
+		case CONVOP_FLOAT2INT:
+		case CONVOP_FLOAT2STRING:
+			return VALUE_FLOAT;
+		case BINOP_PLUS_STRING:
+			return VALUE_STRING;
+		case CONVOP_CHAR2STRING:
+			return VALUE_CHAR;
+		case UNOP_HASH_STRING:
+			return VALUE_STRING;
+		default: // all of the remaining operations consume integers
+			return VALUE_INT;
+	}
+}
+
+bool isComparison(int kind) {
+	return (kind >= BINOP_DEQUALS && kind <= BINOP_GE);
+}
+
+bool isCommutative(int kind) {
+	switch (kind) {
+		case BINOP_DOR_BOOL:
+		case BINOP_DAND_BOOL:
+		case BINOP_OR_INT:
+		case BINOP_XOR_INT:
+		case BINOP_AND_INT:
+		case BINOP_DEQUALS:
+		case BINOP_NEQUALS:
+		case BINOP_TIMES_INT:
+		case BINOP_TIMES_FLOAT:
+		case BINOP_PLUS_INT:
+		case BINOP_PLUS_FLOAT:
+			return true;
+		default:
+			return false;
+	}
+}
+
+bool foldUnOp(int kind, const ConstData &sub, ConstData &result) {
+	if (sub.valueType != opOperandType(kind)) { // if the operand isn't of the type that the operation expects, we can't know its run-time semantics
+		return false;
+	}
+	switch (kind) {
+		case UNOP_NOT_BOOL:
+			result = ConstData(VALUE_BOOL, sub.word ? 0 : 1);
+			return true;
+		case UNOP_COMPLEMENT_INT:
+			result = ConstData(VALUE_INT, ~(sub.word));
+			return true;
+		case UNOP_DPLUS_INT:
+			result = ConstData(VALUE_INT, sub.word + 1);
+			return true;
+		case UNOP_DMINUS_INT:
+			result = ConstData(VALUE_INT, sub.word - 1);
+			return true;
+		case UNOP_MINUS_INT:
+			result = ConstData(VALUE_INT, (uint64_t)0 - sub.word);
+			return true;
+		case UNOP_MINUS_FLOAT:
+			result.setFloat(-(sub.floatValue()));
+			return true;
+		case UNOP_HASH_STRING:
+			result = ConstData(VALUE_INT, hashBytes(sub.array));
+			return true;
+		default: // can't happen; the above should cover all cases
+			return false;
+	}
+}
+
+bool foldBinOp(int kind, const ConstData &left, const ConstData &right, ConstData &result) {
+	if (isComparison(kind)) { // if it's a comparison, the operands must agree in type
+		if (left.valueType == VALUE_UNKNOWN || left.valueType != right.valueType) {
+			return false;
+		}
+		int order; // -1, 0, or 1 if left is less than, equal to, or greater than right
+		bool unordered = false; // whether the comparison involves a float NaN
+		switch (left.valueType) {
+			case VALUE_INT:
+				order = (left.intValue() < right.intValue()) ? -1 : ((left.intValue() > right.intValue()) ? 1 : 0);
+				break;
+			case VALUE_FLOAT:
+				if (left.floatValue() < right.floatValue()) {
+					order = -1;
+				} else if (left.floatValue() > right.floatValue()) {
+					order = 1;
+				} else if (left.floatValue() == right.floatValue()) {
+					order = 0;
+				} else {
+					order = 0;
+					unordered = true;
+				}
+				break;
+			case VALUE_STRING:
+				order = (left.array < right.array) ? -1 : ((right.array < left.array) ? 1 : 0);
+				break;
+			default: // VALUE_BOOL and VALUE_CHAR compare as unsigned words
+				order = (left.word < right.word) ? -1 : ((left.word > right.word) ? 1 : 0);
+				break;
+		}
+		bool value;
+		switch (kind) {
+			case BINOP_DEQUALS:
+				value = !unordered && order == 0;
+				break;
+			case BINOP_NEQUALS:
+				value = unordered || order != 0;
+				break;
+			case BINOP_LT:
+				value = !unordered && order < 0;
+				break;
+			case BINOP_GT:
+				value = !unordered && order > 0;
+				break;
+			case BINOP_LE:
+				value = !unordered && order <= 0;
+				break;
+			default: /* case BINOP_GE: */
+				value = !unordered && order >= 0;
+				break;
+		}
+		result = ConstData(VALUE_BOOL, value ? 1 : 0);
+		return true;
+	}
+	// otherwise, it's an arithmetic operation, so both operands must be of the type that the operation expects
+	if (left.valueType != opOperandType(kind) || right.valueType != opOperandType(kind)) {
+		return false;
+	}
+	switch (kind) {
+		case BINOP_DOR_BOOL:
+			result = ConstData(VALUE_BOOL, (left.word || right.word) ? 1 : 0);
+			return true;
+		case BINOP_DAND_BOOL:
+			result = ConstData(VALUE_BOOL, (left.word && right.word) ? 1 : 0);
+			return true;
+		case BINOP_OR_INT:
+			result = ConstData(VALUE_INT, left.word | right.word);
+			return true;
+		case BINOP_XOR_INT:
+			result = ConstData(VALUE_INT, left.word ^ right.word);
+			return true;
+		case BINOP_AND_INT:
+			result = ConstData(VALUE_INT, left.word & right.word);
+			return true;
+		case BINOP_LS_INT:
+			if (right.intValue() < 0 || right.intValue() > 63) { // out-of-range shifts are machine-dependent
+				return false;
+			}
+			result = ConstData(VALUE_INT, left.word << right.word);
+			return true;
+		case BINOP_RS_INT:
+			if (right.intValue() < 0 || right.intValue() > 63) { // out-of-range shifts are machine-dependent
+				return false;
+			}
+			result = ConstData(VALUE_INT, (uint64_t)(left.intValue() >> right.word));
+			return true;
+		case BINOP_TIMES_INT:
+			result = ConstData(VALUE_INT, left.word * right.word);
+			return true;
+		case BINOP_DIVIDE_INT:
+		case BINOP_MOD_INT:
+			if (right.word == 0 || (left.word == ((uint64_t)1 << 63) && right.intValue() == -1)) { // leave the trap to run-time
+				return false;
+			}
+			result = ConstData(VALUE_INT, (uint64_t)((kind == BINOP_DIVIDE_INT) ? (left.intValue() / right.intValue()) : (left.intValue() % right.intValue())));
+			return true;
+		case BINOP_TIMES_FLOAT:
+			result.setFloat(left.floatValue() * right.floatValue());
+			return true;
+		case BINOP_DIVIDE_FLOAT:
+			result.setFloat(left.floatValue() / right.floatValue());
+			return true;
+		case BINOP_MOD_FLOAT:
+			result.setFloat(fmod(left.floatValue(), right.floatValue()));
+			return true;
+		case BINOP_PLUS_INT:
+			result = ConstData(VALUE_INT, left.word + right.word);
+			return true;
+		case BINOP_MINUS_INT:
+			result = ConstData(VALUE_INT, left.word - right.word);
+			return true;
+		case BINOP_PLUS_FLOAT:
+			result.setFloat(left.floatValue() + right.floatValue());
+			return true;
+		case BINOP_MINUS_FLOAT:
+			result.setFloat(left.floatValue() - right.floatValue());
+			return true;
+		case BINOP_PLUS_STRING: {
+			vector<uint8_t> acc(left.array);
+			acc.insert(acc.end(), right.array.begin(), right.array.end());
+			result = ConstData(acc);
+			return true;
+		}
+		default: // can't happen; the above should cover all cases
+			return false;
+	}
+}
+
+bool foldConvOp(int kind, const ConstData &sub, ConstData &result) {
+	if (sub.valueType != opOperandType(kind)) { // if the operand isn't of the type that the conversion expects, we can't know its run-time semantics
+		return false;
+	}
+	char tempS[MAX_FLOAT_STRING_LENGTH];
+	switch (kind) {
+		case CONVOP_INT2FLOAT:
+			result.setFloat((double)(sub.intValue()));
+			return true;
+		case CONVOP_FLOAT2INT: {
+			double value = sub.floatValue();
+			if (!(value >= -9223372036854775808.0 && value < 9223372036854775808.0)) { // NaN and out-of-range conversions are machine-dependent
+				return false;
+			}
+			result = ConstData(VALUE_INT, (uint64_t)((int64_t)value)); // truncates towards zero
+			return true;
+		}
+		case CONVOP_BOOL2STRING:
+			result.setString(sub.word ? "true" : "false");
+			return true;
+		case CONVOP_INT2STRING:
+			sprintf(tempS, "%" PRId64, sub.intValue());
+			result.setString(tempS);
+			return true;
+		case CONVOP_FLOAT2STRING:
+			sprintf(tempS, FLOAT_STRING_FORMAT, sub.floatValue());
+			result.setString(tempS);
+			return true;
+		case CONVOP_CHAR2STRING:
+			result.setString(string(1, (char)(sub.word)));
+			return true;
+		default: // can't happen; the above should cover all cases
+			return false;
+	}
+}
+
+// extracts the constant contained in the given data word or array node of module, interpreting it as the given data type
+bool getNodeConst(const IRModule &module, IRId id, int valueType, ConstData &data) {
+	if (id == NULL_IR_ID) {
+		return false;
+	}
+	switch (module.categories[id]) {
+		case CATEGORY_WORD8:
+		case CATEGORY_WORD16:
+		case CATEGORY_WORD32:
+		case CATEGORY_WORD64:
+			data = ConstData(valueType, module.word(id));
+			return true;
+		case CATEGORY_ARRAY:
+			data = ConstData(module.array(id));
+			return true;
+		default:
+			return false;
+	}
+}
+
+// operandType specifies the type of comparison operands, which can't be derived from the operation kind; the original node is left intact, since its operands may be shared
+IRId foldData(IRId id, int operandType) {
+	const IRModule &module = *irModule;
+	if (id == NULL_IR_ID || module.categories[id] != CATEGORY_TEMP) {
+		return id;
+	}
+	IRId opNode = module.operand(id, 0);
+	int kind = module.kinds[opNode];
+	if (!isComparison(kind)) {
+		operandType = opOperandType(kind);
+	}
+	ConstData sub, subRight, result;
+	bool folded = false;
+	switch (module.categories[opNode]) {
+		case CATEGORY_UNOP:
+			folded = getNodeConst(module, module.operand(opNode, 0), operandType, sub) && foldUnOp(kind, sub, result);
+			break;
+		case CATEGORY_BINOP:
+			folded = getNodeConst(module, module.operand(opNode, 0), operandType, sub) &&
+				getNodeConst(module, module.operand(opNode, 1), operandType, subRight) &&
+				foldBinOp(kind, sub, subRight, result);
+			break;
+		case CATEGORY_CONVOP:
+			folded = getNodeConst(module, module.operand(opNode, 0), operandType, sub) && foldConvOp(kind, sub, result);
+			break;
+		default: // can't happen; the above should cover all cases
+			break;
+	}
+	if (!folded) {
+		return id;
+	} else if (result.valueType == VALUE_STRING) {
+		return irModule->addArray(result.array);
+	} else {
+		return irModule->addWord(result.word);
+	}
+}
+
+// SsaValue functions
+SsaValue::SsaValue(int category, IRId origin) : category(category), kind(0), width(64), region(0), epoch(0), origin(origin), rewritten(false), live(true) {}
+SsaValue::~SsaValue() {}
+
+// SsaUse functions
+SsaUse::SsaUse(uint32_t slot, unsigned int value) : slot(slot), value(value) {}
+SsaUse::~SsaUse() {}
+
+// SsaBranch functions
+SsaBranch::SsaBranch(uint32_t slot, IRId cond, unsigned int test) : slot(slot), cond(cond), test(test) {}
+SsaBranch::~SsaBranch() {}
+
+// SsaFunction functions
+SsaFunction::SsaFunction(IRModule &module, IRId label) : module(module), label(label) {
+	regionParents.push_back(0); // region 0 is the root region, and is its own parent
+}
+SsaFunction::~SsaFunction() {}
+unsigned int SsaFunction::addValue(const SsaValue &value) {
+	values.push_back(value);
+	return (values.size() - 1);
+}
+unsigned int SsaFunction::resolve(unsigned int value) const {
+	while (values[value].category == SSA_COPY) {
+		value = values[value].operands[0];
+	}
+	return value;
+}
+bool SsaFunction::dominates(unsigned int regionOuter, unsigned int regionInner) const {
+	for(;;) {
+		if (regionInner == regionOuter) {
+			return true;
+		} else if (regionInner == 0) {
+			return false;
+		}
+		regionInner = regionParents[regionInner];
+	}
+}
+string SsaFunction::toString() const {
+	string acc(module.labelIds[module.auxes[label]]);
+	acc += ":\n";
+	for (unsigned int i = 0; i < values.size(); i++) {
+		const SsaValue &value = values[i];
+		if (!(value.live)) {
+			continue;
+		}
+		char tempS[MAX_INT_STRING_LENGTH+2];
+		sprintf(tempS, "\t%%%u = ", i);
+		acc += tempS;
+		switch (value.category) {
+			case SSA_CONST:
+			case SSA_ARRAY:
+				acc += value.data.toString();
+				break;
+			case SSA_COMPOUND:
+				acc += (value.origin != NULL_IR_ID && module.categories[value.origin] == CATEGORY_SLICE) ? "S" : "L";
+				break;
+			case SSA_READ:
+				acc += "R";
+				break;
+			case SSA_UNOP:
+			case SSA_BINOP:
+			case SSA_CONVOP:
+			case SSA_CATOP:
+				acc += opKindToString(value.kind);
+				break;
+			default: // SSA_OPAQUE; SSA_COPY values are never live
+				acc += "?";
+				break;
+		}
+		if (value.operands.size() > 0) {
+			acc += '(';
+			for (unsigned int j = 0; j < value.operands.size(); j++) {
+				sprintf(tempS, "%%%u", value.operands[j]);
+				acc += tempS;
+				if (value.category == SSA_CATOP && value.formats[j] != CAT_FORMAT_STRING) { // operands that the concatenation converts are tagged with the conversion
+					acc += ':';
+					acc += opKindToString(catFormatConvKind(value.formats[j]));
+				}
+				if (j + 1 != value.operands.size()) {
+					acc += ',';
+				}
+			}
+			acc += ')';
+		}
+		acc += '\n';
+	}
+	return acc;
+}
+
+// OptStats functions
+OptStats::OptStats() : folded(0), propagated(0), eliminated(0), reduced(0), dead(0), branches(0), fused(0) {}
+OptStats::~OptStats() {}
+unsigned int OptStats::changes() const {
+	return (folded + propagated + eliminated + reduced + dead + branches + fused);
+}
+
+// lowering functions
+
+// lowers the given data node into func, returning the index of the resulting value
+unsigned int lowerData(SsaFunction &func, IRId id, unsigned int region, unsigned int epoch) {
+	const IRModule &module = func.module;
+	SsaValue value(SSA_OPAQUE, id);
+	value.region = region;
+	value.epoch = epoch;
+	if (id != NULL_IR_ID) {
+		switch (module.categories[id]) {
+			case CATEGORY_WORD8:
+				value.category = SSA_CONST;
+				value.width = 8;
+				value.data.word = module.word(id);
+				break;
+			case CATEGORY_WORD16:
+				value.category = SSA_CONST;
+				value.width = 16;
+				value.data.word = module.word(id);
+				break;
+			case CATEGORY_WORD32:
+				value.category = SSA_CONST;
+				value.width = 32;
+				value.data.word = module.word(id);
+				break;
+			case CATEGORY_WORD64:
+				value.category = SSA_CONST;
+				value.width = 64;
+				value.data.word = module.word(id);
+				break;
+			case CATEGORY_ARRAY:
+				value.category = SSA_ARRAY;
+				value.data = ConstData(module.array(id));
+				break;
+			case CATEGORY_LIST: // the compound (or the view) itself is opaque, but its elements (or its base and bounds) are separately optimizable
+			case CATEGORY_SLICE:
+				value.category = SSA_COMPOUND;
+				for (unsigned int i = 0; i < module.operandCounts[id]; i++) {
+					unsigned int element = lowerData(func, module.operand(id, i), region, epoch);
+					value.operands.push_back(element);
+					func.uses.push_back(SsaUse(module.operandSlot(id, i), element));
+				}
+				break;
+			case CATEGORY_TEMP: {
+				IRId opNode = module.operand(id, 0);
+				value.kind = module.kinds[opNode];
+				if (module.categories[opNode] == CATEGORY_UNOP) {
+					value.category = SSA_UNOP;
+				} else if (module.categories[opNode] == CATEGORY_BINOP) {
+					value.category = SSA_BINOP;
+				} else if (module.categories[opNode] == CATEGORY_CONVOP) {
+					value.category = SSA_CONVOP;
+				} else if (module.categories[opNode] == CATEGORY_CATOP) {
+					value.category = SSA_CATOP;
+					value.formats = module.array(opNode);
+				}
+				if (value.category != SSA_OPAQUE) {
+					for (unsigned int i = 0; i < module.operandCounts[opNode]; i++) {
+						value.operands.push_back(lowerData(func, module.operand(opNode, i), region, epoch));
+					}
+				}
+				break;
+			}
+			case CATEGORY_READ:
+				value.category = SSA_READ;
+				value.kind = module.kinds[id];
+				value.operands.push_back(lowerData(func, module.operand(id, 0), region, epoch));
+				break;
+			default: // anything else is opaque to the optimizer
+				break;
+		}
+	}
+	return func.addValue(value);
+}
+
+// lowers the data node in the given operand slot into func and logs the slot as a use of the resulting value
+void lowerUse(SsaFunction &func, uint32_t slot, unsigned int region, unsigned int epoch) {
+	unsigned int value = lowerData(func, func.module.operands[slot], region, epoch);
+	func.uses.push_back(SsaUse(slot, value));
+}
+
+unsigned int addRegion(SsaFunction &func, unsigned int parent) {
+	func.regionParents.push_back(parent);
+	return (func.regionParents.size() - 1);
+}
+
+void lowerSeq(SsaFunction &func, IRId seq, unsigned int region, unsigned int &epoch);
+
+// lowers the code node in the given operand slot into func; epoch is advanced past every memory-modifying or control-flow-altering node
+void lowerCode(SsaFunction &func, uint32_t slot, unsigned int region, unsigned int &epoch) {
+	const IRModule &module = func.module;
+	IRId code = module.operands[slot];
+	if (code == NULL_IR_ID) {
+		return;
+	}
+	switch (module.categories[code]) {
+		case CATEGORY_LOCK:
+		case CATEGORY_UNLOCK:
+			lowerUse(func, module.operandSlot(code, 0), region, epoch);
+			epoch++;
+			break;
+		case CATEGORY_COND:
+			lowerUse(func, module.operandSlot(code, 0), region, epoch);
+			func.branches.push_back(SsaBranch(slot, code, func.uses.back().value));
+			epoch++;
+			lowerCode(func, module.operandSlot(code, 1), addRegion(func, region), epoch);
+			epoch++;
+			lowerCode(func, module.operandSlot(code, 2), addRegion(func, region), epoch);
+			epoch++;
+			break;
+		case CATEGORY_JUMP:
+			lowerUse(func, module.operandSlot(code, 0), region, epoch);
+			epoch++;
+			for (unsigned int i = 1; i < module.operandCounts[code]; i++) {
+				lowerSeq(func, module.operand(code, i), addRegion(func, region), epoch);
+				epoch++;
+			}
+			break;
+		case CATEGORY_WRITE:
+		case CATEGORY_COPY:
+			lowerUse(func, module.operandSlot(code, 0), region, epoch);
+			lowerUse(func, module.operandSlot(code, 1), region, epoch);
+			epoch++;
+			break;
+		case CATEGORY_SCHED: // the scheduled labels are lowered separately
+			epoch++;
+			break;
+		case CATEGORY_LOOP: { // the back-edge means that the test and body may observe the body's own writes, so they start a fresh epoch in a region of their own
+			epoch++;
+			unsigned int loopRegion = addRegion(func, region);
+			lowerUse(func, module.operandSlot(code, 0), loopRegion, epoch);
+			lowerSeq(func, module.operand(code, 1), loopRegion, epoch);
+			epoch++;
+			break;
+		}
+		case CATEGORY_RANGE: { // the count is evaluated once up front; the body is a loop like any other, with the index written before every iteration
+			lowerUse(func, module.operandSlot(code, 0), region, epoch);
+			epoch++;
+			unsigned int rangeRegion = addRegion(func, region);
+			lowerUse(func, module.operandSlot(code, 1), rangeRegion, epoch);
+			lowerSeq(func, module.operand(code, 2), rangeRegion, epoch);
+			epoch++;
+			break;
+		}
+		case CATEGORY_BATCH: { // like a range, except that the elements come from the stream rather than from a count
+			lowerUse(func, module.operandSlot(code, 0), region, epoch);
+			epoch++;
+			unsigned int batchRegion = addRegion(func, region);
+			lowerUse(func, module.operandSlot(code, 1), batchRegion, epoch);
+			lowerSeq(func, module.operand(code, 2), batchRegion, epoch);
+			epoch++;
+			break;
+		}
+		default: // CATEGORY_NOP; nothing to lower
+			break;
+	}
+}
+
+void lowerSeq(SsaFunction &func, IRId seq, unsigned int region, unsigned int &epoch) {
+	if (seq == NULL_IR_ID) {
+		return;
+	}
+	for (unsigned int i = 0; i < func.module.operandCounts[seq]; i++) {
+		lowerCode(func, func.module.operandSlot(seq, i), region, epoch);
+	}
+}
+
+// derives the data type of each value from the operations that produce and consume it
+void inferTypes(SsaFunction &func) {
+	// forward pass: operation results have the type that their operation produces
+	for (unsigned int i = 0; i < func.values.size(); i++) {
+		SsaValue &value = func.values[i];
+		if (value.category == SSA_UNOP || value.category == SSA_BINOP || value.category == SSA_CONVOP || value.category == SSA_CATOP) {
+			value.data.valueType = opResultType(value.kind);
+		} else if (value.category == SSA_ARRAY) {
+			value.data.valueType = VALUE_STRING;
+		}
+	}
+	// backward passes: untyped operands (i.e. raw data words) take on the type that their consumer expects of them
+	for (bool changed = true; changed;) {
+		changed = false;
+		for (unsigned int i = func.values.size(); i-- > 0;) {
+			SsaValue &value = func.values[i];
+			if (!(value.category == SSA_UNOP || value.category == SSA_BINOP || value.category == SSA_CONVOP || value.category == SSA_CATOP)) {
+				continue;
+			}
+			for (unsigned int j = 0; j < value.operands.size(); j++) {
+				SsaValue &operand = func.values[func.resolve(value.operands[j])];
+				int hint = opOperandType(value.kind);
+				if (value.category == SSA_CATOP) { // concatenation operands are of the type that their format converts from
+					hint = (value.formats[j] == CAT_FORMAT_STRING) ? VALUE_STRING : opOperandType(catFormatConvKind(value.formats[j]));
+				} else if (isComparison(value.kind)) { // comparison operands take on the type of their counterpart
+					hint = func.values[func.resolve(value.operands[1-j])].data.valueType;
+				}
+				if (hint != VALUE_UNKNOWN && operand.data.valueType == VALUE_UNKNOWN) {
+					operand.data.valueType = hint;
+					changed = true;
+				}
+			}
+		}
+		for (vector<SsaBranch>::const_iterator iter = func.branches.begin(); iter != func.branches.end(); iter++) {
+			SsaValue &test = func.values[func.resolve((*iter).test)];
+			if (test.data.valueType == VALUE_UNKNOWN) {
+				test.data.valueType = VALUE_BOOL;
+				changed = true;
+			}
+		}
+	}
+}
+
+// optimization pass helpers
+
+// returns whether the given value is a constant data word, storing the constant into data
+bool getConst(const SsaFunction &func, unsigned int value, ConstData &data) {
+	const SsaValue &resolved = func.values[func.resolve(value)];
+	if (resolved.category == SSA_CONST) {
+		data = resolved.data;
+		return true;
+	}
+	return false;
+}
+
+// replaces the given value with a copy of source
+void makeCopy(SsaFunction &func, unsigned int value, unsigned int source) {
+	SsaValue &dest = func.values[value];
+	dest.category = SSA_COPY;
+	dest.operands.clear();
+	dest.operands.push_back(source);
+	dest.rewritten = true;
+}
+
+// replaces the given value with a constant data word
+void makeConst(SsaFunction &func, unsigned int value, const ConstData &data) {
+	SsaValue &dest = func.values[value];
+	dest.category = (data.valueType == VALUE_STRING) ? SSA_ARRAY : SSA_CONST;
+	dest.data = data;
+	dest.width = 64;
+	dest.operands.clear();
+	dest.rewritten = true;
+}
+
+// replaces the given value with a different operation on the given operands
+void makeOp(SsaFunction &func, unsigned int value, int category, int kind, unsigned int left, unsigned int right = 0) {
+	SsaValue &dest = func.values[value];
+	dest.category = category;
+	dest.kind = kind;
+	dest.operands.clear();
+	dest.operands.push_back(left);
+	if (category == SSA_BINOP) {
+		dest.operands.push_back(right);
+	}
+	dest.rewritten = true;
+}
+
+// appends a new constant data word (or byte array, for strings) to func, computed at the same point as the given value
+unsigned int addConst(SsaFunction &func, unsigned int value, const ConstData &data) {
+	SsaValue newValue((data.valueType == VALUE_STRING) ? SSA_ARRAY : SSA_CONST);
+	newValue.data = data;
+	newValue.region = func.values[value].region;
+	newValue.epoch = func.values[value].epoch;
+	newValue.rewritten = true;
+	return func.addValue(newValue);
+}
+
+// optimization passes
+
+bool foldConstants(SsaFunction &func, OptStats &stats) {
+	bool changed = false;
+	for (unsigned int i = 0; i < func.values.size(); i++) {
+		int category = func.values[i].category;
+		if (!(category == SSA_UNOP || category == SSA_BINOP || category == SSA_CONVOP)) {
+			continue;
+		}
+		// collect the constant operands, if they're all constant
+		vector<ConstData> operands;
+		for (unsigned int j = 0; j < func.values[i].operands.size(); j++) {
+			const SsaValue &operand = func.values[func.resolve(func.values[i].operands[j])];
+			if (operand.category == SSA_CONST || operand.category == SSA_ARRAY) {
+				operands.push_back(operand.data);
+			}
+		}
+		if (operands.size() != func.values[i].operands.size()) {
+			continue;
+		}
+		// attempt to evaluate the operation
+		ConstData result;
+		bool folded;
+		if (category == SSA_UNOP) {
+			folded = foldUnOp(func.values[i].kind, operands[0], result);
+		} else if (category == SSA_BINOP) {
+			folded = foldBinOp(func.values[i].kind, operands[0], operands[1], result);
+		} else /* if (category == SSA_CONVOP) */ {
+			folded = foldConvOp(func.values[i].kind, operands[0], result);
+		}
+		if (folded) {
+			makeConst(func, i, result);
+			stats.folded++;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+bool propagateCopies(SsaFunction &func, OptStats &stats) {
+	bool changed = false;
+	for (unsigned int i = 0; i < func.values.size(); i++) {
+		if (func.values[i].category == SSA_COPY) {
+			continue;
+		}
+		for (unsigned int j = 0; j < func.values[i].operands.size(); j++) {
+			unsigned int &operand = func.values[i].operands[j];
+			unsigned int resolved = func.resolve(operand);
+			if (resolved != operand) {
+				operand = resolved;
+				stats.propagated++;
+				changed = true;
+			}
+		}
+	}
+	for (vector<SsaUse>::iterator iter = func.uses.begin(); iter != func.uses.end(); iter++) {
+		(*iter).value = func.resolve((*iter).value);
+	}
+	for (vector<SsaBranch>::iterator iter = func.branches.begin(); iter != func.branches.end(); iter++) {
+		(*iter).test = func.resolve((*iter).test);
+	}
+	return changed;
+}
+
+// derives the key under which the given value is considered available to later equivalent computations
+string valueKey(const SsaFunction &func, unsigned int value) {
+	const SsaValue &keyValue = func.values[value];
+	char tempS[MAX_INT_STRING_LENGTH+2];
+	vector<string> operandKeys;
+	for (unsigned int i = 0; i < keyValue.operands.size(); i++) {
+		unsigned int operand = func.resolve(keyValue.operands[i]);
+		if (func.values[operand].category == SSA_CONST) { // constant operands are equivalent by content rather than by identity
+			sprintf(tempS, "#%" PRIx64, func.values[operand].data.word);
+		} else {
+			sprintf(tempS, "%u", operand);
+		}
+		operandKeys.push_back(tempS);
+	}
+	if (keyValue.category == SSA_BINOP && isCommutative(keyValue.kind) && operandKeys[1] < operandKeys[0]) { // commutative operands are equivalent in either order
+		operandKeys[0].swap(operandKeys[1]);
+	}
+	sprintf(tempS, "%d.%d", keyValue.category, keyValue.kind);
+	string acc(tempS);
+	for (unsigned int i = 0; i < operandKeys.size(); i++) {
+		acc += ',';
+		acc += operandKeys[i];
+	}
+	if (keyValue.category == SSA_READ) { // memory reads are only equivalent if no memory could have been modified in between
+		sprintf(tempS, "@%u", keyValue.epoch);
+		acc += tempS;
+	}
+	return acc;
+}
+
+bool eliminateCommonSubexpressions(SsaFunction &func, OptStats &stats) {
+	bool changed = false;
+	map<string, vector<unsigned int> > available; // map of value keys to the values computing them
+	for (unsigned int i = 0; i < func.values.size(); i++) {
+		int category = func.values[i].category;
+		if (!(category == SSA_UNOP || category == SSA_BINOP || category == SSA_CONVOP || category == SSA_READ)) {
+			continue;
+		}
+		vector<unsigned int> &candidates = available[valueKey(func, i)];
+		bool replaced = false;
+		for (vector<unsigned int>::const_iterator iter = candidates.begin(); iter != candidates.end(); iter++) {
+			if (func.dominates(func.values[*iter].region, func.values[i].region)) { // if the earlier computation is guaranteed to have run, reuse it
+				makeCopy(func, i, *iter);
+				stats.eliminated++;
+				changed = true;
+				replaced = true;
+				break;
+			}
+		}
+		if (!replaced) {
+			candidates.push_back(i);
+		}
+	}
+	return changed;
+}
+
+// returns the base-2 logarithm of the given word if it's a power of two, or -1 otherwise
+int log2Word(uint64_t word) {
+	if (word == 0 || (word & (word - 1)) != 0) {
+		return -1;
+	}
+	int acc = 0;
+	while (word >>= 1) {
+		acc++;
+	}
+	return acc;
+}
+
+// returns whether evaluating the given value might trap at run-time (a division by zero, or a read the optimizer can't see through), in which case a rule that discards it would lose the trap
+bool canTrap(const SsaFunction &func, unsigned int value) {
+	value = func.resolve(value);
+	const SsaValue &cur = func.values[value];
+	switch (cur.category) {
+		case SSA_CONST:
+		case SSA_ARRAY:
+			return false;
+		case SSA_READ: { // reads of fixed slots are always in bounds, but computed addresses might not be
+			ConstData address;
+			if (!getConst(func, cur.operands[0], address)) {
+				return true;
+			}
+			break;
+		}
+		case SSA_BINOP:
+			if (cur.kind == BINOP_DIVIDE_INT || cur.kind == BINOP_MOD_INT) { // only a constant divisor other than 0 and -1 rules out a trap
+				ConstData divisor;
+				if (!getConst(func, cur.operands[1], divisor) || divisor.word == 0 || divisor.intValue() == -1) {
+					return true;
+				}
+			}
+			break;
+		case SSA_UNOP:
+		case SSA_CONVOP:
+		case SSA_CATOP:
+		case SSA_COMPOUND:
+			break;
+		default: // SSA_OPAQUE; we can't tell what it does
+			return true;
+	}
+	for (vector<unsigned int>::const_iterator iter = cur.operands.begin(); iter != cur.operands.end(); iter++) {
+		if (canTrap(func, *iter)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool reduceStrength(SsaFunction &func, OptStats &stats) {
+	bool changed = false;
+	for (unsigned int i = 0; i < func.values.size(); i++) {
+		int category = func.values[i].category;
+		int kind = func.values[i].kind;
+		if (category == SSA_UNOP) {
+			// involutions: --x, ~~x, and !!x are just x
+			unsigned int sub = func.resolve(func.values[i].operands[0]);
+			const SsaValue &subValue = func.values[sub];
+			if (subValue.category == SSA_UNOP && subValue.kind == kind &&
+					(kind == UNOP_NOT_BOOL || kind == UNOP_COMPLEMENT_INT || kind == UNOP_MINUS_INT || kind == UNOP_MINUS_FLOAT)) {
+				makeCopy(func, i, func.resolve(subValue.operands[0]));
+				stats.reduced++;
+				changed = true;
+			}
+			continue;
+		} else if (category != SSA_BINOP) {
+			continue;
+		}
+		unsigned int left = func.resolve(func.values[i].operands[0]);
+		unsigned int right = func.resolve(func.values[i].operands[1]);
+		ConstData leftConst, rightConst;
+		bool leftIsConst = getConst(func, left, leftConst) && leftConst.valueType == opOperandType(kind);
+		bool rightIsConst = getConst(func, right, rightConst) && rightConst.valueType == opOperandType(kind);
+		// for commutative operations, canonicalize any constant operand to the right
+		if (leftIsConst && !rightIsConst && isCommutative(kind)) {
+			unsigned int temp = left; left = right; right = temp;
+			ConstData tempConst = leftConst; leftConst = rightConst; rightConst = tempConst;
+			leftIsConst = false; rightIsConst = true;
+		}
+		// rules whose result doesn't depend on x may only drop x if evaluating it can't trap; otherwise x is left in place so that it still runs
+		bool discardable = !canTrap(func, left);
+		bool reduced = true;
+		switch (kind) {
+			case BINOP_TIMES_INT:
+				if (rightIsConst && rightConst.word == 0 && discardable) { // x * 0 = 0
+					makeConst(func, i, ConstData(VALUE_INT, 0));
+				} else if (rightIsConst && rightConst.word == 1) { // x * 1 = x
+					makeCopy(func, i, left);
+				} else if (rightIsConst && rightConst.intValue() == -1) { // x * -1 = -x
+					makeOp(func, i, SSA_UNOP, UNOP_MINUS_INT, left);
+				} else if (rightIsConst && log2Word(rightConst.word) > 0) { // x * 2^k = x << k
+					makeOp(func, i, SSA_BINOP, BINOP_LS_INT, left, addConst(func, i, ConstData(VALUE_INT, log2Word(rightConst.word))));
+				} else {
+					reduced = false;
+				}
+				break;
+			case BINOP_DIVIDE_INT:
+				if (rightIsConst && rightConst.word == 1) { // x / 1 = x
+					makeCopy(func, i, left);
+				} else {
+					reduced = false;
+				}
+				break;
+			case BINOP_MOD_INT:
+				if (rightIsConst && rightConst.word == 1 && discardable) { // x % 1 = 0
+					makeConst(func, i, ConstData(VALUE_INT, 0));
+				} else {
+					reduced = false;
+				}
+				break;
+			case BINOP_PLUS_INT:
+			case BINOP_OR_INT:
+			case BINOP_XOR_INT:
+			case BINOP_LS_INT:
+			case BINOP_RS_INT:
+			case BINOP_MINUS_INT:
+				if (rightIsConst && rightConst.word == 0) { // x + 0 = x | 0 = x ^ 0 = x << 0 = x >> 0 = x - 0 = x
+					makeCopy(func, i, left);
+				} else if (left == right && (kind == BINOP_XOR_INT || kind == BINOP_MINUS_INT) && discardable) { // x ^ x = x - x = 0
+					makeConst(func, i, ConstData(VALUE_INT, 0));
+				} else if (left == right && kind == BINOP_OR_INT) { // x | x = x
+					makeCopy(func, i, left);
+				} else {
+					reduced = false;
+				}
+				break;
+			case BINOP_AND_INT:
+				if (rightIsConst && rightConst.word == 0 && discardable) { // x & 0 = 0
+					makeConst(func, i, ConstData(VALUE_INT, 0));
+				} else if ((rightIsConst && rightConst.intValue() == -1) || left == right) { // x & ~0 = x & x = x
+					makeCopy(func, i, left);
+				} else {
+					reduced = false;
+				}
+				break;
+			case BINOP_TIMES_FLOAT:
+				if (rightIsConst && rightConst.floatValue() == 1.0) { // x * 1.0 = x
+					makeCopy(func, i, left);
+				} else if (rightIsConst && rightConst.floatValue() == 2.0) { // x * 2.0 = x + x
+					makeOp(func, i, SSA_BINOP, BINOP_PLUS_FLOAT, left, left);
+				} else {
+					reduced = false;
+				}
+				break;
+			case BINOP_DIVIDE_FLOAT: {
+				int exponent;
+				double reciprocal = rightIsConst ? 1.0 / rightConst.floatValue() : 0.0;
+				if (rightIsConst && rightConst.floatValue() == 1.0) { // x / 1.0 = x
+					makeCopy(func, i, left);
+				} else if (rightIsConst && frexp(fabs(rightConst.floatValue()), &exponent) == 0.5 &&
+						reciprocal != 0.0 && reciprocal * rightConst.floatValue() == 1.0) { // x / 2^k = x * 2^-k, provided that 2^-k is exactly representable
+					ConstData reciprocalConst;
+					reciprocalConst.setFloat(reciprocal);
+					makeOp(func, i, SSA_BINOP, BINOP_TIMES_FLOAT, left, addConst(func, i, reciprocalConst));
+				} else {
+					reduced = false;
+				}
+				break;
+			}
+			case BINOP_PLUS_FLOAT:
+			case BINOP_MINUS_FLOAT: {
+				// x + -0.0 = x - +0.0 = x, even for signed zeroes and NaNs
+				uint64_t identityWord = (kind == BINOP_PLUS_FLOAT) ? ((uint64_t)1 << 63) : 0;
+				if (rightIsConst && rightConst.word == identityWord) {
+					makeCopy(func, i, left);
+				} else {
+					reduced = false;
+				}
+				break;
+			}
+			case BINOP_DAND_BOOL:
+			case BINOP_DOR_BOOL:
+				if (rightIsConst && (rightConst.word != 0) == (kind == BINOP_DAND_BOOL)) { // x && true = x || false = x
+					makeCopy(func, i, left);
+				} else if (rightIsConst && discardable) { // x && false = false, x || true = true
+					makeConst(func, i, ConstData(VALUE_BOOL, (kind == BINOP_DOR_BOOL) ? 1 : 0));
+				} else if (left == right) { // x && x = x || x = x
+					makeCopy(func, i, left);
+				} else {
+					reduced = false;
+				}
+				break;
+			default: // comparisons of a value against itself are resolvable unless the value might be a float NaN
+				if (isComparison(kind) && left == right && discardable &&
+						func.values[left].data.valueType != VALUE_UNKNOWN && func.values[left].data.valueType != VALUE_FLOAT) {
+					bool reflexive = (kind == BINOP_DEQUALS || kind == BINOP_LE || kind == BINOP_GE);
+					makeConst(func, i, ConstData(VALUE_BOOL, reflexive ? 1 : 0));
+				} else {
+					reduced = false;
+				}
+				break;
+		}
+		if (reduced) {
+			stats.reduced++;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+bool eliminateDeadCode(SsaFunction &func, OptStats &stats) {
+	// mark all values reachable from the code trees as live
+	vector<bool> live(func.values.size(), false);
+	vector<unsigned int> workList;
+	for (vector<SsaUse>::const_iterator iter = func.uses.begin(); iter != func.uses.end(); iter++) {
+		workList.push_back(func.resolve((*iter).value));
+	}
+	for (vector<SsaBranch>::const_iterator iter = func.branches.begin(); iter != func.branches.end(); iter++) {
+		workList.push_back(func.resolve((*iter).test));
+	}
+	while (!workList.empty()) {
+		unsigned int cur = workList.back();
+		workList.pop_back();
+		if (live[cur]) {
+			continue;
+		}
+		live[cur] = true;
+		for (vector<unsigned int>::const_iterator iter = func.values[cur].operands.begin(); iter != func.values[cur].operands.end(); iter++) {
+			workList.push_back(func.resolve(*iter));
+		}
+	}
+	// then, log the values that have died since the last pass
+	bool changed = false;
+	for (unsigned int i = 0; i < func.values.size(); i++) {
+		if (func.values[i].live && !live[i]) {
+			stats.dead++;
+			changed = true;
+		}
+		func.values[i].live = live[i];
+	}
+	return changed;
+}
+
+// collects the parts of the concatenation computed by the given value into parts and formats, absorbing the single-use string operations that feed it
+// returns the number of operations absorbed, which are marked in absorbed
+unsigned int expandConcat(const SsaFunction &func, unsigned int value, const vector<unsigned int> &useCounts, vector<bool> &absorbed, vector<unsigned int> &parts, vector<uint8_t> &formats) {
+	unsigned int numAbsorbed = 0;
+	const SsaValue &cur = func.values[value];
+	for (unsigned int i = 0; i < cur.operands.size(); i++) {
+		unsigned int operand = func.resolve(cur.operands[i]);
+		int format = (cur.category == SSA_CATOP) ? cur.formats[i] : CAT_FORMAT_STRING;
+		const SsaValue &sub = func.values[operand];
+		if (format == CAT_FORMAT_STRING && useCounts[operand] == 1) {
+			if ((sub.category == SSA_BINOP && sub.kind == BINOP_PLUS_STRING) || sub.category == SSA_CATOP) { // a nested concatenation; splice in its parts
+				absorbed[operand] = true;
+				numAbsorbed += 1 + expandConcat(func, operand, useCounts, absorbed, parts, formats);
+				continue;
+			} else if (sub.category == SSA_CONVOP && convKindCatFormat(sub.kind) != CAT_FORMAT_STRING) { // a conversion to string; format its source in place
+				parts.push_back(sub.operands[0]);
+				formats.push_back(convKindCatFormat(sub.kind));
+				numAbsorbed++;
+				continue;
+			}
+		}
+		parts.push_back(cur.operands[i]);
+		formats.push_back(format);
+	}
+	return numAbsorbed;
+}
+
+// flattens trees of string concatenations and conversions into single n-ary concatenations, so that the result can be sized and formatted in one go
+bool fuseConcatenations(SsaFunction &func, OptStats &stats) {
+	// count the uses of every live value; only values used exactly once can be absorbed into their consumer
+	vector<unsigned int> useCounts(func.values.size(), 0);
+	for (unsigned int i = 0; i < func.values.size(); i++) {
+		if (!func.values[i].live) {
+			continue;
+		}
+		for (vector<unsigned int>::const_iterator iter = func.values[i].operands.begin(); iter != func.values[i].operands.end(); iter++) {
+			useCounts[func.resolve(*iter)]++;
+		}
+	}
+	for (vector<SsaUse>::const_iterator iter = func.uses.begin(); iter != func.uses.end(); iter++) {
+		useCounts[func.resolve((*iter).value)]++;
+	}
+	for (vector<SsaBranch>::const_iterator iter = func.branches.begin(); iter != func.branches.end(); iter++) {
+		useCounts[func.resolve((*iter).test)]++;
+	}
+	// consumers always follow their operands, so scanning backwards fuses every chain from its outermost operation inwards
+	bool changed = false;
+	vector<bool> absorbed(func.values.size(), false);
+	for (unsigned int i = func.values.size(); i-- > 0;) {
+		const SsaValue &cur = func.values[i];
+		if (!cur.live || absorbed[i] || !((cur.category == SSA_BINOP && cur.kind == BINOP_PLUS_STRING) || cur.category == SSA_CATOP)) {
+			continue;
+		}
+		vector<unsigned int> parts;
+		vector<uint8_t> formats;
+		unsigned int numAbsorbed = expandConcat(func, i, useCounts, absorbed, parts, formats);
+		if (numAbsorbed == 0) {
+			continue;
+		}
+		// merge runs of constant parts into single strings, and drop the empty ones
+		vector<unsigned int> mergedParts;
+		vector<uint8_t> mergedFormats;
+		for (unsigned int j = 0; j < parts.size(); j++) {
+			const SsaValue &resolved = func.values[func.resolve(parts[j])];
+			ConstData part;
+			if (resolved.category == SSA_ARRAY) {
+				part = resolved.data;
+			} else if (resolved.category == SSA_CONST && formats[j] != CAT_FORMAT_STRING && !foldConvOp(catFormatConvKind(formats[j]), resolved.data, part)) {
+				part = ConstData();
+			}
+			if (part.valueType != VALUE_STRING) { // not a constant; keep it as a run-time part
+				mergedParts.push_back(parts[j]);
+				mergedFormats.push_back(formats[j]);
+				continue;
+			}
+			if (part.array.empty()) {
+				continue;
+			}
+			if (!mergedParts.empty() && mergedFormats.back() == CAT_FORMAT_STRING && func.values[func.resolve(mergedParts.back())].category == SSA_ARRAY) {
+				ConstData prev = func.values[func.resolve(mergedParts.back())].data;
+				prev.array.insert(prev.array.end(), part.array.begin(), part.array.end());
+				mergedParts.back() = addConst(func, i, prev);
+			} else if (formats[j] == CAT_FORMAT_STRING) {
+				mergedParts.push_back(parts[j]);
+				mergedFormats.push_back(CAT_FORMAT_STRING);
+			} else {
+				mergedParts.push_back(addConst(func, i, part));
+				mergedFormats.push_back(CAT_FORMAT_STRING);
+			}
+		}
+		// rewrite the outermost operation as the fused concatenation, or as a plain copy if it came down to a single string
+		absorbed.resize(func.values.size(), false);
+		useCounts.resize(func.values.size(), 0);
+		stats.fused += numAbsorbed;
+		changed = true;
+		if (mergedParts.size() == 1 && mergedFormats[0] == CAT_FORMAT_STRING) {
+			makeCopy(func, i, mergedParts[0]);
+			continue;
+		}
+		SsaValue &dest = func.values[i];
+		dest.category = SSA_CATOP;
+		dest.kind = CATOP_STRING;
+		dest.operands = mergedParts;
+		dest.formats = mergedFormats;
+		dest.data.valueType = VALUE_STRING;
+		dest.rewritten = true;
+	}
+	return changed;
+}
+
+// raising functions
+
+// appends a fresh data word node of the given width to module
+IRId newWordNode(IRModule &module, unsigned int width, uint64_t word) {
+	switch (width) {
+		case 8:
+			return module.addWord(CATEGORY_WORD8, (uint8_t)word);
+		case 16:
+			return module.addWord(CATEGORY_WORD16, (uint16_t)word);
+		case 32:
+			return module.addWord(CATEGORY_WORD32, (uint32_t)word);
+		default:
+			return module.addWord(CATEGORY_WORD64, word);
+	}
+}
+
+// returns whether the operands of the given node are exactly the given ids
+bool sameOperands(const IRModule &module, IRId id, const vector<IRId> &operandList) {
+	if (module.operandCounts[id] != operandList.size()) {
+		return false;
+	}
+	for (unsigned int i = 0; i < operandList.size(); i++) {
+		if (module.operand(id, i) != operandList[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// returns a data node computing the given value, reusing the value's original node if it's still valid
+IRId raiseData(SsaFunction &func, unsigned int value, vector<IRId> &raised, vector<bool> &done) {
+	value = func.resolve(value);
+	if (done[value]) {
+		return raised[value];
+	}
+	IRModule &module = func.module;
+	const SsaValue &cur = func.values[value];
+	bool fresh = (cur.rewritten || cur.origin == NULL_IR_ID); // whether the original node can't be reused as-is
+	IRId acc = cur.origin;
+	switch (cur.category) {
+		case SSA_CONST:
+			if (fresh) {
+				acc = newWordNode(module, cur.width, cur.data.word);
+			}
+			break;
+		case SSA_ARRAY:
+			if (fresh) {
+				acc = module.addArray(cur.data.array);
+			}
+			break;
+		case SSA_UNOP:
+		case SSA_BINOP:
+		case SSA_CONVOP: {
+			vector<IRId> operandList;
+			for (unsigned int i = 0; i < cur.operands.size(); i++) {
+				operandList.push_back(raiseData(func, cur.operands[i], raised, done));
+			}
+			if (fresh || !sameOperands(module, module.operand(cur.origin, 0), operandList)) {
+				int category = (cur.category == SSA_UNOP) ? CATEGORY_UNOP : ((cur.category == SSA_BINOP) ? CATEGORY_BINOP : CATEGORY_CONVOP);
+				acc = module.addNode(CATEGORY_TEMP, 0, vector<IRId>(1, module.addNode(category, cur.kind, operandList)));
+			}
+			break;
+		}
+		case SSA_CATOP: {
+			vector<IRId> operandList;
+			for (unsigned int i = 0; i < cur.operands.size(); i++) {
+				operandList.push_back(raiseData(func, cur.operands[i], raised, done));
+			}
+			if (fresh || !sameOperands(module, module.operand(cur.origin, 0), operandList)) {
+				acc = module.addNode(CATEGORY_TEMP, 0, vector<IRId>(1, module.addCat(cur.kind, operandList, cur.formats)));
+			}
+			break;
+		}
+		case SSA_READ: {
+			vector<IRId> operandList(1, raiseData(func, cur.operands[0], raised, done));
+			if (fresh || !sameOperands(module, cur.origin, operandList)) {
+				acc = module.addNode(CATEGORY_READ, cur.kind, operandList);
+			}
+			break;
+		}
+		default: // SSA_OPAQUE and SSA_COMPOUND values are kept as-is; compound elements are patched in place through their uses
+			break;
+	}
+	raised[value] = acc;
+	done[value] = true;
+	return acc;
+}
+
+// writes the optimized form of func back into the module that it was lowered from; nodes are never modified in place, only the operand slots of the using nodes are redirected
+void raiseFunction(SsaFunction &func, OptStats &stats) {
+	IRModule &module = func.module;
+	vector<IRId> raised(func.values.size(), NULL_IR_ID);
+	vector<bool> done(func.values.size(), false);
+	for (vector<SsaUse>::const_iterator iter = func.uses.begin(); iter != func.uses.end(); iter++) {
+		IRId acc = raiseData(func, (*iter).value, raised, done);
+		module.operands[(*iter).slot] = acc;
+	}
+	// resolve constant branches, innermost first so that the slots of nested branches are patched before their parents are spliced out
+	IRId nopNode = NULL_IR_ID;
+	for (vector<SsaBranch>::reverse_iterator iter = func.branches.rbegin(); iter != func.branches.rend(); iter++) {
+		ConstData test;
+		if (getConst(func, (*iter).test, test)) {
+			IRId taken = module.operand((*iter).cond, test.word ? 1 : 2);
+			if (taken == NULL_IR_ID) {
+				if (nopNode == NULL_IR_ID) {
+					nopNode = module.addNode(CATEGORY_NOP, 0, vector<IRId>());
+				}
+				taken = nopNode;
+			}
+			module.operands[(*iter).slot] = taken;
+			stats.branches++;
+		}
+	}
+}
+
+// runs the optimization passes selected by the optimization level over func
+void optimizeFunction(SsaFunction &func, OptStats &stats) {
+	inferTypes(func);
+	for (unsigned int passes = 0; passes < MAX_OPTIMIZATION_PASSES; passes++) {
+		bool changed = false;
+		if (foldConstants(func, stats)) {
+			changed = true;
+		}
+		if (optimizationLevel >= OPTIMIZATION_LEVEL_REDUCE) {
+			if (reduceStrength(func, stats)) {
+				changed = true;
+				foldConstants(func, stats); // strength reduction may expose new constants
+			}
+			if (eliminateCommonSubexpressions(func, stats)) {
+				changed = true;
+			}
+		}
+		if (propagateCopies(func, stats)) {
+			changed = true;
+		}
+		if (!changed || optimizationLevel < OPTIMIZATION_LEVEL_FIXPOINT) { // only the highest level iterates to a fixed point
+			break;
+		}
+	}
+	eliminateDeadCode(func, stats);
+	// fusion needs exact use counts, so it runs once the rest of the code has settled
+	if (fuseConcatenations(func, stats)) {
+		eliminateDeadCode(func, stats);
+	}
+}
+
+// main optimization function
+
+int opt(IRModule &codeModule) {
+
+	// initialize local error code
+	opterErrorCode = 0;
+
+	// if optimization is disabled, leave the code exactly as the semmer built it
+	if (optimizationLevel < OPTIMIZATION_LEVEL_FOLD) {
+		return 0;
+	}
+
+	// optimize every label in the module, one SsaFunction at a time; raising only appends data nodes, so labels are never added during the scan
+	OptStats stats;
+	unsigned int numNodes = codeModule.size();
+	for (IRId label = 0; label < numNodes; label++) {
+		if (codeModule.categories[label] != CATEGORY_LABEL) {
+			continue;
+		}
+		// lower the label's code into SSA form
+		SsaFunction func(codeModule, label);
+		unsigned int epoch = 0;
+		lowerSeq(func, codeModule.operand(label, 0), 0, epoch);
+		// run the passes
+		optimizeFunction(func, stats);
+		VERBOSE( cout << func.toString(); )
+		// write the results back into the module
+		raiseFunction(func, stats);
+	}
+
+	VERBOSE(
+		printNotice("folded " << stats.folded << " constants, propagated " << stats.propagated << " copies, eliminated " << stats.eliminated << " common subexpressions");
+		printNotice("reduced " << stats.reduced << " operations, removed " << stats.dead << " dead values, resolved " << stats.branches << " branches");
+		printNotice("fused " << stats.fused << " string operations into concatenations");
+	)
+
+	// finally, return to the caller
+	return opterErrorCode ? 1 : 0;
+}
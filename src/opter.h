@@ -0,0 +1,157 @@
+#ifndef _OPTER_H_
+#define _OPTER_H_
+
+#include "globalDefs.h"
+#include "constantDefs.h"
+#include "driver.h"
+
+#include "genner.h"
+
+// SsaValue category specifiers
+#define SSA_OPAQUE 0
+#define SSA_CONST 1
+#define SSA_ARRAY 2
+#define SSA_COPY 3
+#define SSA_UNOP 4
+#define SSA_BINOP 5
+#define SSA_CONVOP 6
+#define SSA_READ 7
+#define SSA_COMPOUND 8
+#define SSA_CATOP 9
+
+// SsaValue data type specifiers
+#define VALUE_UNKNOWN 0
+#define VALUE_BOOL 1
+#define VALUE_INT 2
+#define VALUE_FLOAT 3
+#define VALUE_CHAR 4
+#define VALUE_STRING 5
+
+// ConstData classes
+
+// usage: a compile-time constant as understood by the constant folder; words hold bools, ints, chars, and float bit patterns, arrays hold string bytes
+class ConstData {
+	public:
+		// data members
+		int valueType; // the data type of this constant (VALUE_ defines above)
+		uint64_t word; // the raw data word of this constant, if it's not a string
+		vector<uint8_t> array; // the raw bytes of this constant, if it's a string
+		// allocators/deallocators
+		ConstData(int valueType = VALUE_UNKNOWN, uint64_t word = 0);
+		ConstData(const vector<uint8_t> &array);
+		~ConstData();
+		// core methods
+		int64_t intValue() const;
+		double floatValue() const;
+		void setFloat(double value);
+		void setString(const string &s);
+		string toString() const;
+};
+
+// constant evaluation functions; return whether the operation could be evaluated at compile time with the exact run-time semantics
+bool foldUnOp(int kind, const ConstData &sub, ConstData &result);
+bool foldBinOp(int kind, const ConstData &left, const ConstData &right, ConstData &result);
+bool foldConvOp(int kind, const ConstData &sub, ConstData &result);
+
+// semantic-time constant folding in the module that the semmer is emitting into; returns an equivalent data word or array node if the given node is an operation on constants, or the node itself otherwise
+IRId foldData(IRId id, int operandType = VALUE_UNKNOWN);
+
+// SsaValue classes
+
+// usage: a single static assignment; operands refer to other values in the same SsaFunction
+class SsaValue {
+	public:
+		// data members
+		int category; // the category that this SsaValue belongs to (SSA_ defines above)
+		int kind; // the operation kind of this value, if it's an SSA_UNOP, SSA_BINOP, SSA_CONVOP, or SSA_CATOP, or the read kind, if it's an SSA_READ
+		vector<unsigned int> operands; // indices of the values that this one is computed from
+		vector<uint8_t> formats; // the format of each operand, if it's an SSA_CATOP (CAT_FORMAT_ defines in constantDefs.h)
+		ConstData data; // the constant data of this value, if it's an SSA_CONST or SSA_ARRAY; valueType is tracked for all values
+		unsigned int width; // the word width in bits of an SSA_CONST
+		unsigned int region; // index of the region (straight-line code nesting level) in which this value is computed
+		unsigned int epoch; // the number of memory-modifying code trees preceding this value in program order
+		IRId origin; // the IRModule node this value was lowered from; NULL_IR_ID for values created during optimization
+		bool rewritten; // whether this value no longer matches its origin
+		bool live; // whether this value is used by any code; derived by dead code elimination
+		// allocators/deallocators
+		SsaValue(int category, IRId origin = NULL_IR_ID);
+		~SsaValue();
+};
+
+// usage: an operand slot of a code node that holds a data node which has been lowered to an SsaValue
+class SsaUse {
+	public:
+		// data members
+		uint32_t slot; // index of the slot in the IRModule's operand array
+		unsigned int value; // index of the value stored into the slot
+		// allocators/deallocators
+		SsaUse(uint32_t slot, unsigned int value);
+		~SsaUse();
+};
+
+// usage: a conditional branch whose test might be resolved at compile time
+class SsaBranch {
+	public:
+		// data members
+		uint32_t slot; // index of the operand slot holding the COND node
+		IRId cond; // the conditional branch itself
+		unsigned int test; // index of the value that the branch tests
+		// allocators/deallocators
+		SsaBranch(uint32_t slot, IRId cond, unsigned int test);
+		~SsaBranch();
+};
+
+// usage: the SSA form of the data flow of a single LABEL node
+class SsaFunction {
+	public:
+		// data members
+		IRModule &module; // the module that holds the code of this function
+		IRId label; // the label that this function was lowered from
+		vector<SsaValue> values; // all of the values computed in this function, in program order
+		vector<unsigned int> regionParents; // the enclosing region of each region; region 0 is the label's body
+		vector<SsaUse> uses; // the operand slots of the code nodes that consume values
+		vector<SsaBranch> branches; // the conditional branches of this function
+		// allocators/deallocators
+		SsaFunction(IRModule &module, IRId label);
+		~SsaFunction();
+		// core methods
+		unsigned int addValue(const SsaValue &value);
+		unsigned int resolve(unsigned int value) const;
+		bool dominates(unsigned int regionOuter, unsigned int regionInner) const;
+		string toString() const;
+};
+
+// optimization statistics
+
+// usage: counters of the transformations applied by the optimization passes
+class OptStats {
+	public:
+		// data members
+		unsigned int folded; // number of values replaced by constants
+		unsigned int propagated; // number of operands rewired through copies
+		unsigned int eliminated; // number of values replaced by an equivalent earlier value
+		unsigned int reduced; // number of operations replaced by cheaper ones
+		unsigned int dead; // number of values found to be unused
+		unsigned int branches; // number of conditional branches resolved at compile time
+		unsigned int fused; // number of string operations fused into the concatenations that consume them
+		// allocators/deallocators
+		OptStats();
+		~OptStats();
+		// core methods
+		unsigned int changes() const;
+};
+
+// optimization passes
+
+bool foldConstants(SsaFunction &func, OptStats &stats);
+bool propagateCopies(SsaFunction &func, OptStats &stats);
+bool eliminateCommonSubexpressions(SsaFunction &func, OptStats &stats);
+bool reduceStrength(SsaFunction &func, OptStats &stats);
+bool eliminateDeadCode(SsaFunction &func, OptStats &stats);
+bool fuseConcatenations(SsaFunction &func, OptStats &stats);
+
+// main optimization function
+
+int opt(IRModule &codeModule);
+
+#endif
@@ -6,6 +6,14 @@
 
 int parserErrorCode;
 
+// parser profile counters (-r), accumulated over all parsed files
+unsigned long profileTokens = 0;
+unsigned long profileShifts = 0;
+unsigned long profileReductions = 0;
+unsigned long profileUnitReductions = 0; // reductions by rules with a single rhs symbol
+unsigned long profileRuleReductions[NUM_RULES];
+unsigned int profileMaxStackDepth = 0;
+
 // Tree functions
 
 // constructors
@@ -21,16 +29,16 @@ Tree::~Tree() {
 }
 
 // core methods
-IRTree *Tree::code() const {
+IRId Tree::code() const {
 	return (status.code);
 }
 Type &Tree::typeRef() const {
 	return (*(status.type));
 }
-DataTree *Tree::castCode(const Type &destType) const {
+IRId Tree::castCode(const Type &destType) const {
 	return (status.castCode(destType));
 }
-DataTree *Tree::castCommonCode(const Type &otherType) const {
+IRId Tree::castCommonCode(const Type &otherType) const {
 	return (status.castCommonCode(otherType));
 }
 
@@ -138,7 +146,7 @@ Tree::operator string() const {
 						semmerError(curToken.fileIndex,curToken.row,curToken.col,"left extent subscript is invalid");
 						semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (subscript type is "<<leftExpStatus<<")");
 					}
-					TypeStatus rightExpStatus = getStatusExp(curn->child->next);
+					TypeStatus rightExpStatus = getStatusExp(curn->child->next->next->next);
 					if (!(*rightExpStatus >> *stdIntType)) { // if the types are incompatible, flag an error
 						Token curToken = curn->child->next->next->next->t; // Exp
 						semmerError(curToken.fileIndex,curToken.row,curToken.col,"right extent subscript is invalid");
@@ -212,6 +220,8 @@ int parse(vector<Token> *lexeme, Tree *&parseme, unsigned int fileIndex) {
 	stack<unsigned int> stateStack;
 	stateStack.push(0);
 
+	PROFILE( profileTokens += lexeme->size(); )
+
 	for(vector<Token>::iterator lexemeIter = lexeme->begin(); lexemeIter != lexeme->end(); lexemeIter++) {
 
 transitionParserState: ;
@@ -228,6 +238,13 @@ transitionParserState: ;
 			shiftToken(treeCur, t);
 			stateStack.push(transition.n);
 
+			PROFILE(
+				profileShifts++;
+				if (stateStack.size() > profileMaxStackDepth) {
+					profileMaxStackDepth = stateStack.size();
+				}
+			)
+
 			VERBOSE( cout << "\t" <<
 				COLOREXP(SET_TERM(BRIGHT_CODE AND MAGENTA_CODE)) << "SHIFT" << COLOREXP(SET_TERM(RESET_CODE)) <<
 				"\t" << curState << "\t->\t" << transition.n << "\t[" <<
@@ -259,6 +276,17 @@ transitionParserState: ;
 			int tempState = stateStack.top();
 			stateStack.push(parserNode[tempState][tokenType].n);
 
+			PROFILE(
+				profileReductions++;
+				profileRuleReductions[transition.n]++;
+				if (numRhs == 1) {
+					profileUnitReductions++;
+				}
+				if (stateStack.size() > profileMaxStackDepth) {
+					profileMaxStackDepth = stateStack.size();
+				}
+			)
+
 			VERBOSE(
 				const char *tokenString = ruleLhsTokenString[transition.n];
 				cout << "\t" <<
@@ -297,3 +325,46 @@ transitionParserState: ;
 	// return to the caller
 	return parserErrorCode;
 }
+
+// orders rules by descending reduction count, then by rule number
+bool profileRuleCompare(const pair<unsigned long, unsigned int> &a, const pair<unsigned long, unsigned int> &b) {
+	return (a.first != b.first) ? (a.first > b.first) : (a.second < b.second);
+}
+
+// prints the counters accumulated by parse() in profile mode (-r)
+void printParserProfile() {
+#include "../tmp/ruleRhsLengthRaw.h"
+#include "../tmp/ruleLhsTokenStringRaw.h"
+
+	printLabel("parser profile:");
+	print("\ttokens\t\t" << profileTokens);
+	print("\tshifts\t\t" << profileShifts);
+	print("\treductions\t" << profileReductions);
+	print("\tunit reductions\t" << profileUnitReductions);
+	if (profileTokens > 0) {
+		char tempS[MAX_FLOAT_STRING_LENGTH];
+		sprintf(tempS, "%.2f", (double)profileReductions / (double)profileTokens);
+		print("\treductions/token\t" << tempS);
+	}
+	print("\tmax stack depth\t" << profileMaxStackDepth);
+
+	// rank the rules that were reduced at least once
+	vector<pair<unsigned long, unsigned int> > hotRules;
+	for (unsigned int i=0; i < NUM_RULES; i++) {
+		if (profileRuleReductions[i] > 0) {
+			hotRules.push_back(make_pair(profileRuleReductions[i], i));
+		}
+	}
+	sort(hotRules.begin(), hotRules.end(), profileRuleCompare);
+	// print out the hottest ones
+	printLabel("hottest rules (reductions, share, rule, lhs, rhs length):");
+	for (unsigned int i=0; i < hotRules.size() && i < PARSER_PROFILE_HOT_RULES; i++) {
+		unsigned int rule = hotRules[i].second;
+		char tempS[MAX_FLOAT_STRING_LENGTH];
+		sprintf(tempS, "%.1f%%", 100.0 * (double)hotRules[i].first / (double)profileReductions);
+		print("\t" << hotRules[i].first << "\t" << tempS << "\t(" << rule << ")\t" <<
+			COLOREXP(SET_TERM(BRIGHT_CODE AND CYAN_CODE)) << ruleLhsTokenString[rule] << COLOREXP(SET_TERM(RESET_CODE)) <<
+			"\t" << ruleRhsLength[rule]);
+	}
+	print(""); // new line
+}
@@ -13,8 +13,6 @@
 class SymbolTree;
 class Type;
 class TypeStatus;
-class IRTree;
-class DataTree;
 
 class Tree {
 	public:
@@ -33,10 +31,10 @@ class Tree {
 		Tree(deque<unsigned int> *depthList);
 		~Tree();
 		// core methods
-		IRTree *code() const;
+		IRId code() const;
 		Type &typeRef() const;
-		DataTree *castCode(const Type &destType) const;
-		DataTree *castCommonCode(const Type &otherType) const;
+		IRId castCode(const Type &destType) const;
+		IRId castCommonCode(const Type &otherType) const;
 		// comparison operators
 		bool operator==(int tokenType) const;
 		bool operator!=(int tokenType) const;
@@ -56,6 +54,7 @@ class Tree {
 };
 
 int parse(vector<Token> *lexeme, Tree *&parseme, unsigned int fileIndex);
+void printParserProfile();
 
 // post-includes
 #include "semmer.h"
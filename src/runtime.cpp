@@ -0,0 +1,1391 @@
+#include "runtime.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <math.h>
+
+// the runtime I/O layer behind std.out, std.err, and the std.in* nodes, and the scheduler that runs labels (and implements std.delay and std.gen ranges)
+//
+// output is formatted into per-thread chunks without any locking; a thread hands its chunks over to the stream's queue when they fill,
+// and when it yields at the end of a label, so the elements of a pipe stay in order even when its labels run on different threads
+// (a label only gets scheduled after the labels it depends on have yielded); queued chunks are written out with a single writev(2)
+// once a batch's worth has built up, on every yield if the stream is a terminal or std.err, and when the program exits
+//
+// input is read through one large buffer, and numbers are tokenized straight out of it
+//
+// a chain of string concatenations is compiled into a single rtCatString() call, which sizes the result up front,
+// allocates it once, and formats every number directly into place
+//
+// a parallel counted range is split into chunks that idle workers help with; every chunk formats its output into a holding buffer of its own,
+// and the buffers are appended in index order once the whole range is done, so the output comes out just as if the range had run serially
+//
+// a destream body that doesn't write latches gets its stream's elements in batches, which run as parallel ranges over the batch;
+// only a body that writes output pays for holding buffers, and only bodies that write latches or output have their batches run one at a time, in order
+//
+// fixed-extent arrays are allocated out of size-classed slabs; every thread keeps free lists of its own, and trades whole batches of blocks
+// with the process-wide depot only when a list runs dry or grows long, so allocating and freeing an array doesn't take a lock (or call malloc(3)) in the common case
+// pool storage is bump-allocated out of per-thread regions, and everything allocated since a mark is released in bulk, once the block that took the mark completes
+//
+// delayed labels are parked on a hierarchical timer wheel rather than on a thread; the workers release them as part of their loop,
+// and an idle worker sleeps until the next expiry, so a parked label costs nothing but its task until its time comes
+
+// runtime-global variables
+
+RtOutStream *rtOutStreams[RT_NUM_STREAMS];
+RtInStream *rtIn;
+RtScheduler *rtScheduler;
+pthread_key_t rtThreadKey;
+RtSlabDepot *rtSlabDepots[RT_SLAB_CLASSES];
+pthread_key_t rtHeapKey;
+pthread_once_t rtInitOnce = PTHREAD_ONCE_INIT;
+
+// RtChunk functions
+RtChunk::RtChunk(size_t capacity) : data((char *)malloc(capacity)), length(0), capacity(capacity), next(NULL) {}
+RtChunk::~RtChunk() {
+	free(data);
+}
+
+// RtOutStream functions
+RtOutStream::RtOutStream(int fd, bool eager) : fd(fd), eager(eager), queueHead(NULL), queueTail(NULL), queueLength(0), freeList(NULL) {
+	pthread_mutex_init(&queueLock, NULL);
+	pthread_mutex_init(&writeLock, NULL);
+}
+RtOutStream::~RtOutStream() {
+	while (freeList != NULL) {
+		RtChunk *next = freeList->next;
+		delete freeList;
+		freeList = next;
+	}
+	pthread_mutex_destroy(&queueLock);
+	pthread_mutex_destroy(&writeLock);
+}
+// returns an empty chunk of the default size, recycling a spent one if possible
+RtChunk *RtOutStream::getChunk() {
+	RtChunk *acc = NULL;
+	pthread_mutex_lock(&queueLock);
+	if (freeList != NULL) {
+		acc = freeList;
+		freeList = freeList->next;
+	}
+	pthread_mutex_unlock(&queueLock);
+	if (acc == NULL) {
+		acc = new RtChunk(RT_OUT_CHUNK_SIZE);
+	}
+	acc->length = 0;
+	acc->next = NULL;
+	return acc;
+}
+
+// writes out the given list of chunks with as few writev(2) calls as possible
+void writeChunks(int fd, RtChunk *chunk) {
+	struct iovec iov[IOV_MAX];
+	while (chunk != NULL) {
+		// gather the next batch of chunks
+		int numIov = 0;
+		for (; chunk != NULL && numIov < IOV_MAX; chunk = chunk->next) {
+			iov[numIov].iov_base = chunk->data;
+			iov[numIov].iov_len = chunk->length;
+			numIov++;
+		}
+		// write the batch, picking up after partial writes
+		struct iovec *cur = iov;
+		while (numIov > 0) {
+			ssize_t written = writev(fd, cur, numIov);
+			if (written < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				break; // if the stream is gone (e.g. a closed pipe), there's nothing left to do but drop the batch
+			}
+			while (numIov > 0 && (size_t)written >= cur->iov_len) {
+				written -= cur->iov_len;
+				cur++;
+				numIov--;
+			}
+			if (numIov > 0) {
+				cur->iov_base = (char *)(cur->iov_base) + written;
+				cur->iov_len -= written;
+			}
+		}
+	}
+}
+
+// appends the given chunk (if any) to the queue, and writes out the queue if it's been asked to or if a batch's worth has built up
+void RtOutStream::enqueue(RtChunk *chunk, bool flush) {
+	pthread_mutex_lock(&queueLock);
+	if (chunk != NULL) {
+		if (queueTail != NULL) {
+			queueTail->next = chunk;
+		} else {
+			queueHead = chunk;
+		}
+		queueTail = chunk;
+		queueLength += chunk->length;
+	}
+	if (queueHead == NULL || (!flush && queueLength < RT_OUT_BATCH_SIZE)) {
+		pthread_mutex_unlock(&queueLock);
+		return;
+	}
+	// take the whole queue; the write lock is acquired before the queue lock is released, so batches can't overtake each other
+	RtChunk *batch = queueHead;
+	queueHead = queueTail = NULL;
+	queueLength = 0;
+	pthread_mutex_lock(&writeLock);
+	pthread_mutex_unlock(&queueLock);
+	writeChunks(fd, batch);
+	pthread_mutex_unlock(&writeLock);
+	// recycle the spent chunks; oversized ones were only made for a single long element, so they're freed instead
+	RtChunk *reusable = NULL;
+	while (batch != NULL) {
+		RtChunk *next = batch->next;
+		if (batch->capacity == RT_OUT_CHUNK_SIZE) {
+			batch->next = reusable;
+			reusable = batch;
+		} else {
+			delete batch;
+		}
+		batch = next;
+	}
+	if (reusable != NULL) {
+		pthread_mutex_lock(&queueLock);
+		for (RtChunk *cur = reusable; cur != NULL; cur = reusable) {
+			reusable = cur->next;
+			cur->next = freeList;
+			freeList = cur;
+		}
+		pthread_mutex_unlock(&queueLock);
+	}
+}
+void RtOutStream::flush() {
+	enqueue(NULL, true);
+}
+
+// RtThreadOut functions
+RtThreadOut::RtThreadOut(bool holding) : holding(holding) {
+	for (int i=0; i < RT_NUM_STREAMS; i++) {
+		chunks[i] = NULL;
+		heldHeads[i] = NULL;
+		heldTails[i] = NULL;
+	}
+}
+RtThreadOut::~RtThreadOut() {
+	holding = false;
+	yield();
+}
+// hands the given spent chunk over to its stream, or holds onto it if this is a holding buffer
+void RtThreadOut::handOver(int stream, RtChunk *chunk, bool flush) {
+	if (!holding) {
+		rtOutStreams[stream]->enqueue(chunk, flush);
+		return;
+	}
+	chunk->next = NULL;
+	if (heldTails[stream] != NULL) {
+		heldTails[stream]->next = chunk;
+	} else {
+		heldHeads[stream] = chunk;
+	}
+	heldTails[stream] = chunk;
+}
+void RtThreadOut::append(int stream, const char *s, size_t length) {
+	RtChunk *&chunk = chunks[stream];
+	if (chunk != NULL && chunk->capacity - chunk->length >= length) { // if the element fits into the current chunk, just copy it in
+		memcpy(chunk->data + chunk->length, s, length);
+		chunk->length += length;
+		return;
+	}
+	// otherwise, hand over the current chunk and start a new one
+	if (chunk != NULL) {
+		handOver(stream, chunk, false);
+	}
+	if (length > RT_OUT_CHUNK_SIZE) { // if the element is too long for any chunk, give it one of its own
+		RtChunk *bigChunk = new RtChunk(length);
+		memcpy(bigChunk->data, s, length);
+		bigChunk->length = length;
+		handOver(stream, bigChunk, false);
+		chunk = NULL;
+		return;
+	}
+	chunk = rtOutStreams[stream]->getChunk();
+	memcpy(chunk->data, s, length);
+	chunk->length = length;
+}
+// hands over all of this thread's buffered output; eager streams are written out right away
+void RtThreadOut::yield() {
+	for (int i=0; i < RT_NUM_STREAMS; i++) {
+		if (chunks[i] != NULL) {
+			handOver(i, chunks[i], rtOutStreams[i]->eager);
+			chunks[i] = NULL;
+		}
+		if (!holding) { // a buffer that's stopped holding releases everything it held
+			for (RtChunk *held = heldHeads[i]; held != NULL; held = heldHeads[i]) {
+				heldHeads[i] = held->next;
+				held->next = NULL;
+				rtOutStreams[i]->enqueue(held, false);
+			}
+			heldTails[i] = NULL;
+		}
+	}
+}
+// appends all of the output of the given holding buffer after this buffer's own, leaving the other buffer empty
+void RtThreadOut::adopt(RtThreadOut &other) {
+	other.yield(); // move the other buffer's current chunks onto its held lists
+	for (int i=0; i < RT_NUM_STREAMS; i++) {
+		if (other.heldHeads[i] == NULL) {
+			continue;
+		}
+		if (chunks[i] != NULL) {
+			handOver(i, chunks[i], false);
+			chunks[i] = NULL;
+		}
+		for (RtChunk *held = other.heldHeads[i]; held != NULL; held = other.heldHeads[i]) {
+			other.heldHeads[i] = held->next;
+			held->next = NULL;
+			handOver(i, held, false);
+		}
+		other.heldTails[i] = NULL;
+	}
+}
+
+// RtInStream functions
+RtInStream::RtInStream(int fd) : fd(fd), buf((char *)malloc(RT_IN_BUFFER_SIZE)), pos(0), end(0), eof(false), interactive(isatty(fd)) {
+	pthread_mutex_init(&lock, NULL);
+}
+RtInStream::~RtInStream() {
+	free(buf);
+	pthread_mutex_destroy(&lock);
+}
+// reads more input into the buffer, keeping the unread bytes; returns false if there is no more input
+bool RtInStream::fill() {
+	if (eof) {
+		return false;
+	}
+	if (interactive) { // if someone is typing the input, make sure they've seen everything printed so far
+		rtFlush();
+	}
+	if (pos > 0) {
+		memmove(buf, buf + pos, end - pos);
+		end -= pos;
+		pos = 0;
+	}
+	for(;;) {
+		ssize_t numRead = read(fd, buf + end, RT_IN_BUFFER_SIZE - end);
+		if (numRead > 0) {
+			end += numRead;
+			return true;
+		} else if (numRead < 0 && errno == EINTR) {
+			continue;
+		}
+		eof = true;
+		return false;
+	}
+}
+// returns the next unread byte without consuming it, or -1 at the end of the input
+int RtInStream::peek() {
+	if (pos == end && !fill()) {
+		return -1;
+	}
+	return (unsigned char)buf[pos];
+}
+void RtInStream::skipSpace() {
+	for(;;) {
+		if (pos == end && !fill()) {
+			return;
+		}
+		char c = buf[pos];
+		if (c != ' ' && c != '\t' && c != '\n' && c != '\r' && c != '\v' && c != '\f') {
+			return;
+		}
+		pos++;
+	}
+}
+// consumes the next whitespace-delimited token, copying (up to RT_IN_TOKEN_LENGTH-1 bytes of) it into token; returns the number of bytes copied
+size_t RtInStream::getToken(char *token) {
+	skipSpace();
+	size_t length = 0;
+	for(;;) {
+		if (pos == end && !fill()) {
+			break;
+		}
+		char c = buf[pos];
+		if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f') {
+			break;
+		}
+		if (length < RT_IN_TOKEN_LENGTH-1) {
+			token[length++] = c;
+		}
+		pos++;
+	}
+	token[length] = '\0';
+	return length;
+}
+
+// RtTimerWheel functions
+RtTimerWheel::RtTimerWheel() : now(0), size(0) {
+	memset(slots, 0, sizeof(slots));
+	memset(occupied, 0, sizeof(occupied));
+}
+RtTimerWheel::~RtTimerWheel() {}
+// parks the given task in the slot for its expiry; if it's already due, it's pushed onto ready instead
+void RtTimerWheel::add(RtTask *task, RtTask *&ready) {
+	if (task->expiry <= now) {
+		task->next = ready;
+		ready = task;
+		return;
+	}
+	uint64_t delta = task->expiry - now;
+	if (delta > RT_TIMER_MAX_TICKS) { // if the delay is longer than the wheel can hold, cut it short
+		delta = RT_TIMER_MAX_TICKS;
+		task->expiry = now + delta;
+	}
+	// find the lowest level whose range covers the delay
+	unsigned int level = 0;
+	while (level < RT_TIMER_LEVELS-1 && (delta >> (RT_TIMER_SLOT_BITS * (level+1))) != 0) {
+		level++;
+	}
+	unsigned int slot = (unsigned int)(task->expiry >> (RT_TIMER_SLOT_BITS * level)) & RT_TIMER_SLOT_MASK;
+	task->next = slots[level][slot];
+	slots[level][slot] = task;
+	if (level == 0) {
+		occupied[slot / 64] |= ((uint64_t)1) << (slot % 64);
+	}
+	size++;
+}
+// moves all of the tasks in the given slot down to the levels that their remaining delays now belong to
+void RtTimerWheel::cascade(unsigned int level, unsigned int slot, RtTask *&ready) {
+	RtTask *task = slots[level][slot];
+	slots[level][slot] = NULL;
+	while (task != NULL) {
+		RtTask *next = task->next;
+		size--;
+		add(task, ready);
+		task = next;
+	}
+}
+// processes every tick up to and including the given one, pushing the tasks that expire onto ready
+void RtTimerWheel::advance(uint64_t tick, RtTask *&ready) {
+	while (now < tick) {
+		if (size == 0) { // if nothing is parked, there's nothing to step through
+			now = tick;
+			break;
+		}
+		now++;
+		unsigned int slot = (unsigned int)now & RT_TIMER_SLOT_MASK;
+		if (slot == 0) { // if level 0 wrapped around, cascade the slots of the levels that wrapped with it, highest first
+			unsigned int top = 1;
+			while (top < RT_TIMER_LEVELS-1 && ((now >> (RT_TIMER_SLOT_BITS * top)) & RT_TIMER_SLOT_MASK) == 0) {
+				top++;
+			}
+			for (unsigned int level = top; level >= 1; level--) {
+				cascade(level, (unsigned int)(now >> (RT_TIMER_SLOT_BITS * level)) & RT_TIMER_SLOT_MASK, ready);
+			}
+		}
+		// release the tasks of this tick
+		RtTask *task = slots[0][slot];
+		if (task != NULL) {
+			slots[0][slot] = NULL;
+			occupied[slot / 64] &= ~(((uint64_t)1) << (slot % 64));
+			while (task != NULL) {
+				RtTask *next = task->next;
+				task->next = ready;
+				ready = task;
+				size--;
+				task = next;
+			}
+		}
+	}
+}
+// returns the tick by which advance() must next be called; that's either the next expiry on level 0,
+// or if level 0 is empty for the rest of its rotation, the tick at which it wraps around and the next slot of level 1 is cascaded
+uint64_t RtTimerWheel::nextExpiry() const {
+	unsigned int cur = (unsigned int)now & RT_TIMER_SLOT_MASK;
+	for (unsigned int slot = cur + 1; slot < RT_TIMER_SLOTS; slot = (slot / 64 + 1) * 64) {
+		uint64_t word = occupied[slot / 64] >> (slot % 64);
+		if (word != 0) {
+			return (now - cur) + slot + __builtin_ctzll(word);
+		}
+	}
+	return (now | RT_TIMER_SLOT_MASK) + 1;
+}
+
+// RtRangeJob functions
+RtRangeJob::RtRangeJob(RtRangeFunc func, void *arg, int64_t count, unsigned int numChunks, unsigned int refs, bool holding) : func(func), arg(arg), count(count),
+		chunkSize((count + numChunks - 1) / numChunks), numChunks(numChunks), nextChunk(0), numDone(0), refs(refs), holding(holding), outs(new RtThreadOut *[numChunks]) {
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&done, NULL);
+}
+RtRangeJob::~RtRangeJob() {
+	delete[] outs;
+	pthread_mutex_destroy(&lock);
+	pthread_cond_destroy(&done);
+}
+// claims the next chunk of the range and runs it (with a holding output buffer of its own, if the job is holding); returns false if there was no chunk left to claim
+bool RtRangeJob::runChunk() {
+	pthread_mutex_lock(&lock);
+	if (nextChunk == numChunks) {
+		pthread_mutex_unlock(&lock);
+		return false;
+	}
+	unsigned int chunk = nextChunk++;
+	pthread_mutex_unlock(&lock);
+	int64_t begin = chunk * chunkSize;
+	int64_t end = (count - begin > chunkSize) ? begin + chunkSize : count;
+	RtThreadOut *chunkOut = NULL;
+	if (holding) {
+		RtThreadOut *threadOut = (RtThreadOut *)pthread_getspecific(rtThreadKey);
+		chunkOut = new RtThreadOut(true);
+		pthread_setspecific(rtThreadKey, chunkOut);
+		func(arg, begin, end);
+		pthread_setspecific(rtThreadKey, threadOut);
+	} else {
+		func(arg, begin, end);
+	}
+	pthread_mutex_lock(&lock);
+	outs[chunk] = chunkOut;
+	if (++numDone == numChunks) {
+		pthread_cond_signal(&done);
+	}
+	pthread_mutex_unlock(&lock);
+	return true;
+}
+// drops a reference to this job, deleting it once nobody can use it anymore
+void RtRangeJob::release() {
+	pthread_mutex_lock(&lock);
+	bool last = (--refs == 0);
+	pthread_mutex_unlock(&lock);
+	if (last) {
+		delete this;
+	}
+}
+
+// the label that helper workers run a parallel range with; helpers that get going after all of the chunks have been claimed just drop out
+void rtRangeHelper(void *job) {
+	while (((RtRangeJob *)job)->runChunk());
+	((RtRangeJob *)job)->release();
+}
+
+// RtBatchBlock functions
+RtBatchBlock::RtBatchBlock(RtBatch *batch) : batch(batch), elements((uint64_t *)malloc(RT_BATCH_SIZE * sizeof(uint64_t))), count(0), next(NULL) {}
+RtBatchBlock::~RtBatchBlock() {
+	free(elements);
+}
+
+// the range that a block's elements are run as
+void rtBatchRange(void *block, int64_t begin, int64_t end) {
+	RtBatch *batch = ((RtBatchBlock *)block)->batch;
+	batch->func(batch->arg, ((RtBatchBlock *)block)->elements, begin, end);
+}
+
+// RtBatch functions
+RtBatch::RtBatch(RtBatchFunc func, void *arg, int access) : func(func), arg(arg), access(access), current(NULL), pendingHead(NULL), pendingTail(NULL), running(false) {
+	pthread_mutex_init(&lock, NULL);
+	pthread_cond_init(&idle, NULL);
+}
+RtBatch::~RtBatch() {
+	delete current;
+	for (RtBatchBlock *block = pendingHead; block != NULL; block = pendingHead) {
+		pendingHead = block->next;
+		delete block;
+	}
+	pthread_mutex_destroy(&lock);
+	pthread_cond_destroy(&idle);
+}
+// appends the given element to the current block; returns whether the block is now full
+bool RtBatch::push(uint64_t element) {
+	pthread_mutex_lock(&lock);
+	if (current == NULL) {
+		current = new RtBatchBlock(this);
+	}
+	current->elements[current->count++] = element;
+	bool full = (current->count == RT_BATCH_SIZE);
+	pthread_mutex_unlock(&lock);
+	return full;
+}
+// detaches the current block, or returns NULL if there is none; the lock must be held
+RtBatchBlock *RtBatch::take() {
+	RtBatchBlock *block = current;
+	current = NULL;
+	return block;
+}
+
+// RtSlabDepot functions
+RtSlabDepot::RtSlabDepot(size_t blockSize) : blockSize(blockSize), batches(NULL) {
+	pthread_mutex_init(&lock, NULL);
+}
+RtSlabDepot::~RtSlabDepot() {
+	pthread_mutex_destroy(&lock);
+}
+// stores the given batch (which can be any number of linked blocks)
+void RtSlabDepot::put(void *batch) {
+	pthread_mutex_lock(&lock);
+	((void **)batch)[1] = batches;
+	batches = batch;
+	pthread_mutex_unlock(&lock);
+}
+// returns a batch of free blocks, carving up a fresh slab into batches if there are none left
+void *RtSlabDepot::take() {
+	pthread_mutex_lock(&lock);
+	if (batches == NULL) {
+		char *slab = (char *)malloc(RT_SLAB_SIZE);
+		size_t numBlocks = RT_SLAB_SIZE / blockSize;
+		for (size_t i = numBlocks; i > 0; i--) { // link the blocks back to front, so that they're handed out in address order
+			void **block = (void **)(slab + (i-1) * blockSize);
+			if (i == numBlocks || i % RT_SLAB_BATCH == 0) { // the last block of a batch
+				block[0] = NULL;
+			} else {
+				block[0] = slab + i * blockSize;
+			}
+			if ((i-1) % RT_SLAB_BATCH == 0) { // the first block of a batch
+				block[1] = batches;
+				batches = block;
+			}
+		}
+	}
+	void *acc = batches;
+	batches = ((void **)acc)[1];
+	pthread_mutex_unlock(&lock);
+	return acc;
+}
+
+// RtPoolRegion functions
+RtPoolRegion::RtPoolRegion(size_t capacity) : data((char *)malloc(capacity)), capacity(capacity), prev(NULL) {}
+RtPoolRegion::~RtPoolRegion() {
+	free(data);
+}
+
+// RtThreadHeap functions
+RtThreadHeap::RtThreadHeap() : region(NULL), bump(NULL), spareRegions(NULL), numSpareRegions(0) {
+	for (unsigned int i=0; i < RT_SLAB_CLASSES; i++) {
+		freeLists[i] = NULL;
+		freeCounts[i] = 0;
+	}
+}
+RtThreadHeap::~RtThreadHeap() {
+	// hand the free blocks back to the depots, so that other threads can use them
+	for (unsigned int i=0; i < RT_SLAB_CLASSES; i++) {
+		if (freeLists[i] != NULL) {
+			rtSlabDepots[i]->put(freeLists[i]);
+		}
+	}
+	releasePool(NULL);
+	while (spareRegions != NULL) {
+		RtPoolRegion *next = spareRegions->prev;
+		delete spareRegions;
+		spareRegions = next;
+	}
+}
+// returns a block of the given size class, refilling the free list from the depot if it's empty
+void *RtThreadHeap::allocBlock(unsigned int sizeClass) {
+	void **acc = (void **)freeLists[sizeClass];
+	if (acc == NULL) {
+		acc = (void **)rtSlabDepots[sizeClass]->take();
+		freeCounts[sizeClass] = 0;
+		for (void **block = acc; block != NULL; block = (void **)block[0]) {
+			freeCounts[sizeClass]++;
+		}
+	}
+	freeLists[sizeClass] = acc[0];
+	freeCounts[sizeClass]--;
+	return acc;
+}
+// returns the given block to the free list of its size class; once the list grows long, a batch's worth of it goes back to the depot
+void RtThreadHeap::freeBlock(void *block, unsigned int sizeClass) {
+	((void **)block)[0] = freeLists[sizeClass];
+	freeLists[sizeClass] = block;
+	if (++freeCounts[sizeClass] == 2 * RT_SLAB_BATCH) {
+		void **last = (void **)block;
+		for (unsigned int i=1; i < RT_SLAB_BATCH; i++) {
+			last = (void **)last[0];
+		}
+		freeLists[sizeClass] = last[0];
+		last[0] = NULL;
+		freeCounts[sizeClass] -= RT_SLAB_BATCH;
+		rtSlabDepots[sizeClass]->put(block);
+	}
+}
+// bump-allocates size bytes of pool storage, starting a new region if the current one is too full
+// a region that couldn't hold the request at the default size is sized to fit it, and is freed rather than kept once it's released
+void *RtThreadHeap::allocPool(size_t size) {
+	size = (size + RT_POOL_ALIGN - 1) & ~(size_t)(RT_POOL_ALIGN - 1);
+	if (region == NULL || size > (size_t)(region->data + region->capacity - bump)) {
+		RtPoolRegion *newRegion;
+		if (size > RT_POOL_REGION_SIZE) {
+			newRegion = new RtPoolRegion(size);
+		} else if (spareRegions != NULL) {
+			newRegion = spareRegions;
+			spareRegions = newRegion->prev;
+			numSpareRegions--;
+		} else {
+			newRegion = new RtPoolRegion(RT_POOL_REGION_SIZE);
+		}
+		newRegion->prev = region;
+		region = newRegion;
+		bump = newRegion->data;
+	}
+	void *acc = bump;
+	bump += size;
+	return acc;
+}
+// releases all of the pool storage allocated since the given mark (or all of it, if mark is NULL), popping every region above the mark's
+void RtThreadHeap::releasePool(char *mark) {
+	while (region != NULL && (mark < region->data || mark > region->data + region->capacity)) {
+		RtPoolRegion *prev = region->prev;
+		if (region->capacity == RT_POOL_REGION_SIZE && numSpareRegions < RT_POOL_SPARE_REGIONS) {
+			region->prev = spareRegions;
+			spareRegions = region;
+			numSpareRegions++;
+		} else {
+			delete region;
+		}
+		region = prev;
+	}
+	bump = (region != NULL) ? mark : NULL;
+}
+
+// RtScheduler functions
+RtScheduler::RtScheduler() : readyHead(NULL), readyTail(NULL), freeList(NULL), numRunning(0), numWorkers(0), timekeeping(false), timekeeperTick(0), done(false) {
+	pthread_mutex_init(&lock, NULL);
+	// the timekeeper sleeps until an absolute tick, so the condition variables measure time on the same clock as the ticks
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&wake, &attr);
+	pthread_cond_init(&timekeeperWake, &attr);
+	pthread_condattr_destroy(&attr);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+}
+RtScheduler::~RtScheduler() {
+	while (freeList != NULL) {
+		RtTask *next = freeList->next;
+		delete freeList;
+		freeList = next;
+	}
+	pthread_mutex_destroy(&lock);
+	pthread_cond_destroy(&wake);
+	pthread_cond_destroy(&timekeeperWake);
+}
+uint64_t RtScheduler::currentTick() const {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	int64_t ns = (int64_t)(t.tv_sec - start.tv_sec) * 1000000000 + (t.tv_nsec - start.tv_nsec);
+	return (uint64_t)(ns / RT_TIMER_TICK_NS);
+}
+// returns a task for running func with arg, recycling a spent one if possible; the lock must be held
+RtTask *RtScheduler::getTask(RtLabelFunc func, void *arg) {
+	RtTask *acc = freeList;
+	if (acc != NULL) {
+		freeList = acc->next;
+	} else {
+		acc = new RtTask();
+	}
+	acc->func = func;
+	acc->arg = arg;
+	acc->expiry = 0;
+	acc->next = NULL;
+	return acc;
+}
+// appends the given task to the run queue; the lock must be held
+void RtScheduler::pushReady(RtTask *task) {
+	task->next = NULL;
+	if (readyTail != NULL) {
+		readyTail->next = task;
+	} else {
+		readyHead = task;
+	}
+	readyTail = task;
+}
+void RtScheduler::schedule(RtLabelFunc func, void *arg) {
+	pthread_mutex_lock(&lock);
+	pushReady(getTask(func, arg));
+	pthread_cond_signal(&wake);
+	pthread_mutex_unlock(&lock);
+}
+// parks func to run with arg no sooner than ms milliseconds from now
+void RtScheduler::delay(RtLabelFunc func, void *arg, int64_t ms) {
+	if (ms <= 0) {
+		schedule(func, arg);
+		return;
+	}
+	uint64_t ticks = ((uint64_t)ms > RT_TIMER_MAX_TICKS) ? RT_TIMER_MAX_TICKS : (uint64_t)ms * (1000000 / RT_TIMER_TICK_NS);
+	pthread_mutex_lock(&lock);
+	RtTask *task = getTask(func, arg);
+	task->expiry = currentTick() + ticks + 1; // the current tick is already partly over, so count from the next one
+	RtTask *ready = NULL;
+	timers.add(task, ready);
+	if (ready != NULL) { // if the task was due right away (which can't really happen), just run it
+		pushReady(ready);
+		pthread_cond_signal(&wake);
+	} else if (!timekeeping) { // if no worker is watching the clock, get an idle one to do it
+		pthread_cond_signal(&wake);
+	} else if (task->expiry < timekeeperTick) { // if the timekeeper is sleeping past this task's expiry, wake it up early
+		pthread_cond_signal(&timekeeperWake);
+	}
+	pthread_mutex_unlock(&lock);
+}
+// the worker loop; returns once all work has finished
+void RtScheduler::work() {
+	pthread_mutex_lock(&lock);
+	for(;;) {
+		// release the delayed tasks whose time has come
+		RtTask *ready = NULL;
+		timers.advance(currentTick(), ready);
+		while (ready != NULL) {
+			RtTask *next = ready->next;
+			pushReady(ready);
+			ready = next;
+		}
+		// run the next task, if there is one
+		if (readyHead != NULL) {
+			RtTask *task = readyHead;
+			readyHead = task->next;
+			if (readyHead == NULL) {
+				readyTail = NULL;
+			}
+			// if there's more to do than this task, pass the work on to another idle worker (which passes it on in turn)
+			if (readyHead != NULL || (timers.size > 0 && !timekeeping)) {
+				pthread_cond_signal(&wake);
+			}
+			numRunning++;
+			pthread_mutex_unlock(&lock);
+			task->func(task->arg);
+			rtYield();
+			pthread_mutex_lock(&lock);
+			numRunning--;
+			task->next = freeList;
+			freeList = task;
+			continue;
+		}
+		// otherwise, we're either done, the timekeeper, or idle
+		if (done) {
+			break;
+		}
+		if (numRunning == 0 && timers.size == 0) { // if nothing is running or parked, nothing can create more work, so we're done
+			done = true;
+			pthread_cond_broadcast(&wake);
+			pthread_cond_broadcast(&timekeeperWake);
+			break;
+		}
+		if (timers.size > 0 && !timekeeping) {
+			timekeeping = true;
+			timekeeperTick = timers.nextExpiry();
+			struct timespec deadline = start;
+			uint64_t ns = (uint64_t)deadline.tv_nsec + timekeeperTick * RT_TIMER_TICK_NS;
+			deadline.tv_sec += ns / 1000000000;
+			deadline.tv_nsec = ns % 1000000000;
+			pthread_cond_timedwait(&timekeeperWake, &lock, &deadline);
+			timekeeping = false;
+		} else {
+			pthread_cond_wait(&wake, &lock);
+		}
+	}
+	pthread_mutex_unlock(&lock);
+}
+
+void *rtWorkerThread(void *scheduler) {
+	((RtScheduler *)scheduler)->work();
+	return NULL;
+}
+
+// runs func with arg, and everything that it schedules, on numWorkers workers (the calling thread being one of them); returns once all work has finished
+void RtScheduler::run(RtLabelFunc func, void *arg, unsigned int numWorkers) {
+	pthread_mutex_lock(&lock);
+	done = false;
+	this->numWorkers = numWorkers;
+	pushReady(getTask(func, arg));
+	pthread_mutex_unlock(&lock);
+	pthread_t *threads = (pthread_t *)malloc(sizeof(pthread_t) * numWorkers);
+	unsigned int numThreads = 0;
+	for (unsigned int i=1; i < numWorkers; i++) {
+		if (pthread_create(&threads[numThreads], NULL, rtWorkerThread, this) == 0) {
+			numThreads++;
+		}
+	}
+	pthread_mutex_lock(&lock);
+	this->numWorkers = numThreads + 1; // in case some of the threads couldn't be started
+	pthread_mutex_unlock(&lock);
+	work();
+	for (unsigned int i=0; i < numThreads; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	free(threads);
+	pthread_mutex_lock(&lock);
+	this->numWorkers = 0;
+	pthread_mutex_unlock(&lock);
+}
+
+// runtime helper functions
+
+void rtThreadExit(void *threadOut) {
+	delete (RtThreadOut *)threadOut;
+}
+
+void rtHeapExit(void *heap) {
+	delete (RtThreadHeap *)heap;
+}
+
+void rtInitOnceFunc() {
+	rtOutStreams[RT_STREAM_OUT] = new RtOutStream(STDOUT_FILENO, isatty(STDOUT_FILENO));
+	rtOutStreams[RT_STREAM_ERR] = new RtOutStream(STDERR_FILENO, true);
+	rtIn = new RtInStream(STDIN_FILENO);
+	rtScheduler = new RtScheduler();
+	pthread_key_create(&rtThreadKey, rtThreadExit);
+	for (unsigned int i=0; i < RT_SLAB_CLASSES; i++) {
+		rtSlabDepots[i] = new RtSlabDepot(RT_SLAB_MIN_SIZE << i);
+	}
+	pthread_key_create(&rtHeapKey, rtHeapExit);
+}
+
+// returns the calling thread's output buffers, creating them on first use
+inline RtThreadOut *getThreadOut() {
+	RtThreadOut *acc = (RtThreadOut *)pthread_getspecific(rtThreadKey);
+	if (acc == NULL) {
+		acc = new RtThreadOut();
+		pthread_setspecific(rtThreadKey, acc);
+	}
+	return acc;
+}
+
+// returns the calling thread's heap, creating it on first use
+inline RtThreadHeap *getThreadHeap() {
+	RtThreadHeap *acc = (RtThreadHeap *)pthread_getspecific(rtHeapKey);
+	if (acc == NULL) {
+		acc = new RtThreadHeap();
+		pthread_setspecific(rtHeapKey, acc);
+	}
+	return acc;
+}
+
+// returns the slab size class that holds arrays of the given size, which must be at most RT_SLAB_MAX_SIZE
+inline unsigned int slabClass(size_t size) {
+	if (size <= RT_SLAB_MIN_SIZE) {
+		return 0;
+	}
+	return (sizeof(unsigned long long) * CHAR_BIT - __builtin_clzll((unsigned long long)(size - 1)) - __builtin_ctz(RT_SLAB_MIN_SIZE));
+}
+
+// runs func over count iterations; if parallel is set and there are enough iterations for more than one chunk of at least minChunk of them,
+// the chunks are shared out with the idle workers, and if holding is set, the chunks' output is appended in index order; returns once every iteration has finished
+void runRange(RtRangeFunc func, void *arg, int64_t count, int64_t minChunk, bool parallel, bool holding) {
+	pthread_mutex_lock(&(rtScheduler->lock));
+	unsigned int numWorkers = rtScheduler->numWorkers;
+	pthread_mutex_unlock(&(rtScheduler->lock));
+	int64_t numChunks = count / minChunk;
+	if (numChunks > (int64_t)numWorkers * RT_RANGE_CHUNKS_PER_WORKER) {
+		numChunks = (int64_t)numWorkers * RT_RANGE_CHUNKS_PER_WORKER;
+	}
+	if (!parallel || numWorkers <= 1 || numChunks <= 1) { // short and serial ranges just run in place
+		func(arg, 0, count);
+		return;
+	}
+	// hand the chunks out to the helpers and to ourselves, and wait for the ones that are still running elsewhere
+	unsigned int numHelpers = ((int64_t)numWorkers - 1 < numChunks - 1) ? numWorkers - 1 : (unsigned int)(numChunks - 1);
+	RtRangeJob *job = new RtRangeJob(func, arg, count, (unsigned int)numChunks, numHelpers + 1, holding);
+	for (unsigned int i=0; i < numHelpers; i++) {
+		rtScheduler->schedule(rtRangeHelper, job);
+	}
+	while (job->runChunk());
+	pthread_mutex_lock(&(job->lock));
+	while (job->numDone < job->numChunks) {
+		pthread_cond_wait(&(job->done), &(job->lock));
+	}
+	pthread_mutex_unlock(&(job->lock));
+	// append the chunks' output in order
+	if (holding) {
+		RtThreadOut *threadOut = getThreadOut();
+		for (unsigned int i=0; i < job->numChunks; i++) {
+			threadOut->adopt(*(job->outs[i]));
+			delete job->outs[i];
+		}
+	}
+	job->release();
+}
+
+// runs the given filled block of a batch; a block whose body writes output hands the output over right away, so that the next block's output can't overtake it
+void runBatchBlock(RtBatchBlock *block) {
+	int access = block->batch->access;
+	runRange(rtBatchRange, block, block->count, RT_BATCH_MIN_CHUNK, !(access & ACCESS_WRITES_LATCHES), access & ACCESS_WRITES_OUTPUT);
+	if (access & ACCESS_WRITES_OUTPUT) {
+		getThreadOut()->yield();
+	}
+	delete block;
+}
+
+// formats x in decimal into the end of the given buffer, two digits at a time; returns a pointer to the first digit
+char *formatInt(char *bufEnd, int64_t x) {
+	static const char digitPairs[] =
+		"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+		"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+	uint64_t u = (x < 0) ? -(uint64_t)x : (uint64_t)x;
+	char *p = bufEnd;
+	while (u >= 100) {
+		unsigned int pair = (unsigned int)(u % 100) * 2;
+		u /= 100;
+		*--p = digitPairs[pair + 1];
+		*--p = digitPairs[pair];
+	}
+	if (u >= 10) {
+		*--p = digitPairs[u*2 + 1];
+		*--p = digitPairs[u*2];
+	} else {
+		*--p = (char)('0' + u);
+	}
+	if (x < 0) {
+		*--p = '-';
+	}
+	return p;
+}
+
+// returns the number of characters that formatInt() produces for x
+size_t intStringLength(int64_t x) {
+	uint64_t u = (x < 0) ? -(uint64_t)x : (uint64_t)x;
+	size_t acc = (x < 0) ? 2 : 1;
+	for (; u >= 10; u /= 10) {
+		acc++;
+	}
+	return acc;
+}
+
+// formats x in FLOAT_STRING_FORMAT into dst, which must have room for MAX_FLOAT_STRING_LENGTH bytes; returns the number of characters written
+// whole numbers below 1e6 in magnitude print the same under %g as they do as integers, so they skip snprintf(3)
+size_t formatFloat(char *dst, double x) {
+	if (x > -1e6 && x < 1e6 && x == (double)(int64_t)x && !(x == 0 && signbit(x))) {
+		int64_t i = (int64_t)x;
+		size_t length = intStringLength(i);
+		formatInt(dst + length, i);
+		return length;
+	}
+	int length = snprintf(dst, MAX_FLOAT_STRING_LENGTH, FLOAT_STRING_FORMAT, x); // same format as constant folding
+	return (length < MAX_FLOAT_STRING_LENGTH) ? length : MAX_FLOAT_STRING_LENGTH-1;
+}
+
+// parses the longest prefix of token that makes up a decimal integer; overflow wraps around
+int64_t parseInt(const char *token) {
+	const char *p = token;
+	bool negative = false;
+	if (*p == '-' || *p == '+') {
+		negative = (*p == '-');
+		p++;
+	}
+	uint64_t acc = 0;
+	for (; *p >= '0' && *p <= '9'; p++) {
+		acc = acc*10 + (*p - '0');
+	}
+	return (int64_t)(negative ? -acc : acc);
+}
+
+// parses the longest prefix of token that makes up a floating-point number
+// the common case of at most 15 significant digits and a small exponent is computed exactly from a single multiplication or division;
+// everything else (long mantissas, large exponents, hexadecimal, infinities, NaNs) goes through strtod
+double parseFloat(const char *token) {
+	static const double powersOf10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+	const char *p = token;
+	bool negative = false;
+	if (*p == '-' || *p == '+') {
+		negative = (*p == '-');
+		p++;
+	}
+	uint64_t mantissa = 0;
+	int numDigits = 0; // the number of significant digits seen
+	int exponent = 0;
+	bool anyDigits = false;
+	for (; *p >= '0' && *p <= '9'; p++) {
+		anyDigits = true;
+		if (mantissa != 0 || *p != '0') {
+			if (++numDigits > 15) {
+				return strtod(token, NULL);
+			}
+			mantissa = mantissa*10 + (*p - '0');
+		}
+	}
+	if (*p == 'x' || *p == 'X') {
+		return strtod(token, NULL);
+	}
+	if (*p == '.') {
+		for (p++; *p >= '0' && *p <= '9'; p++) {
+			anyDigits = true;
+			if (mantissa != 0 || *p != '0') {
+				if (++numDigits > 15) {
+					return strtod(token, NULL);
+				}
+				mantissa = mantissa*10 + (*p - '0');
+			}
+			exponent--;
+		}
+	}
+	if (!anyDigits) {
+		return strtod(token, NULL);
+	}
+	if (*p == 'e' || *p == 'E') {
+		const char *expStart = p+1;
+		bool expNegative = false;
+		if (*expStart == '-' || *expStart == '+') {
+			expNegative = (*expStart == '-');
+			expStart++;
+		}
+		if (*expStart >= '0' && *expStart <= '9') {
+			int expValue = 0;
+			for (p = expStart; *p >= '0' && *p <= '9'; p++) {
+				if (expValue > 1000) { // far out of the fast path's range, and about to overflow
+					return strtod(token, NULL);
+				}
+				expValue = expValue*10 + (*p - '0');
+			}
+			exponent += expNegative ? -expValue : expValue;
+		}
+	}
+	double acc;
+	if (exponent == 0) {
+		acc = (double)mantissa;
+	} else if (exponent > 0 && exponent <= 22) {
+		acc = (double)mantissa * powersOf10[exponent];
+	} else if (exponent < 0 && exponent >= -22) {
+		acc = (double)mantissa / powersOf10[-exponent];
+	} else {
+		return strtod(token, NULL);
+	}
+	return negative ? -acc : acc;
+}
+
+// runtime entry points
+
+extern "C" {
+
+// sets up the standard streams; compiled programs call this before running any label, but it's safe to call more than once
+void rtInit() {
+	pthread_once(&rtInitOnce, rtInitOnceFunc);
+}
+
+// writes out all pending output; compiled programs call this once all labels have finished
+void rtExit() {
+	rtInit();
+	rtFlush();
+}
+
+// hands over the calling thread's buffered output; the scheduler calls this whenever a label finishes
+void rtYield() {
+	rtInit();
+	getThreadOut()->yield();
+}
+
+// writes out the calling thread's buffered output, and everything queued by the other threads
+void rtFlush() {
+	rtYield();
+	for (int i=0; i < RT_NUM_STREAMS; i++) {
+		rtOutStreams[i]->flush();
+	}
+}
+
+void rtOutString(int stream, const char *s, size_t length) {
+	rtInit();
+	getThreadOut()->append(stream, s, length);
+}
+
+void rtOutInt(int stream, int64_t x) {
+	char tempS[MAX_INT_STRING_LENGTH];
+	char *start = formatInt(tempS + sizeof(tempS), x);
+	rtOutString(stream, start, (tempS + sizeof(tempS)) - start);
+}
+
+void rtOutFloat(int stream, double x) {
+	char tempS[MAX_FLOAT_STRING_LENGTH];
+	rtOutString(stream, tempS, formatFloat(tempS, x));
+}
+
+void rtOutChar(int stream, char c) {
+	rtOutString(stream, &c, 1);
+}
+
+void rtOutBool(int stream, int b) {
+	if (b) {
+		rtOutString(stream, "true", 4);
+	} else {
+		rtOutString(stream, "false", 5);
+	}
+}
+
+// reads the next whitespace-delimited token as an integer; a token that doesn't start with a number, or the end of the input, reads as 0
+int64_t rtInInt() {
+	rtInit();
+	char token[RT_IN_TOKEN_LENGTH];
+	pthread_mutex_lock(&(rtIn->lock));
+	rtIn->getToken(token);
+	pthread_mutex_unlock(&(rtIn->lock));
+	return parseInt(token);
+}
+
+// reads the next whitespace-delimited token as a float; a token that doesn't start with a number, or the end of the input, reads as 0
+double rtInFloat() {
+	rtInit();
+	char token[RT_IN_TOKEN_LENGTH];
+	pthread_mutex_lock(&(rtIn->lock));
+	rtIn->getToken(token);
+	pthread_mutex_unlock(&(rtIn->lock));
+	return parseFloat(token);
+}
+
+// reads the next byte of input, whitespace included; the end of the input reads as '\0'
+char rtInChar() {
+	rtInit();
+	pthread_mutex_lock(&(rtIn->lock));
+	int c = rtIn->peek();
+	if (c >= 0) {
+		rtIn->pos++;
+	}
+	pthread_mutex_unlock(&(rtIn->lock));
+	return (c >= 0) ? (char)c : '\0';
+}
+
+// reads the rest of the current line, without its newline, into a newly malloc()ed, null-terminated string stored in s; returns the string's length
+size_t rtInString(char **s) {
+	rtInit();
+	size_t length = 0;
+	size_t capacity = 64;
+	char *acc = (char *)malloc(capacity);
+	pthread_mutex_lock(&(rtIn->lock));
+	for(;;) {
+		if (rtIn->pos == rtIn->end && !rtIn->fill()) {
+			break;
+		}
+		// copy up to the newline (or the end of the buffer) in one go
+		char *start = rtIn->buf + rtIn->pos;
+		size_t avail = rtIn->end - rtIn->pos;
+		char *newline = (char *)memchr(start, '\n', avail);
+		size_t span = (newline != NULL) ? (size_t)(newline - start) : avail;
+		if (length + span + 1 > capacity) {
+			while (length + span + 1 > capacity) {
+				capacity *= 2;
+			}
+			acc = (char *)realloc(acc, capacity);
+		}
+		memcpy(acc + length, start, span);
+		length += span;
+		rtIn->pos += span;
+		if (newline != NULL) {
+			rtIn->pos++;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&(rtIn->lock));
+	acc[length] = '\0';
+	*s = acc;
+	return length;
+}
+
+// returns the 64-bit FNV-1a hash of the given string; this must agree with hashBytes() in the compiler, which hashes the keys of switch tables
+uint64_t rtHashString(const char *s, size_t length) {
+	uint64_t acc = FNV_OFFSET_BASIS;
+	for (size_t i=0; i < length; i++) {
+		acc ^= (unsigned char)s[i];
+		acc *= FNV_PRIME;
+	}
+	return acc;
+}
+
+// concatenates the given parts into a newly malloc()ed, null-terminated string stored in s; returns the string's length
+// the result is allocated once, at its exact size but for the slack that floats are given, and the parts are formatted straight into it
+size_t rtCatString(char **s, const RtCatPart *parts, size_t numParts) {
+	// size the result
+	size_t capacity = 1;
+	for (size_t i=0; i < numParts; i++) {
+		switch (parts[i].format) {
+			case CAT_FORMAT_STRING:
+				capacity += parts[i].length;
+				break;
+			case CAT_FORMAT_BOOL:
+				capacity += parts[i].word ? 4 : 5;
+				break;
+			case CAT_FORMAT_INT:
+				capacity += intStringLength(parts[i].word);
+				break;
+			case CAT_FORMAT_FLOAT: // formatFloat() needs room for its terminator too
+				capacity += MAX_FLOAT_STRING_LENGTH;
+				break;
+			case CAT_FORMAT_CHAR:
+				capacity++;
+				break;
+		}
+	}
+	// format the parts into place
+	char *acc = (char *)malloc(capacity);
+	size_t length = 0;
+	for (size_t i=0; i < numParts; i++) {
+		switch (parts[i].format) {
+			case CAT_FORMAT_STRING:
+				memcpy(acc + length, parts[i].s, parts[i].length);
+				length += parts[i].length;
+				break;
+			case CAT_FORMAT_BOOL:
+				if (parts[i].word) {
+					memcpy(acc + length, "true", 4);
+					length += 4;
+				} else {
+					memcpy(acc + length, "false", 5);
+					length += 5;
+				}
+				break;
+			case CAT_FORMAT_INT:
+				length += intStringLength(parts[i].word);
+				formatInt(acc + length, parts[i].word);
+				break;
+			case CAT_FORMAT_FLOAT:
+				length += formatFloat(acc + length, parts[i].f);
+				break;
+			case CAT_FORMAT_CHAR:
+				acc[length++] = (char)parts[i].word;
+				break;
+		}
+	}
+	acc[length] = '\0';
+	*s = acc;
+	return length;
+}
+
+// allocates storage for a fixed-extent array of the given size; arrays of up to RT_SLAB_MAX_SIZE bytes come out of the calling thread's slab free lists
+void *rtAllocArray(size_t size) {
+	if (size > RT_SLAB_MAX_SIZE) {
+		return malloc(size);
+	}
+	rtInit();
+	return getThreadHeap()->allocBlock(slabClass(size));
+}
+
+// frees an array allocated by rtAllocArray() with the same size; it can be freed by a different thread than the one that allocated it
+void rtFreeArray(void *array, size_t size) {
+	if (size > RT_SLAB_MAX_SIZE) {
+		free(array);
+		return;
+	}
+	getThreadHeap()->freeBlock(array, slabClass(size));
+}
+
+// returns a mark for the calling thread's pool storage; a block that allocates pool instances takes a mark on entry, and releases it once it completes
+void *rtPoolMark() {
+	rtInit();
+	return getThreadHeap()->bump;
+}
+
+// allocates size bytes of pool storage, aligned to RT_POOL_ALIGN; it lives until the mark taken before it is released
+void *rtAllocPool(size_t size) {
+	return getThreadHeap()->allocPool(size);
+}
+
+// releases all of the calling thread's pool storage allocated since the given mark, in one go
+void rtPoolRelease(void *mark) {
+	getThreadHeap()->releasePool((char *)mark);
+}
+
+// runs the given entry label, and everything that it schedules, on a worker per processor; returns once all work has finished
+void rtRun(RtLabelFunc func, void *arg) {
+	rtInit();
+	long numProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+	rtScheduler->run(func, arg, (numProcessors > 0) ? (unsigned int)numProcessors : 1);
+}
+
+// runs a counted range of count iterations; a parallel range that's long enough is split into chunks for the idle workers to help with,
+// and the chunks' output is appended in index order; returns once every iteration has finished
+void rtRange(RtRangeFunc func, void *arg, int64_t count, int parallel) {
+	if (count <= 0) {
+		return;
+	}
+	rtInit();
+	runRange(func, arg, count, RT_RANGE_MIN_CHUNK, parallel, true);
+}
+
+// creates a batch for the stream destreamed by the given body, whose access is given as ACCESS_ flags
+RtBatch *rtNewBatch(RtBatchFunc func, void *arg, int access) {
+	rtInit();
+	return (new RtBatch(func, arg, access));
+}
+
+// sends an element to a batched stream; the body runs on the current block once it fills
+void rtPushBatch(RtBatch *batch, uint64_t element) {
+	if (batch->push(element)) {
+		rtFlushBatch(batch);
+	}
+}
+
+// runs the body on the elements pushed so far; compiled code calls this at the end of every label that sends to a batched stream
+// a pure block runs right away, alongside any others; the blocks of a body that writes latches or output are queued, and run in order by whichever thread isn't waiting on another
+void rtFlushBatch(RtBatch *batch) {
+	pthread_mutex_lock(&(batch->lock));
+	RtBatchBlock *block = batch->take();
+	if (block == NULL) {
+		pthread_mutex_unlock(&(batch->lock));
+		return;
+	}
+	if (!(batch->access & (ACCESS_WRITES_LATCHES | ACCESS_WRITES_OUTPUT))) {
+		pthread_mutex_unlock(&(batch->lock));
+		runBatchBlock(block);
+		return;
+	}
+	if (batch->pendingTail != NULL) {
+		batch->pendingTail->next = block;
+	} else {
+		batch->pendingHead = block;
+	}
+	batch->pendingTail = block;
+	if (batch->running) { // if another thread is already running the blocks, it'll get to this one in turn
+		pthread_mutex_unlock(&(batch->lock));
+		return;
+	}
+	batch->running = true;
+	while (batch->pendingHead != NULL) {
+		block = batch->pendingHead;
+		batch->pendingHead = block->next;
+		if (batch->pendingHead == NULL) {
+			batch->pendingTail = NULL;
+		}
+		pthread_mutex_unlock(&(batch->lock));
+		runBatchBlock(block);
+		pthread_mutex_lock(&(batch->lock));
+	}
+	batch->running = false;
+	pthread_cond_broadcast(&(batch->idle));
+	pthread_mutex_unlock(&(batch->lock));
+}
+
+// runs the body on whatever is left of a batched stream, waits for any blocks still running in order elsewhere, and deletes the batch
+void rtFreeBatch(RtBatch *batch) {
+	rtFlushBatch(batch);
+	pthread_mutex_lock(&(batch->lock));
+	while (batch->running) {
+		pthread_cond_wait(&(batch->idle), &(batch->lock));
+	}
+	pthread_mutex_unlock(&(batch->lock));
+	delete batch;
+}
+
+// schedules the given label to run as soon as a worker is free
+void rtSchedule(RtLabelFunc func, void *arg) {
+	rtInit();
+	rtScheduler->schedule(func, arg);
+}
+
+// std.delay; schedules the given label to run once ms milliseconds have passed
+void rtDelay(RtLabelFunc func, void *arg, int64_t ms) {
+	rtInit();
+	rtScheduler->delay(func, arg, ms);
+}
+
+// points the standard streams at the given file descriptors, after writing out everything pending and dropping any buffered input
+void rtRedirect(int inFd, int outFd, int errFd) {
+	rtFlush();
+	rtOutStreams[RT_STREAM_OUT]->fd = outFd;
+	rtOutStreams[RT_STREAM_OUT]->eager = isatty(outFd);
+	rtOutStreams[RT_STREAM_ERR]->fd = errFd;
+	pthread_mutex_lock(&(rtIn->lock));
+	rtIn->fd = inFd;
+	rtIn->pos = rtIn->end = 0;
+	rtIn->eof = false;
+	rtIn->interactive = isatty(inFd);
+	pthread_mutex_unlock(&(rtIn->lock));
+}
+
+}
@@ -0,0 +1,367 @@
+#ifndef _RUNTIME_H_
+#define _RUNTIME_H_
+
+// the runtime is linked into compiled ANI programs, so it deliberately leaves out the compiler's headers and standard library streams
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "constantDefs.h"
+
+// runtime output stream specifiers
+#define RT_STREAM_OUT 0
+#define RT_STREAM_ERR 1
+#define RT_NUM_STREAMS 2
+
+// slab size classes; class n holds blocks of RT_SLAB_MIN_SIZE << n bytes
+#define RT_SLAB_MAX_SIZE (RT_SLAB_MIN_SIZE << (RT_SLAB_CLASSES - 1))
+
+// timer wheel geometry
+#define RT_TIMER_SLOTS (1 << RT_TIMER_SLOT_BITS)
+#define RT_TIMER_SLOT_MASK (RT_TIMER_SLOTS - 1)
+#define RT_TIMER_MAX_TICKS ((((uint64_t)1) << (RT_TIMER_SLOT_BITS * RT_TIMER_LEVELS)) - 1)
+
+// the code of a label, as compiled; arg is the state that the label was scheduled with
+typedef void (*RtLabelFunc)(void *arg);
+// the body of a counted range, as compiled; runs the iterations from begin up to (but not including) end
+typedef void (*RtRangeFunc)(void *arg, int64_t begin, int64_t end);
+// the body of a destream batch, as compiled; runs the iterations for elements[begin] up to (but not including) elements[end]
+typedef void (*RtBatchFunc)(void *arg, const uint64_t *elements, int64_t begin, int64_t end);
+
+// RtChunk classes
+
+// usage: a block of buffered output bytes; chunks are filled by a single thread, then queued on their stream in order
+class RtChunk {
+	public:
+		// data members
+		char *data; // the buffered bytes
+		size_t length; // the number of bytes used
+		size_t capacity; // the number of bytes allocated
+		RtChunk *next; // the next chunk in the queue or free list that this chunk is on
+		// allocators/deallocators
+		RtChunk(size_t capacity);
+		~RtChunk();
+};
+
+// RtOutStream classes
+
+// usage: the process-wide half of an output stream; threads hand over their full chunks here, and the chunks are written out in large batches
+class RtOutStream {
+	public:
+		// data members
+		int fd; // the file descriptor that this stream writes to
+		bool eager; // whether queued output is written out every time a thread yields (for terminals and std.err), rather than only once a batch fills
+		RtChunk *queueHead; // the first chunk waiting to be written
+		RtChunk *queueTail; // the last chunk waiting to be written
+		size_t queueLength; // the total number of bytes waiting to be written
+		RtChunk *freeList; // spent chunks of the default size, kept for reuse
+		pthread_mutex_t queueLock; // protects the queue and the free list
+		pthread_mutex_t writeLock; // held while a batch is being written; always acquired under queueLock, so batches go out in queue order
+		// allocators/deallocators
+		RtOutStream(int fd, bool eager);
+		~RtOutStream();
+		// core methods
+		RtChunk *getChunk();
+		void enqueue(RtChunk *chunk, bool flush);
+		void flush();
+};
+
+// RtThreadOut classes
+
+// usage: the per-thread half of the output streams; elements are formatted straight into the thread's current chunk, without any locking
+// a holding buffer keeps its spent chunks to itself rather than handing them over, until they're adopted by a buffer whose output comes before theirs
+class RtThreadOut {
+	public:
+		// data members
+		RtChunk *chunks[RT_NUM_STREAMS]; // the chunk being filled for each stream, or NULL if there is none
+		bool holding; // whether spent chunks are held rather than handed over to their streams
+		RtChunk *heldHeads[RT_NUM_STREAMS]; // the first held chunk of each stream
+		RtChunk *heldTails[RT_NUM_STREAMS]; // the last held chunk of each stream
+		// allocators/deallocators
+		RtThreadOut(bool holding = false);
+		~RtThreadOut();
+		// core methods
+		void handOver(int stream, RtChunk *chunk, bool flush);
+		void append(int stream, const char *s, size_t length);
+		void yield();
+		void adopt(RtThreadOut &other);
+};
+
+// RtInStream classes
+
+// usage: a large read buffer over the program's input, shared by all of the std.in* nodes
+class RtInStream {
+	public:
+		// data members
+		int fd; // the file descriptor that this stream reads from
+		char *buf; // the read buffer
+		size_t pos; // the offset of the next unread byte in buf
+		size_t end; // the offset one past the last valid byte in buf
+		bool eof; // whether the input has been exhausted
+		bool interactive; // whether the input is a terminal, in which case pending output is written out before every read
+		pthread_mutex_t lock; // serializes the readers, so that every token goes to exactly one of them
+		// allocators/deallocators
+		RtInStream(int fd);
+		~RtInStream();
+		// core methods
+		bool fill();
+		int peek();
+		void skipSpace();
+		size_t getToken(char *token);
+};
+
+// RtCatPart classes
+
+// usage: one part of a string concatenation; compiled code fills in an array of these, and rtCatString() sizes and formats the result in one go
+class RtCatPart {
+	public:
+		// data members
+		int format; // how this part is formatted (CAT_FORMAT_ defines in constantDefs.h)
+		const char *s; // the bytes of a CAT_FORMAT_STRING part
+		size_t length; // the number of bytes in s
+		int64_t word; // the value of a CAT_FORMAT_BOOL, CAT_FORMAT_INT, or CAT_FORMAT_CHAR part
+		double f; // the value of a CAT_FORMAT_FLOAT part
+};
+
+// RtRangeJob classes
+
+// usage: a counted range that's been split into chunks to run in parallel; the caller and a number of helper tasks claim the chunks in order,
+// and if the job is holding, the output of every chunk is held until the caller appends it in index order once they've all finished
+class RtRangeJob {
+	public:
+		// data members
+		RtRangeFunc func; // the body of the range
+		void *arg; // the state to run the body with
+		int64_t count; // the number of iterations
+		int64_t chunkSize; // the number of iterations per chunk (the last chunk may be shorter)
+		unsigned int numChunks; // the number of chunks
+		unsigned int nextChunk; // the next chunk to be claimed
+		unsigned int numDone; // the number of chunks that have finished
+		unsigned int refs; // the number of threads (the caller and the helper tasks) that may still use this job
+		bool holding; // whether every chunk's output is held, to be appended in index order; otherwise, chunks write straight into their thread's buffers
+		RtThreadOut **outs; // the held output of every finished chunk (NULL for chunks that didn't hold their output)
+		pthread_mutex_t lock; // protects the counters and outs
+		pthread_cond_t done; // signalled when the last chunk finishes
+		// allocators/deallocators
+		RtRangeJob(RtRangeFunc func, void *arg, int64_t count, unsigned int numChunks, unsigned int refs, bool holding);
+		~RtRangeJob();
+		// core methods
+		bool runChunk();
+		void release();
+};
+
+// RtBatch classes
+
+class RtBatch;
+
+// usage: one batch's worth of the elements sent to a batched stream, as handed to the body all at once
+class RtBatchBlock {
+	public:
+		// data members
+		RtBatch *batch; // the batch that this block belongs to
+		uint64_t *elements; // the elements, as words
+		size_t count; // the number of elements
+		RtBatchBlock *next; // the next block waiting to be run
+		// allocators/deallocators
+		RtBatchBlock(RtBatch *batch);
+		~RtBatchBlock();
+};
+
+// usage: a stream that's destreamed by a batched body; producers push elements into the current block, and once it fills (or a producer flushes it),
+// the block is run by the body in one go; bodies that write latches or output run their blocks one at a time, in the order that they were filled
+class RtBatch {
+	public:
+		// data members
+		RtBatchFunc func; // the body
+		void *arg; // the state to run the body with
+		int access; // how the body touches state outside of itself (ACCESS_ flags in constantDefs.h)
+		RtBatchBlock *current; // the block being filled, or NULL if there is none
+		RtBatchBlock *pendingHead; // the first filled block waiting for its turn to run
+		RtBatchBlock *pendingTail; // the last filled block waiting for its turn to run
+		bool running; // whether a thread is running this batch's blocks in order
+		pthread_mutex_t lock; // protects everything above but func, arg, and access
+		pthread_cond_t idle; // signalled when the thread running the blocks in order runs out of them
+		// allocators/deallocators
+		RtBatch(RtBatchFunc func, void *arg, int access);
+		~RtBatch();
+		// core methods
+		bool push(uint64_t element);
+		RtBatchBlock *take();
+};
+
+// RtSlabDepot classes
+
+// usage: the process-wide store of free slab blocks of one size class; threads trade whole batches of (usually RT_SLAB_BATCH) blocks with it,
+// so its lock is only taken once every RT_SLAB_BATCH allocations (or frees) at most; a free block links to the next block of its batch through its first word,
+// and the first block of a batch links to the next batch through its second word
+// slabs are carved up when the depot runs dry, and are kept for the life of the process
+class RtSlabDepot {
+	public:
+		// data members
+		size_t blockSize; // the size of this class's blocks, in bytes
+		void *batches; // the first block of the first free batch, or NULL if there are none
+		pthread_mutex_t lock; // protects batches
+		// allocators/deallocators
+		RtSlabDepot(size_t blockSize);
+		~RtSlabDepot();
+		// core methods
+		void put(void *batch);
+		void *take();
+};
+
+// RtPoolRegion classes
+
+// usage: a block of memory that pool storage is bump-allocated out of; a thread's regions form a stack, so that releasing a pool mark pops every region above it
+class RtPoolRegion {
+	public:
+		// data members
+		char *data; // the region's bytes
+		size_t capacity; // the number of bytes in data
+		RtPoolRegion *prev; // the region below this one on the stack (or the next region on the spare list)
+		// allocators/deallocators
+		RtPoolRegion(size_t capacity);
+		~RtPoolRegion();
+};
+
+// RtThreadHeap classes
+
+// usage: the per-thread half of the allocator; fixed-extent arrays come out of per-size-class free lists that are refilled from the depots (or from fresh slabs),
+// and pools are bump-allocated out of a stack of regions that's unwound in bulk when the block that created them completes; neither touches a lock in the common case
+class RtThreadHeap {
+	public:
+		// data members
+		void *freeLists[RT_SLAB_CLASSES]; // the free blocks of each size class, linked through their first word
+		unsigned int freeCounts[RT_SLAB_CLASSES]; // the number of blocks on each free list
+		RtPoolRegion *region; // the region that pools are being allocated out of, or NULL if there is none
+		char *bump; // the next free byte of region
+		RtPoolRegion *spareRegions; // released regions of the default size, kept for reuse
+		unsigned int numSpareRegions; // the number of regions on spareRegions
+		// allocators/deallocators
+		RtThreadHeap();
+		~RtThreadHeap();
+		// core methods
+		void *allocBlock(unsigned int sizeClass);
+		void freeBlock(void *block, unsigned int sizeClass);
+		void *allocPool(size_t size);
+		void releasePool(char *mark);
+};
+
+// RtTask classes
+
+// usage: a scheduled run of a label; while it's waiting, a task sits on exactly one list (the run queue, a timer wheel slot, or the free list)
+class RtTask {
+	public:
+		// data members
+		RtLabelFunc func; // the label to run
+		void *arg; // the state to run the label with
+		uint64_t expiry; // the tick at which a delayed task becomes ready
+		RtTask *next; // the next task on the list that this task is on
+};
+
+// RtTimerWheel classes
+
+// usage: parks delayed tasks until their expiry tick, in RT_TIMER_LEVELS levels of RT_TIMER_SLOTS slots each;
+// level n holds the tasks due within RT_TIMER_SLOTS^(n+1) ticks, filed by bits [n*RT_TIMER_SLOT_BITS, (n+1)*RT_TIMER_SLOT_BITS) of their expiry,
+// and a slot of a higher level is cascaded into the levels below it once the lower bits of the current tick wrap around to it
+// parking a task and releasing it are both O(1), and every task is cascaded at most RT_TIMER_LEVELS-1 times
+class RtTimerWheel {
+	public:
+		// data members
+		RtTask *slots[RT_TIMER_LEVELS][RT_TIMER_SLOTS]; // the parked tasks of every slot, as singly linked lists
+		uint64_t occupied[RT_TIMER_SLOTS / 64]; // bitmap of the nonempty slots of level 0, for finding the next expiry quickly
+		uint64_t now; // the last tick that has been processed
+		unsigned long size; // the number of parked tasks
+		// allocators/deallocators
+		RtTimerWheel();
+		~RtTimerWheel();
+		// core methods
+		void add(RtTask *task, RtTask *&ready);
+		void cascade(unsigned int level, unsigned int slot, RtTask *&ready);
+		void advance(uint64_t tick, RtTask *&ready);
+		uint64_t nextExpiry() const;
+};
+
+// RtScheduler classes
+
+// usage: runs labels on a pool of worker threads; a worker runs ready tasks in order, releases the delayed tasks whose time has come as it goes,
+// and sleeps until the next expiry (or until new work arrives) when there's nothing to run
+class RtScheduler {
+	public:
+		// data members
+		pthread_mutex_t lock; // protects everything below
+		pthread_cond_t wake; // signalled when work arrives, and when the scheduler finishes
+		pthread_cond_t timekeeperWake; // signalled when a task is parked with an earlier expiry than the one the timekeeping worker is sleeping until
+		RtTask *readyHead; // the first task of the run queue
+		RtTask *readyTail; // the last task of the run queue
+		RtTask *freeList; // spent tasks, kept for reuse
+		RtTimerWheel timers; // the delayed tasks
+		unsigned int numRunning; // the number of tasks currently running
+		unsigned int numWorkers; // the number of workers in the current run, or 0 outside of run()
+		bool timekeeping; // whether a worker is sleeping until the next expiry; the other idle workers sleep until woken
+		uint64_t timekeeperTick; // the tick that the timekeeping worker is sleeping until
+		bool done; // whether all work has finished
+		struct timespec start; // the time of tick 0
+		// allocators/deallocators
+		RtScheduler();
+		~RtScheduler();
+		// core methods
+		uint64_t currentTick() const;
+		RtTask *getTask(RtLabelFunc func, void *arg);
+		void pushReady(RtTask *task);
+		void schedule(RtLabelFunc func, void *arg);
+		void delay(RtLabelFunc func, void *arg, int64_t ms);
+		void work();
+		void run(RtLabelFunc func, void *arg, unsigned int numWorkers);
+};
+
+// runtime entry points; these are called directly by compiled code, so they use C linkage
+
+extern "C" {
+
+// setup and teardown
+void rtInit();
+void rtExit();
+void rtYield();
+void rtFlush();
+
+// output; every call appends one element to the given stream
+void rtOutString(int stream, const char *s, size_t length);
+void rtOutInt(int stream, int64_t x);
+void rtOutFloat(int stream, double x);
+void rtOutChar(int stream, char c);
+void rtOutBool(int stream, int b);
+
+// input; every call consumes one element from the program's input
+int64_t rtInInt();
+double rtInFloat();
+char rtInChar();
+size_t rtInString(char **s);
+
+// strings
+size_t rtCatString(char **s, const RtCatPart *parts, size_t numParts);
+uint64_t rtHashString(const char *s, size_t length);
+
+// memory
+void *rtAllocArray(size_t size);
+void rtFreeArray(void *array, size_t size);
+void *rtPoolMark();
+void *rtAllocPool(size_t size);
+void rtPoolRelease(void *mark);
+
+// scheduling
+void rtRun(RtLabelFunc func, void *arg);
+void rtRange(RtRangeFunc func, void *arg, int64_t count, int parallel);
+RtBatch *rtNewBatch(RtBatchFunc func, void *arg, int access);
+void rtPushBatch(RtBatch *batch, uint64_t element);
+void rtFlushBatch(RtBatch *batch);
+void rtFreeBatch(RtBatch *batch);
+void rtSchedule(RtLabelFunc func, void *arg);
+void rtDelay(RtLabelFunc func, void *arg, int64_t ms);
+
+// benchmarking and testing hooks
+void rtRedirect(int inFd, int outFd, int errFd);
+
+}
+
+#endif
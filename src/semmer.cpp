@@ -2,6 +2,8 @@
 
 #include "outputOperators.h"
 
+#include "opter.h"
+
 // semmer-global variables
 
 int semmerErrorCode;
@@ -31,31 +33,45 @@ ObjectType *charCompOpType;
 ObjectType *stringCompOpType;
 StdType *stdLibType;
 SymbolTree *stdLib;
-IRTree *nopCode;
+IRModule *irModule; // the module that intermediate code is being generated into
+IRId nopCode;
+unsigned int numInlinedFlows;
+unsigned int numSpecializedFlows;
+unsigned int numSwitchChains; // the number of switches lowered into each dispatch strategy
+unsigned int numSwitchTables;
+unsigned int numSwitchSearches;
+unsigned int numSwitchHashes;
+vector<IRId> *pipePrelude; // the dispatch code of the value switches in the pipe currently being typed, or NULL outside of pipes
+map<IRId, SymbolTree *> pendingSlots; // slot addresses that were generated before layout, and the nodes whose offsets they're waiting on
 
 // SymbolTree functions
 SymbolTree::SymbolTree(int kind, const string &id, Tree *defSite, SymbolTree *copyImportSite) : kind(kind), id(id), defSite(defSite), copyImportSite(copyImportSite), parent(NULL),
-		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0) {
+		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0), numShares(0),
+		offsetByteInternal(OFFSET_BYTE_NULL), laidOut(false), coldOffset(0), layoutSize(0) {
 	if (defSite != NULL) {
 		defSite->env = this;
 	}
 }
 SymbolTree::SymbolTree(int kind, const char *id, Tree *defSite, SymbolTree *copyImportSite) : kind(kind), id(id), defSite(defSite), copyImportSite(copyImportSite), parent(NULL), 
-		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0) {
+		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0), numShares(0),
+		offsetByteInternal(OFFSET_BYTE_NULL), laidOut(false), coldOffset(0), layoutSize(0) {
 	if (defSite != NULL) {
 		defSite->env = this;
 	}
 }
 SymbolTree::SymbolTree(int kind, const string &id, Type *defType, SymbolTree *copyImportSite) : kind(kind), id(id), copyImportSite(copyImportSite), parent(NULL),
-		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0){
+		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0), numShares(0),
+		offsetByteInternal(OFFSET_BYTE_NULL), laidOut(false), coldOffset(0), layoutSize(0){
 	TypeStatus status(defType, NULL); defSite = new Tree(status); defSite->env = this;
 }
 SymbolTree::SymbolTree(int kind, const char *id, Type *defType, SymbolTree *copyImportSite) : kind(kind), id(id), copyImportSite(copyImportSite), parent(NULL),
-		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0){
+		offsetKindInternal(OFFSET_NULL), numRaws(0), numBlocks(0), numPartitions(0), numShares(0),
+		offsetByteInternal(OFFSET_BYTE_NULL), laidOut(false), coldOffset(0), layoutSize(0){
 	TypeStatus status(defType, NULL); defSite = new Tree(status); defSite->env = this;
 }
 SymbolTree::SymbolTree(const SymbolTree &st, SymbolTree *parent, SymbolTree *copyImportSite) : kind(st.kind), id(st.id), defSite(st.defSite), copyImportSite(copyImportSite), parent(parent), children(st.children),
-	offsetKindInternal(st.offsetKindInternal), offsetIndexInternal(st.offsetIndexInternal), numRaws(st.numRaws), numBlocks(st.numBlocks), numPartitions(st.numPartitions) {}
+	offsetKindInternal(st.offsetKindInternal), offsetIndexInternal(st.offsetIndexInternal), numRaws(st.numRaws), numBlocks(st.numBlocks), numPartitions(st.numPartitions), numShares(st.numShares),
+	offsetByteInternal(st.offsetByteInternal), laidOut(st.laidOut), coldOffset(st.coldOffset), layoutSize(st.layoutSize) {}
 SymbolTree::~SymbolTree() {}
 unsigned int SymbolTree::addRaw() {return (numRaws++);}
 unsigned int SymbolTree::addBlock() {return (numBlocks++);}
@@ -85,6 +101,22 @@ void SymbolTree::getOffset() {
 		offsetKindInternal = OFFSET_FREE;
 	}
 }
+// LoopStream functions
+LoopStream::LoopStream() : st(NULL), pipe(NULL), seed(NULL), element(NULL), op(NULL), bound(NULL), block(NULL), producer(NULL) {}
+LoopStream::~LoopStream() {}
+// GenRange functions
+GenRange::GenRange() : pipe(NULL), count(NULL), param(NULL), block(NULL), named(false), parallel(false) {}
+GenRange::~GenRange() {}
+// DestreamBatch functions
+DestreamBatch::DestreamBatch() : pipe(NULL), st(NULL), param(NULL), block(NULL), named(false), access(0) {}
+DestreamBatch::~DestreamBatch() {}
+
+// moves this node into a raw slot of its parent; used for streams that are lowered into loops, which only ever hold a single element
+// must be called before layout, so that the node is laid out with the rest of its parent's raws
+void SymbolTree::setRawOffset() {
+	offsetKindInternal = OFFSET_RAW;
+	offsetIndexInternal = parent->addRaw();
+}
 int SymbolTree::offsetKind() {
 	if (offsetKindInternal == OFFSET_NULL) {
 		getOffset();
@@ -97,6 +129,56 @@ unsigned int SymbolTree::offsetIndex() {
 	}
 	return offsetIndexInternal;
 }
+// returns whether this node holds a value of its own in its parent's layout: declarations, parameters, and the result slots of switches do;
+// filters, blocks, objects, and instantiations are code rather than storage, and the other faked nodes stand in for values stored elsewhere
+bool SymbolTree::hasSlot() const {
+	return (kind == KIND_DECLARATION || kind == KIND_PARAMETER || (kind == KIND_FAKE && id.compare(0, strlen(SWITCH_NODE_STRING), SWITCH_NODE_STRING) == 0));
+}
+// lays out this node's children, in the order of their identifiers: the raw-represented ones go inline at the start, and the handles of the rest
+// (which are only touched to look up the storage that they point to) are kept together in a cold region after them, grouped by offset kind;
+// every slot is a word wide, and parameters whose types aren't known yet (because they're derived from the pipe that feeds them) are kept inline
+void SymbolTree::getLayout() {
+	laidOut = true;
+	vector<SymbolTree *> raws;
+	vector<SymbolTree *> handles[3];
+	for (map<string, SymbolTree *>::const_iterator iter = children.begin(); iter != children.end(); iter++) {
+		SymbolTree *child = (*iter).second;
+		if (child == NULL || child->parent != this || !(child->hasSlot())) {
+			continue;
+		}
+		int childKind = (child->defSite->status.type != NULL) ? child->offsetKind() : OFFSET_RAW;
+		if (childKind == OFFSET_BLOCK) {
+			handles[0].push_back(child);
+		} else if (childKind == OFFSET_PARTITION) {
+			handles[1].push_back(child);
+		} else if (childKind == OFFSET_SHARE) {
+			handles[2].push_back(child);
+		} else {
+			raws.push_back(child);
+		}
+	}
+	layoutSize = 0;
+	for (vector<SymbolTree *>::const_iterator iter = raws.begin(); iter != raws.end(); iter++) {
+		(*iter)->offsetByteInternal = layoutSize;
+		layoutSize += LAYOUT_WORD_SIZE;
+	}
+	coldOffset = layoutSize;
+	for (unsigned int i = 0; i < 3; i++) {
+		for (vector<SymbolTree *>::const_iterator iter = handles[i].begin(); iter != handles[i].end(); iter++) {
+			(*iter)->offsetByteInternal = layoutSize;
+			layoutSize += LAYOUT_WORD_SIZE;
+		}
+	}
+}
+// returns the byte offset of this node within its lexical parent's layout; only valid once layoutSt() has run, since code that's generated
+// before then takes its slot addresses from slotAddress() instead
+unsigned int SymbolTree::offsetByte() const {
+	if (offsetByteInternal == OFFSET_BYTE_NULL) { // can't happen; only nodes with slots are asked for their offsets, and only after layout
+		printError("byte offset of '" << id << "' requested before it was laid out");
+		die(1);
+	}
+	return offsetByteInternal;
+}
 Tree *SymbolTree::offsetExp() const {
 	return (defSite->status.type->offsetExp);
 }
@@ -196,28 +278,28 @@ string SymbolTree::toString(unsigned int tabDepth) {
 			case OFFSET_RAW: {
 				acc += "RAW:";
 				char offsetString[MAX_INT_STRING_LENGTH];
-				sprintf(offsetString, "%u", offsetIndex());
+				sprintf(offsetString, (offsetByteInternal != OFFSET_BYTE_NULL) ? "%u@%u" : "%u", offsetIndex(), offsetByteInternal);
 				acc += offsetString;
 				break;
 			}
 			case OFFSET_BLOCK: {
 				acc += "BLK:";
 				char offsetString[MAX_INT_STRING_LENGTH];
-				sprintf(offsetString, "%u", offsetIndex());
+				sprintf(offsetString, (offsetByteInternal != OFFSET_BYTE_NULL) ? "%u@%u" : "%u", offsetIndex(), offsetByteInternal);
 				acc += offsetString;
 				break;
 			}
 			case OFFSET_PARTITION: {
 				acc += "PRT:";
 				char offsetString[MAX_INT_STRING_LENGTH];
-				sprintf(offsetString, "%u", offsetIndex());
+				sprintf(offsetString, (offsetByteInternal != OFFSET_BYTE_NULL) ? "%u@%u" : "%u", offsetIndex(), offsetByteInternal);
 				acc += offsetString;
 				break;
 			}
 			case OFFSET_SHARE: {
 				acc += "SHA:";
 				char offsetString[MAX_INT_STRING_LENGTH];
-				sprintf(offsetString, "%u", offsetIndex());
+				sprintf(offsetString, (offsetByteInternal != OFFSET_BYTE_NULL) ? "%u@%u" : "%u", offsetIndex(), offsetByteInternal);
 				acc += offsetString;
 				break;
 			}
@@ -372,8 +454,19 @@ void initSemmerGlobals() {
 	stdLibType = new StdType(STD_STD, SUFFIX_LATCH); stdLibType->referensible = false; stdLibType->instantiable = false;
 	// build the standard library node
 	stdLib = new SymbolTree(KIND_STD, STANDARD_LIBRARY_STRING, stdLibType);
-	// build the nop IRTree
-	nopCode = new CodeTree(CATEGORY_NOP);
+	// build the nop code node
+	nopCode = irModule->addNode(CATEGORY_NOP, 0, vector<IRId>());
+	// reset the filter inlining counts
+	numInlinedFlows = 0;
+	numSpecializedFlows = 0;
+	// reset the switch lowering counts
+	numSwitchChains = 0;
+	numSwitchTables = 0;
+	numSwitchSearches = 0;
+	numSwitchHashes = 0;
+	// no pipe is being typed yet
+	pipePrelude = NULL;
+	pendingSlots.clear();
 }
 
 SymbolTree *genDefaultDefs() {
@@ -387,6 +480,14 @@ SymbolTree *genDefaultDefs() {
 	return stRoot;
 }
 
+// returns a suffix that makes a fake SymbolTree node identifier unique;
+// it's fixed-width, so that sibling nodes (and thus an object's instructors and outstructors) are ordered as they appear in the source
+string getFakeIdSuffix() {
+	char tempS[MAX_INT_STRING_LENGTH];
+	sprintf(tempS, "%010u", getUniqueInt());
+	return tempS;
+}
+
 // recursively extracts the appropriate nodes from the given tree and appropriately populates the passed containers
 void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
 	// base case
@@ -431,10 +532,10 @@ void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
 		if (*tree == TOKEN_Block) { // if it's a block node, use a regular identifier
 			kind = KIND_BLOCK;
 			fakeId = BLOCK_NODE_STRING;
-		} else { // else if it's an object node, generate a fake identifier from a hash of the Tree node
+		} else { // else if it's an object node, generate a unique fake identifier
 			kind = KIND_OBJECT;
 			fakeId = OBJECT_NODE_STRING;
-			fakeId += (uintptr_t)tree;
+			fakeId += getFakeIdSuffix();
 		}
 		SymbolTree *blockDef = new SymbolTree(kind, fakeId, tree);
 		// latch the new node into the SymbolTree trunk
@@ -444,9 +545,9 @@ void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
 		buildSt(tree->next, st, importList); // right
 	} else if (*tree == TOKEN_Filter || *tree == TOKEN_ExplicitFilter) { // if it's a filter-style node
 		// allocate the new filter definition node
-		// generate a fake identifier for the filter node from a hash of the Tree node
+		// generate a fake identifier for the filter node that is unique
 		string fakeId(FILTER_NODE_STRING);
-		fakeId += (uintptr_t)tree;
+		fakeId += getFakeIdSuffix();
 		SymbolTree *filterDef = new SymbolTree(KIND_FILTER, fakeId, tree);
 		// parse out the header's parameter declarations and add them to the st
 		Tree *pl = (*(tree->child) == TOKEN_FilterHeader) ? tree->child->child->next : NULL; // RSQUARE, ParamList, RetList, or NULL
@@ -465,9 +566,9 @@ void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
 		buildSt(tree->next, st, importList); // right
 	} else if (*tree == TOKEN_Instructor || *tree == TOKEN_LastInstructor) { // if it's an instructor-style node
 		// allocate the new instructor definition node
-		// generate a fake identifier for the instructor node from a hash of the Tree node
+		// generate a fake identifier for the instructor node that is unique
 		string fakeId(INSTRUCTOR_NODE_STRING);
-		fakeId += (uintptr_t)tree;
+		fakeId += getFakeIdSuffix();
 		SymbolTree *consDef = new SymbolTree(KIND_INSTRUCTOR, fakeId, tree);
 		// .. and link it in
 		*st *= consDef;
@@ -487,9 +588,9 @@ void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
 		buildSt(tree->next, st, importList); // right
 	} else if (*tree == TOKEN_Outstructor) { // if it's an outstructor-style node
 		// allocate the new outstructor definition node
-		// generate a fake identifier for the outstructor node from a hash of the Tree node
+		// generate a fake identifier for the outstructor node that is unique
 		string fakeId(OUTSTRUCTOR_NODE_STRING);
-		fakeId += (uintptr_t)tree;
+		fakeId += getFakeIdSuffix();
 		SymbolTree *consDef = new SymbolTree(KIND_OUTSTRUCTOR, fakeId, tree);
 		// .. and link it in
 		*st *= consDef;
@@ -498,7 +599,7 @@ void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
 		buildSt(tree->next, st, importList); // right
 	} else if (*tree == TOKEN_Instantiation && st->kind != KIND_DECLARATION) { // if it's a non-bound (inlined) instantiation-style node
 		string fakeId(INSTANTIATION_NODE_STRING);
-		fakeId += (uintptr_t)tree;
+		fakeId += getFakeIdSuffix();
 		// allocate the new instantiation node
 		SymbolTree *newDef = new SymbolTree(KIND_INSTANTIATION, fakeId, tree);
 		// ... and link it in
@@ -506,6 +607,17 @@ void buildSt(Tree *tree, SymbolTree *st, vector<SymbolTree *> &importList) {
 		// recurse
 		buildSt(tree->child, newDef, importList); // child of Instantiation
 		buildSt(tree->next, st, importList); // right
+	} else if (*tree == TOKEN_SwitchTerm) { // if it's a switch, reserve a slot for it in case it gets lowered into a select
+		string fakeId(SWITCH_NODE_STRING);
+		fakeId += getFakeIdSuffix();
+		// the slot holds whichever word-sized value the switch selects, so it's laid out as a raw int
+		SymbolTree *slotDef = new SymbolTree(KIND_FAKE, fakeId, stdIntType);
+		*st *= slotDef;
+		// log the slot as the switch's own environment, the way definitions log their nodes
+		tree->env = slotDef;
+		// recurse
+		buildSt(tree->child, st, importList); // child of SwitchTerm
+		buildSt(tree->next, st, importList); // right
 	} else { // else if it's any other kind of node
 		// recurse normally
 		buildSt(tree->child, st, importList); // down
@@ -554,15 +666,18 @@ pair<SymbolTree *, bool> bindId(const string &s, SymbolTree *env, const TypeStat
 	if (id[0] == "..") { // if the identifier begins with a recall
 		Type *recallType = inStatus.type;
 		if (recallType) { // if there's a recall binding passed in, use a fake SymbolTree node for it
-			// generate a fake identifier for the recall binding node from a hash of the recall identifier's Type object
+			// generate a fake identifier for the recall binding node from the address of the recall identifier's Type object
 			string fakeId(FAKE_RECALL_NODE_PREFIX);
-			fakeId += (unsigned int)inStatus;
+			char tempS[MAX_INT_STRING_LENGTH];
+			sprintf(tempS, "%" PRIxPTR, (uintptr_t)inStatus);
+			fakeId += tempS;
 			// check if a SymbolTree node with this identifier already exists -- if so, use it
 			map<string, SymbolTree *>::const_iterator fakeFind = env->children.find(fakeId);
 			if (fakeFind != env->children.end()) { // if we found a match, use it
 				stRoot = (*fakeFind).second;
 			} else { // else if we didn't find a match, create a new fake latch point to use
-				SymbolTree *fakeStNode = new SymbolTree(KIND_FAKE, fakeId);
+				SymbolTree *fakeStNode = new SymbolTree(KIND_FAKE, fakeId, recallType);
+				fakeStNode->defSite->status.code = inStatus.code; // the recalled value, if its code is known
 				// attach the new fake node to the main SymbolTree
 				*env *= fakeStNode;
 				// accept the new fake node as the latch point
@@ -851,6 +966,8 @@ void subImportDecls(vector<SymbolTree *> importList) {
 void semSt(SymbolTree *root, SymbolTree *parent = NULL) {
 	if (root->kind == KIND_DECLARATION || root->kind == KIND_INSTRUCTOR || root->kind == KIND_OUTSTRUCTOR) { // if it's a non-inlined node, derive its type
 		getStatusSymbolTree(root, parent);
+	} else if (root->kind == KIND_PARAMETER && *(root->defSite->child) == TOKEN_Type) { // else if it's an explicitly typed parameter, derive its type so that it can be laid out
+		getStatusSymbolTree(root, parent);
 	}
 	// recurse on this node's children
 	for (map<string, SymbolTree *>::const_iterator iter = root->children.begin(); iter != root->children.end(); iter++) {
@@ -858,6 +975,43 @@ void semSt(SymbolTree *root, SymbolTree *parent = NULL) {
 	}
 }
 
+// lays out all of the nodes under root that have children of their own; logs the number of layouts, and the total sizes of their inline and handle regions
+void layoutSt(SymbolTree *root, unsigned int &numLayouts, unsigned int &hotBytes, unsigned int &coldBytes) {
+	if (root->kind == KIND_STD) { // standard nodes are built into the runtime, so they don't need layouts
+		return;
+	}
+	if (!(root->children.empty())) {
+		root->getLayout();
+		numLayouts++;
+		hotBytes += root->coldOffset;
+		coldBytes += root->layoutSize - root->coldOffset;
+	}
+	for (map<string, SymbolTree *>::const_iterator iter = root->children.begin(); iter != root->children.end(); iter++) {
+		if ((*iter).second != NULL && (*iter).second->parent == root) { // copy-imported children are laid out under the node that they were imported from
+			layoutSt((*iter).second, numLayouts, hotBytes, coldBytes);
+		}
+	}
+}
+
+// returns the address of st's slot in its parent's layout; if the parent hasn't been laid out yet (because the code is being generated while
+// the SymbolTree is still being typed), the address is logged and filled in by patchSlots() once it has
+IRId slotAddress(SymbolTree *st) {
+	if (st->parent != NULL && st->parent->laidOut) {
+		return irModule->addWord(st->offsetByte());
+	}
+	IRId acc = irModule->addWord(OFFSET_BYTE_NULL);
+	pendingSlots.insert(make_pair(acc, st));
+	return acc;
+}
+
+// fills in the slot addresses that were generated before layout
+void patchSlots() {
+	for (map<IRId, SymbolTree *>::const_iterator iter = pendingSlots.begin(); iter != pendingSlots.end(); iter++) {
+		irModule->words[irModule->auxes[(*iter).first]] = (*iter).second->offsetByte();
+	}
+	pendingSlots.clear();
+}
+
 // reports errors; derives the status of this SymbolTree node, as well as deriving its subnode offset properties
 TypeStatus getStatusSymbolTree(SymbolTree *root, SymbolTree *parent, const TypeStatus &inStatus) {
 	GET_STATUS_SYMBOL_TREE_HEADER;
@@ -884,12 +1038,75 @@ TypeStatus getStatusSymbolTree(SymbolTree *root, SymbolTree *parent, const TypeS
 	// generate the intermediate code tree
 	if (root->kind == KIND_DECLARATION || root->kind == KIND_INSTRUCTOR || root->kind == KIND_OUTSTRUCTOR || root->kind == KIND_INSTANTIATION) {
 		returnCode(tree->code());
-	} else if (root->kind == KIND_PARAMETER || root->kind == KIND_FAKE) {
+	} else if (root->kind == KIND_PARAMETER) {
 		returnCode(nopCode);
+	} else if (root->kind == KIND_FAKE) { // keep the code of the recalled value that bindId() logged, if there is one
+		returnCode((tree->status.code != NULL_IR_ID) ? tree->status.code : nopCode);
 	}
 	GET_STATUS_FOOTER;
 }
 
+// derives the constant folding data type of values of the given Type
+int foldType(const Type &type) {
+	if (type.category == CATEGORY_STDTYPE) {
+		switch (((const StdType *)(&type))->kind) {
+			case STD_BOOL:
+				return VALUE_BOOL;
+			case STD_INT:
+				return VALUE_INT;
+			case STD_FLOAT:
+				return VALUE_FLOAT;
+			case STD_CHAR:
+				return VALUE_CHAR;
+			case STD_STRING:
+				return VALUE_STRING;
+			default:
+				break;
+		}
+	}
+	return VALUE_UNKNOWN;
+}
+
+// generates the view that the given extent-subscripted identifier (bound to st, the fake node of its last extent subscript) evaluates to;
+// each extent subscript slices the array or view to its left in place, so no elements are ever copied; returns NULL_IR_ID if the sliced array has no storage of its own
+// reports errors: plain subscripts have no code of their own yet, so the extent subscripts can't follow one
+IRId genSlice(Tree *identifier, SymbolTree *st) {
+	// collect the identifier's subscripts
+	vector<Tree *> accesses;
+	for(const Tree *cur = identifier->child->next->child; cur != NULL; cur = (cur->next->next != NULL) ? cur->next->next->child : NULL) {
+		if (*(cur->next) == TOKEN_ArrayAccess) {
+			accesses.push_back(cur->next);
+		}
+	}
+	// find the array that the trailing run of extent subscripts starts from
+	unsigned int numSlices = 0;
+	SymbolTree *array = st;
+	for (; array->kind == KIND_FAKE && array->id == "[:]"; array = array->parent) {
+		numSlices++;
+	}
+	if (array->kind == KIND_FAKE && array->id == "[]") {
+		Token curToken = identifier->t;
+		semmerError(curToken.fileIndex,curToken.row,curToken.col,"extent subscript of a subscripted element");
+		semmerError(curToken.fileIndex,curToken.row,curToken.col,"-- (identifier is '"<<(string)(*identifier)<<"')");
+		return NULL_IR_ID;
+	}
+	if ((array->kind != KIND_DECLARATION && array->kind != KIND_PARAMETER) || numSlices > accesses.size()) {
+		return NULL_IR_ID;
+	}
+	// the array's slot holds the address of its storage
+	Type *elementType = st->defSite->status.type->copy();
+	elementType->decreaseDepth();
+	uint32_t stride = elementType->storageSize();
+	delete elementType;
+	IRId acc = irModule->addRead(slotAddress(array));
+	for (unsigned int i = accesses.size() - numSlices; i < accesses.size(); i++) {
+		Tree *beginExp = accesses[i]->child->next; // Exp
+		Tree *endExp = beginExp->next->next; // Exp
+		acc = irModule->addSlice(acc, beginExp->castCode(*stdIntType), endExp->castCode(*stdIntType), stride);
+	}
+	return acc;
+}
+
 // typing function definitions
 
 // reports errors
@@ -913,6 +1130,15 @@ TypeStatus getStatusIdentifier(Tree *tree, const TypeStatus &inStatus) {
 		semmerError(curToken.fileIndex,curToken.row,curToken.col,"cannot resolve '"<<id<<"'");
 	}
 	GET_STATUS_CODE;
+	if (tree->status.type == stdBoolLitType) { // if it's a boolean literal, embed its value directly
+		returnCode(irModule->addWord((id == "true") ? 1 : 0));
+	} else if ((st->kind == KIND_DECLARATION || st->kind == KIND_PARAMETER) && st->offsetKind() == OFFSET_RAW) { // else if it's a raw-stored node, read it from its storage slot
+		returnCode(irModule->addRead(slotAddress(st), (foldType(*(tree->status.type)) == VALUE_FLOAT) ? READ_FLOAT : READ_WORD));
+	} else if (st->kind == KIND_FAKE && st->id == "[:]") { // else if it's an extent subscript, take a view of the array's storage
+		returnCode(genSlice(tree, st));
+	} else if (st->kind == KIND_FAKE) { // else if it's a recall, use the code of the recalled value
+		returnCode(st->defSite->status.code);
+	}
 	GET_STATUS_FOOTER;
 }
 
@@ -988,9 +1214,9 @@ TypeStatus getStatusPrimaryBase(Tree *tree, const TypeStatus &inStatus) {
 	} else if (*pbc == TOKEN_PrimaryBase) { // postfix operator application
 		Tree *op = pbc->next->child; // the actual operator token
 		if (*op == TOKEN_DPLUS) {
-			returnCode(new TempTree(new BinOpTree(BINOP_PLUS_INT, pbc->castCode(*stdIntType), new WordTree(1))));
+			returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_PLUS_INT, pbc->castCode(*stdIntType), irModule->addWord(1)))));
 		} else /* if (*op == TOKEN_DMINUS) */ {
-			returnCode(new TempTree(new BinOpTree(BINOP_MINUS_INT, pbc->castCode(*stdIntType), new WordTree(1))));
+			returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_MINUS_INT, pbc->castCode(*stdIntType), irModule->addWord(1)))));
 		}
 	}
 	GET_STATUS_FOOTER;
@@ -1035,9 +1261,9 @@ TypeStatus getStatusPrimary(Tree *tree, const TypeStatus &inStatus) {
 		Tree *primarycn = primaryc->next;
 		Tree *pomocc = primaryc->child->child;
 		if (*pomocc == TOKEN_NOT) {
-			returnCode(new TempTree(new UnOpTree(UNOP_NOT_BOOL, primarycn->castCode(*stdBoolType))));
+			returnCode(foldData(irModule->addTemp(irModule->addUnOp(UNOP_NOT_BOOL, primarycn->castCode(*stdBoolType)))));
 		} else if (*pomocc == TOKEN_COMPLEMENT) {
-			returnCode(new TempTree(new UnOpTree(UNOP_COMPLEMENT_INT, primarycn->castCode(*stdIntType))));
+			returnCode(foldData(irModule->addTemp(irModule->addUnOp(UNOP_COMPLEMENT_INT, primarycn->castCode(*stdIntType)))));
 		} else if (*pomocc == TOKEN_PLUS) {
 			if (*(primarycn->status) >> *stdIntType) {
 				returnCode(primarycn->castCode(*stdIntType));
@@ -1046,9 +1272,9 @@ TypeStatus getStatusPrimary(Tree *tree, const TypeStatus &inStatus) {
 			}
 		} else if (*pomocc == TOKEN_MINUS) {
 			if (*(primarycn->status) >> *stdIntType) {
-				returnCode(new TempTree(new UnOpTree(UNOP_MINUS_INT, primarycn->castCode(*stdIntType))));
+				returnCode(foldData(irModule->addTemp(irModule->addUnOp(UNOP_MINUS_INT, primarycn->castCode(*stdIntType)))));
 			} else /* if (*(primarycn->status) >> *stdFloatType) */ {
-				returnCode(new TempTree(new UnOpTree(UNOP_MINUS_FLOAT, primarycn->castCode(*stdFloatType))));
+				returnCode(foldData(irModule->addTemp(irModule->addUnOp(UNOP_MINUS_FLOAT, primarycn->castCode(*stdFloatType)))));
 			}
 		}
 	}
@@ -1087,11 +1313,11 @@ TypeStatus getStatusBracketedExp(Tree *tree, const TypeStatus &inStatus) {
 		if (exp->next == NULL) { // if it's just a single Exp
 			returnCode(exp->code());
 		} else { // else if it's a true ExpList
-			vector<DataTree *> dataList;
+			vector<IRId> dataList;
 			for (; exp != NULL; exp = (exp->next != NULL) ? exp->next->next->child : NULL) {
-				dataList.push_back((DataTree *)(exp->code()));
+				dataList.push_back((exp->code()));
 			}
-			returnCode(new CompoundTree(dataList));
+			returnCode(irModule->addCompound(dataList));
 		}
 	}
 	GET_STATUS_FOOTER;
@@ -1185,64 +1411,65 @@ TypeStatus getStatusExp(Tree *tree, const TypeStatus &inStatus) {
 		Tree *expLeft = expc;
 		Tree *op = expLeft->next;
 		Tree *expRight = op->next;
+		int compType = (foldType(expLeft->typeRef()) == foldType(expRight->typeRef())) ? foldType(expLeft->typeRef()) : VALUE_UNKNOWN; // the constant folding type of comparison operands
 		switch (op->t.tokenType) {
 			case TOKEN_DOR:
-				returnCode(new TempTree(new BinOpTree(BINOP_DOR_BOOL, expLeft->castCode(*stdBoolType), expRight->castCode(*stdBoolType))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_DOR_BOOL, expLeft->castCode(*stdBoolType), expRight->castCode(*stdBoolType)))));
 			case TOKEN_DAND:
-				returnCode(new TempTree(new BinOpTree(BINOP_DAND_BOOL, expLeft->castCode(*stdBoolType), expRight->castCode(*stdBoolType))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_DAND_BOOL, expLeft->castCode(*stdBoolType), expRight->castCode(*stdBoolType)))));
 			case TOKEN_OR:
-				returnCode(new TempTree(new BinOpTree(BINOP_OR_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_OR_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 			case TOKEN_XOR:
-				returnCode(new TempTree(new BinOpTree(BINOP_XOR_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_XOR_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 			case TOKEN_AND:
-				returnCode(new TempTree(new BinOpTree(BINOP_AND_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_AND_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 			case TOKEN_DEQUALS:
-				returnCode(new TempTree(new BinOpTree(BINOP_DEQUALS, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_DEQUALS, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))), compType));
 			case TOKEN_NEQUALS:
-				returnCode(new TempTree(new BinOpTree(BINOP_NEQUALS, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_NEQUALS, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))), compType));
 			case TOKEN_LT:
-				returnCode(new TempTree(new BinOpTree(BINOP_LT, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_LT, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))), compType));
 			case TOKEN_GT:
-				returnCode(new TempTree(new BinOpTree(BINOP_GT, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_GT, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))), compType));
 			case TOKEN_LE:
-				returnCode(new TempTree(new BinOpTree(BINOP_LE, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_LE, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))), compType));
 			case TOKEN_GE:
-				returnCode(new TempTree(new BinOpTree(BINOP_GE, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_GE, expLeft->castCommonCode(expRight->typeRef()), expRight->castCommonCode(expLeft->typeRef()))), compType));
 			case TOKEN_LS:
-				returnCode(new TempTree(new BinOpTree(BINOP_LS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_LS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 			case TOKEN_RS:
-				returnCode(new TempTree(new BinOpTree(BINOP_RS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+				returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_RS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 			case TOKEN_TIMES:
 				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
-					returnCode(new TempTree(new BinOpTree(BINOP_TIMES_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_TIMES_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
-					returnCode(new TempTree(new BinOpTree(BINOP_TIMES_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_TIMES_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType)))));
 				}
 			case TOKEN_DIVIDE:
 				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
-					returnCode(new TempTree(new BinOpTree(BINOP_DIVIDE_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_DIVIDE_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
-					returnCode(new TempTree(new BinOpTree(BINOP_DIVIDE_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_DIVIDE_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType)))));
 				}
 			case TOKEN_MOD:
 				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
-					returnCode(new TempTree(new BinOpTree(BINOP_MOD_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_MOD_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
-					returnCode(new TempTree(new BinOpTree(BINOP_MOD_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_MOD_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType)))));
 				}
 			case TOKEN_PLUS:
 				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
-					returnCode(new TempTree(new BinOpTree(BINOP_PLUS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_PLUS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 				} else if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) {
-					returnCode(new TempTree(new BinOpTree(BINOP_PLUS_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_PLUS_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType)))));
 				} else /* if ((*(expLeft->status) >> *stdStringType) && (*(expRight->status) >> *stdStringType)) */ {
-					returnCode(new TempTree(new BinOpTree(BINOP_PLUS_STRING, expLeft->castCode(*stdStringType), expRight->castCode(*stdStringType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_PLUS_STRING, expLeft->castCode(*stdStringType), expRight->castCode(*stdStringType)))));
 				}
 			case TOKEN_MINUS:
 				if ((*(expLeft->status) >> *stdIntType) && (*(expRight->status) >> *stdIntType)) {
-					returnCode(new TempTree(new BinOpTree(BINOP_MINUS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_MINUS_INT, expLeft->castCode(*stdIntType), expRight->castCode(*stdIntType)))));
 				} else /* if ((*(expLeft->status) >> *stdFloatType) && (*(expRight->status) >> *stdFloatType)) */ {
-					returnCode(new TempTree(new BinOpTree(BINOP_MINUS_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType))));
+					returnCode(foldData(irModule->addTemp(irModule->addBinOp(BINOP_MINUS_FLOAT, expLeft->castCode(*stdFloatType), expRight->castCode(*stdFloatType)))));
 				}
 			default: // can't happen; the above should cover all cases
 				break;
@@ -1317,6 +1544,19 @@ TypeStatus getStatusPrimLiteral(Tree *tree, const TypeStatus &inStatus) {
 		returnType(new StdType(STD_STRING, SUFFIX_LATCH));
 	}
 	GET_STATUS_CODE;
+	if (*plc == TOKEN_INUM) {
+		returnCode(irModule->addWord(strtoull(plc->t.s.c_str(), NULL, 0)));
+	} else if (*plc == TOKEN_FNUM) {
+		double value = strtod(plc->t.s.c_str(), NULL);
+		uint64_t word;
+		memcpy(&word, &value, sizeof(word));
+		returnCode(irModule->addWord(word));
+	} else if (*plc == TOKEN_CQUOTE) {
+		returnCode(irModule->addWord((unsigned char)(plc->t.s.length() > 0 ? plc->t.s[0] : '\0')));
+	} else if (*plc == TOKEN_SQUOTE) {
+		vector<uint8_t> data(plc->t.s.begin(), plc->t.s.end());
+		returnCode(irModule->addArray(data));
+	}
 	GET_STATUS_FOOTER;
 }
 
@@ -1386,7 +1626,7 @@ TypeStatus getStatusFilterHeader(Tree *tree, const TypeStatus &inStatus) {
 }
 
 // reports errors; assumes that the corresponding Filter thunk was generated successfully
-TypeStatus verifyStatusFilter(Tree *tree) {
+TypeStatus verifyStatusFilter(Tree *tree, const TypeStatus &inStatus) {
 	FilterType *headerType = (FilterType *)(tree->status.type);
 	if (*(headerType->from())) { // if the header from-type evaluates to a valid type
 		Tree *block;
@@ -1394,8 +1634,9 @@ TypeStatus verifyStatusFilter(Tree *tree) {
 		startStatus.retType = NULL; // make no initial presuppositions about what type the Block should return
 		if (*(tree->child) == TOKEN_Block) { // if this is an implicitly block-defined filter
 			block = tree->child; // Block
-			// set the type to feed into the block derivation to be the one coming in to this filter
+			// set the type to feed into the block derivation to be the one coming in to this filter, along with its code (so that recalls in the block can use it)
 			startStatus = headerType->from();
+			startStatus.code = inStatus.code;
 		} else /* if (*(tree->child->next) == TOKEN_Block) */ { // else if this is an explicitly header-defined filter
 			block = tree->child->next; // Block
 			// nullify the type to feed into the block derivation, since we have an explicit parameter list
@@ -2132,7 +2373,7 @@ TypeStatus getStatusNode(Tree *tree, const TypeStatus &inStatus) {
 		returnStatus(getStatusInstantiation(nodec, inStatus)); // erroneous recursion handled by Declaration derivation
 	} else if (*nodec == TOKEN_Filter) {
 		getStatusFilter(nodec, inStatus); // blindly generates a thunk; never fails
-		returnStatus(verifyStatusFilter(nodec)); // return the status resulting from verifying the contents of this filter
+		returnStatus(verifyStatusFilter(nodec, inStatus)); // return the status resulting from verifying the contents of this filter
 	} else if (*nodec == TOKEN_Object) {
 		getStatusObject(nodec, inStatus); // blindly generates a thunk; never fails
 		returnStatus(verifyStatusObject(nodec)); // return the status resulting from verifying the contents of this object
@@ -2142,6 +2383,7 @@ TypeStatus getStatusNode(Tree *tree, const TypeStatus &inStatus) {
 		returnStatus(getStatusPrimLiteral(nodec, inStatus)); // can't possibly be recursive
 	}
 	GET_STATUS_CODE;
+	returnCode(nodec->code());
 	GET_STATUS_FOOTER;
 }
 
@@ -2182,6 +2424,9 @@ TypeStatus getStatusTypedStaticTerm(Tree *tree, const TypeStatus &inStatus) {
 		}
 	}
 	GET_STATUS_CODE;
+	if (*tstc == TOKEN_Node || *tstc == TOKEN_BracketedExp) {
+		returnCode(tstc->code());
+	}
 	GET_STATUS_FOOTER;
 }
 
@@ -2239,6 +2484,9 @@ TypeStatus getStatusAccess(Tree *tree, const TypeStatus &inStatus) {
 		}
 	}
 	GET_STATUS_CODE;
+	if (*(tree->child->child) == TOKEN_DSLASH) { // if it's a destream, there's only code if the stream was lowered into a loop, in which case this reads its single raw-stored element
+		returnCode(tree->child->next->code());
+	}
 	GET_STATUS_FOOTER;
 }
 
@@ -2251,6 +2499,7 @@ TypeStatus getStatusStaticTerm(Tree *tree, const TypeStatus &inStatus) {
 		returnStatus(getStatusAccess(stc, inStatus));
 	}
 	GET_STATUS_CODE;
+	returnCode(stc->code());
 	GET_STATUS_FOOTER;
 }
 
@@ -2427,6 +2676,143 @@ TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_FOOTER;
 }
 
+// switch lowering functions
+
+typedef pair<IRId, IRId> SwitchCase; // a switch label's key and the code to run when the switch input matches it
+
+bool isWordNode(IRId id) {
+	return (id != NULL_IR_ID && irModule->categories[id] >= CATEGORY_WORD8 && irModule->categories[id] <= CATEGORY_WORD64);
+}
+
+int64_t wordNodeValue(IRId id) {
+	return (int64_t)(irModule->word(id));
+}
+
+bool switchCaseLess(const SwitchCase &left, const SwitchCase &right) {
+	return (wordNodeValue(left.first) < wordNodeValue(right.first));
+}
+
+// wraps the given code in a SEQ node suitable for use as a jump table entry
+IRId switchArmSeq(IRId code) {
+	vector<IRId> codeList;
+	if (code != nopCode) {
+		codeList.push_back(code);
+	}
+	return (irModule->addSeq(codeList));
+}
+
+// builds a chain of equality tests against cases [begin, end), in order
+IRId switchChain(IRId test, const vector<SwitchCase> &cases, unsigned int begin, unsigned int end, IRId defaultCode) {
+	IRId acc = defaultCode;
+	for (unsigned int i = end; i > begin; i--) {
+		acc = irModule->addCond(irModule->addTemp(irModule->addBinOp(BINOP_DEQUALS, test, cases[i-1].first)), cases[i-1].second, acc);
+	}
+	return acc;
+}
+
+// builds a binary decision tree over the sorted word-keyed cases [begin, end); small subranges fall back to equality chains
+IRId switchSearch(IRId test, const vector<SwitchCase> &cases, unsigned int begin, unsigned int end, IRId defaultCode) {
+	if (end - begin < MIN_SWITCH_DISPATCH_CASES) {
+		return switchChain(test, cases, begin, end, defaultCode);
+	}
+	unsigned int mid = begin + (end - begin)/2;
+	return (irModule->addCond(irModule->addTemp(irModule->addBinOp(BINOP_LT, test, cases[mid].first)),
+		switchSearch(test, cases, begin, mid, defaultCode), switchSearch(test, cases, mid, end, defaultCode)));
+}
+
+// builds a bounds check followed by a jump table indexed by the test's offset from the smallest of the sorted word-keyed cases
+IRId switchTable(IRId test, const vector<SwitchCase> &cases, IRId defaultCode) {
+	int64_t minKey = wordNodeValue(cases.front().first);
+	int64_t maxKey = wordNodeValue(cases.back().first);
+	vector<IRId> jumpTable((size_t)(maxKey - minKey + 1), NULL_IR_ID);
+	for (vector<SwitchCase>::const_iterator iter = cases.begin(); iter != cases.end(); iter++) {
+		jumpTable[(size_t)(wordNodeValue((*iter).first) - minKey)] = switchArmSeq((*iter).second);
+	}
+	for (vector<IRId>::iterator iter = jumpTable.begin(); iter != jumpTable.end(); iter++) { // every gap gets an entry of its own
+		if (*iter == NULL_IR_ID) {
+			*iter = switchArmSeq(defaultCode);
+		}
+	}
+	IRId index = (minKey == 0) ? test : foldData(irModule->addTemp(irModule->addBinOp(BINOP_MINUS_INT, test, irModule->addWord((uint64_t)minKey))));
+	IRId inRange = irModule->addTemp(irModule->addBinOp(BINOP_DAND_BOOL,
+		irModule->addTemp(irModule->addBinOp(BINOP_GE, test, cases.front().first)),
+		irModule->addTemp(irModule->addBinOp(BINOP_LE, test, cases.back().first))));
+	return (irModule->addCond(inRange, irModule->addJump(index, jumpTable), defaultCode));
+}
+
+// builds a jump table indexed by the low bits of the test's hash, with each bucket holding an equality chain of the array-keyed cases that hash into it
+IRId switchHash(IRId test, const vector<SwitchCase> &cases, IRId defaultCode) {
+	unsigned int numBuckets = 1;
+	while (numBuckets < cases.size()) {
+		numBuckets <<= 1;
+	}
+	vector<vector<SwitchCase> > buckets(numBuckets);
+	for (vector<SwitchCase>::const_iterator iter = cases.begin(); iter != cases.end(); iter++) {
+		buckets[hashBytes(irModule->array((*iter).first)) & (numBuckets - 1)].push_back(*iter);
+	}
+	vector<IRId> jumpTable;
+	for (unsigned int i = 0; i < numBuckets; i++) {
+		jumpTable.push_back(switchArmSeq(switchChain(test, buckets[i], 0, buckets[i].size(), defaultCode)));
+	}
+	IRId index = irModule->addTemp(irModule->addBinOp(BINOP_AND_INT, irModule->addTemp(irModule->addUnOp(UNOP_HASH_STRING, test)), irModule->addWord((uint64_t)(numBuckets - 1))));
+	return (irModule->addJump(index, jumpTable));
+}
+
+// lowers a switch on test into a dispatch over cases, choosing a jump table for dense word keys, a binary decision tree for sparse word keys,
+// hashed dispatch for many string keys, and a plain equality chain for few or non-constant keys; when keys repeat, the first one wins
+IRId switchCode(IRId test, const vector<SwitchCase> &cases, IRId defaultCode) {
+	bool wordKeys = true;
+	bool arrayKeys = true;
+	for (vector<SwitchCase>::const_iterator iter = cases.begin(); iter != cases.end(); iter++) {
+		if (!isWordNode((*iter).first)) {
+			wordKeys = false;
+		}
+		if ((*iter).first == NULL_IR_ID || irModule->categories[(*iter).first] != CATEGORY_ARRAY) {
+			arrayKeys = false;
+		}
+	}
+	if (cases.size() < MIN_SWITCH_DISPATCH_CASES || !(wordKeys || arrayKeys)) {
+		numSwitchChains++;
+		return switchChain(test, cases, 0, cases.size(), defaultCode);
+	}
+	vector<SwitchCase> uniqueCases;
+	if (wordKeys) {
+		vector<SwitchCase> sortedCases(cases);
+		stable_sort(sortedCases.begin(), sortedCases.end(), switchCaseLess);
+		for (vector<SwitchCase>::const_iterator iter = sortedCases.begin(); iter != sortedCases.end(); iter++) {
+			if (uniqueCases.empty() || switchCaseLess(uniqueCases.back(), *iter)) {
+				uniqueCases.push_back(*iter);
+			}
+		}
+		uint64_t span = (uint64_t)wordNodeValue(uniqueCases.back().first) - (uint64_t)wordNodeValue(uniqueCases.front().first);
+		if (span < MAX_JUMP_TABLE_SIZE && uniqueCases.size()*100 >= (span + 1)*MIN_JUMP_TABLE_DENSITY) {
+			numSwitchTables++;
+			return switchTable(test, uniqueCases, defaultCode);
+		}
+		numSwitchSearches++;
+		return switchSearch(test, uniqueCases, 0, uniqueCases.size(), defaultCode);
+	} else /* if (arrayKeys) */ {
+		for (vector<SwitchCase>::const_iterator iter = cases.begin(); iter != cases.end(); iter++) {
+			bool seen = false;
+			for (vector<SwitchCase>::const_iterator iter2 = uniqueCases.begin(); iter2 != uniqueCases.end(); iter2++) {
+				if (irModule->array((*iter2).first) == irModule->array((*iter).first)) {
+					seen = true;
+					break;
+				}
+			}
+			if (!seen) {
+				uniqueCases.push_back(*iter);
+			}
+		}
+		if (uniqueCases.size() >= MIN_HASH_DISPATCH_CASES) {
+			numSwitchHashes++;
+			return switchHash(test, uniqueCases, defaultCode);
+		}
+		numSwitchChains++;
+		return switchChain(test, uniqueCases, 0, uniqueCases.size(), defaultCode);
+	}
+}
+
 TypeStatus getStatusSwitchTerm(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
 	vector<TypeStatus> toStatus; // vector for logging the destination statuses of each branch
@@ -2472,6 +2858,37 @@ TypeStatus getStatusSwitchTerm(Tree *tree, const TypeStatus &inStatus) {
 		returnStatus(firstToStatus);
 	}
 	GET_STATUS_CODE;
+	// a switch whose destinations all have known values becomes a select: its arms write the chosen value into a raw slot of the switch's own,
+	// and the switch evaluates to a read of that slot; the dispatch itself is run by the enclosing pipe, ahead of the pipe's terms
+	bool knownCode = (inStatus.code != NULL_IR_ID);
+	for (Tree *ltCur = tree->child->next->next->child; ltCur != NULL; ltCur = (ltCur->next != NULL) ? ltCur->next->child : NULL) {
+		Tree *ltc = ltCur->child; // StaticTerm or COLON
+		Tree *toTree = (*ltc == TOKEN_TypedStaticTerm) ? ltc->next->next : ltc->next; // SimpleTerm
+		if (*ltc == TOKEN_TypedStaticTerm && ltc->code() == NULL_IR_ID) { // if the label has no code of its own, there's nothing to compare against
+			knownCode = false;
+		}
+		if (toTree->code() == NULL_IR_ID || irModule->categories[toTree->code()] >= CATEGORY_LOCK) { // if the destination has no value to store, there's nothing to select
+			knownCode = false;
+		}
+	}
+	// if all of the code is known and there's somewhere to run the dispatch and keep the value, lower the switch into a select
+	if (knownCode && pipePrelude != NULL && tree->status->offsetKind() == OFFSET_RAW) {
+		SymbolTree *resultSt = tree->env; // the slot that buildSt() reserved for this switch
+		vector<SwitchCase> cases;
+		IRId defaultCode = nopCode;
+		for (Tree *ltCur = tree->child->next->next->child; ltCur != NULL; ltCur = (ltCur->next != NULL) ? ltCur->next->child : NULL) {
+			Tree *ltc = ltCur->child; // StaticTerm or COLON
+			Tree *toTree = (*ltc == TOKEN_TypedStaticTerm) ? ltc->next->next : ltc->next; // SimpleTerm
+			IRId armCode = irModule->addWrite((toTree->code()), slotAddress(resultSt));
+			if (*ltc == TOKEN_TypedStaticTerm) {
+				cases.push_back(SwitchCase((ltc->code()), armCode));
+			} else {
+				defaultCode = armCode;
+			}
+		}
+		pipePrelude->push_back(switchCode((inStatus.code), cases, defaultCode));
+		returnCode(irModule->addRead(slotAddress(resultSt), (foldType(*(tree->status.type)) == VALUE_FLOAT) ? READ_FLOAT : READ_WORD));
+	}
 	GET_STATUS_FOOTER;
 }
 
@@ -2484,14 +2901,15 @@ TypeStatus getStatusSimpleTerm(Tree *tree, const TypeStatus &inStatus) {
 		returnStatus(getStatusSwitchTerm(stc, inStatus));
 	}
 	GET_STATUS_CODE;
+	returnCode(stc->code());
 	GET_STATUS_FOOTER;
 }
 
 // reports errors
-TypeStatus getStatusSimpleCondTerm(Tree *tree, const TypeStatus &inStatus) {
+TypeStatus getStatusSimpleCondTerm(Tree *tree, const TypeStatus &inStatus, const TypeStatus &recallStatus) {
 	GET_STATUS_HEADER;
 	if (*inStatus == STD_BOOL) { // if what's coming in is a boolean
-		returnStatus(getStatusTerm(tree->child->next, TypeStatus(nullType, NULL)));
+		returnStatus(getStatusTerm(tree->child->next, recallStatus));
 	} else { // else if what's coming in isn't a boolean
 		Token curToken = tree->child->t; // QUESTION
 		semmerError(curToken.fileIndex,curToken.row,curToken.col,"non-boolean input to conditional");
@@ -2502,20 +2920,20 @@ TypeStatus getStatusSimpleCondTerm(Tree *tree, const TypeStatus &inStatus) {
 }
 
 // reports errors
-TypeStatus getStatusOpenOrClosedCondTerm(Tree *tree, const TypeStatus &inStatus) {
+TypeStatus getStatusOpenOrClosedCondTerm(Tree *tree, const TypeStatus &inStatus, const TypeStatus &recallStatus) {
 	GET_STATUS_HEADER;
 	if (*inStatus == STD_BOOL) { // if what's coming in is a boolean
 		Tree *trueBranchc = tree->child->next->child; // SimpleTerm or ClosedCondTerm
 		Tree *falseBranchc = tree->child->next->next->next->child; // SimpleTerm, ClosedCondTerm, SimpleCondTerm, or ClosedCondTerm
 		TypeStatus trueStatus;
 		if (*trueBranchc == TOKEN_SimpleTerm) {
-			trueStatus = getStatusSimpleTerm(trueBranchc, TypeStatus(nullType, NULL));
+			trueStatus = getStatusSimpleTerm(trueBranchc, recallStatus);
 		} else /* if (*trueBranchc == TOKEN_ClosedCondTerm) */ {
 			trueStatus = getStatusOpenOrClosedCondTerm(trueBranchc, TypeStatus(nullType, NULL));
 		}
 		TypeStatus falseStatus;
 		if (*falseBranchc == TOKEN_SimpleTerm) {
-			falseStatus = getStatusSimpleTerm(falseBranchc, TypeStatus(nullType, NULL));
+			falseStatus = getStatusSimpleTerm(falseBranchc, recallStatus);
 		} else if (*falseBranchc == TOKEN_SimpleCondTerm) {
 			falseStatus = getStatusSimpleCondTerm(falseBranchc, TypeStatus(nullType, NULL));
 		} else /* if (*falseBranchc == TOKEN_ClosedCondTerm || *falseBranchc == TOKEN_OpenCondTerm) */ {
@@ -2542,7 +2960,7 @@ TypeStatus getStatusOpenOrClosedCondTerm(Tree *tree, const TypeStatus &inStatus)
 	GET_STATUS_FOOTER;
 }
 
-TypeStatus getStatusTerm(Tree *tree, const TypeStatus &inStatus) {
+TypeStatus getStatusTerm(Tree *tree, const TypeStatus &inStatus, const TypeStatus &recallStatus) {
 	GET_STATUS_HEADER;
 	Tree *tc = tree->child;
 	if (*tc != TOKEN_DynamicTerm) { // if it's not a DynamicTerm
@@ -2550,27 +2968,262 @@ TypeStatus getStatusTerm(Tree *tree, const TypeStatus &inStatus) {
 		if (*tcc == TOKEN_SimpleTerm) {
 			returnStatus(getStatusSimpleTerm(tcc, inStatus));
 		} else if (*tcc == TOKEN_SimpleCondTerm) {
-			returnStatus(getStatusSimpleCondTerm(tcc, inStatus));
+			returnStatus(getStatusSimpleCondTerm(tcc, inStatus, recallStatus));
 		} else if (*tcc == TOKEN_ClosedCondTerm || *tcc == TOKEN_OpenCondTerm) {
-			returnStatus(getStatusOpenOrClosedCondTerm(tcc, inStatus));
+			returnStatus(getStatusOpenOrClosedCondTerm(tcc, inStatus, recallStatus));
 		}
 	} else { // else if it's a DynamicTerm
 		returnStatus(getStatusDynamicTerm(tc, inStatus));
 	}
 	GET_STATUS_CODE;
+	if (*tc != TOKEN_DynamicTerm && *(tc->child) == TOKEN_SimpleTerm) {
+		returnCode(tc->child->code());
+	}
 	GET_STATUS_FOOTER;
 }
 
+// filter inlining functions
+
+// a filter whose body just returns an expression of its one parameter, as in
+//	addFive = [int x --> int] { (x + 5) --> };
+// needs no call where a value flows into it, since the flow's value is that expression with the incoming value in place of the parameter;
+// with a constant incoming value, folding the copy specializes the application down to a constant; likewise, a filter that a range or batch
+// applies by name has its body copied into the range or batch, so that every element runs it as straight-line code
+// only bodies within the size budget of the current optimization level (in IR nodes) are copied, and -p 0 copies none
+
+// returns the StaticTerm of the given Term if it's a plain static term, and NULL otherwise
+Tree *staticTermOf(Tree *term) {
+	if (term == NULL || *(term->child) != TOKEN_ClosedTerm || *(term->child->child) != TOKEN_SimpleTerm || *(term->child->child->child) != TOKEN_StaticTerm) {
+		return NULL;
+	}
+	return term->child->child->child;
+}
+
+// returns the Node of the given Term if it's a plain Node term, and NULL otherwise
+Tree *nodeTermOf(Tree *term) {
+	Tree *staticTerm = staticTermOf(term);
+	if (staticTerm == NULL || *(staticTerm->child) != TOKEN_TypedStaticTerm || *(staticTerm->child->child) != TOKEN_Node) {
+		return NULL;
+	}
+	return staticTerm->child->child;
+}
+
+// collects the Terms of the given pipe, returning false if it's not a NonEmptyTerms pipe
+bool pipeTermList(Tree *pipe, vector<Tree *> &terms) {
+	if (*(pipe->child) != TOKEN_NonEmptyTerms) {
+		return false;
+	}
+	for (Tree *term = pipe->child->child; term != NULL; term = term->next->child) {
+		terms.push_back(term);
+	}
+	return true;
+}
+
+// returns the size budget of inlined filter bodies at the current optimization level
+unsigned int inlineBudget() {
+	if (optimizationLevel >= OPTIMIZATION_LEVEL_FIXPOINT) {
+		return INLINE_BUDGET_FIXPOINT;
+	} else if (optimizationLevel >= OPTIMIZATION_LEVEL_REDUCE) {
+		return INLINE_BUDGET_REDUCE;
+	} else if (optimizationLevel >= OPTIMIZATION_LEVEL_FOLD) {
+		return INLINE_BUDGET_FOLD;
+	} else {
+		return 0;
+	}
+}
+
+// returns the number of distinct nodes in the given intermediate code
+unsigned int irSize(IRId id) {
+	return irModule->reachableSize(id);
+}
+
+// returns a deep copy of the given intermediate code; nodes that are already in cloned are replaced by their logged copies instead (which is how parameter reads
+// are substituted), shared nodes stay shared in the copy, and every copied operation is folded in case substitution made its operands constant
+IRId cloneIR(IRId id, map<IRId, IRId> &cloned) {
+	if (id == NULL_IR_ID || id == nopCode) {
+		return id;
+	}
+	map<IRId, IRId>::const_iterator clonedFind = cloned.find(id);
+	if (clonedFind != cloned.end()) {
+		return (*clonedFind).second;
+	}
+	vector<IRId> operandList;
+	for (unsigned int i = 0; i < irModule->operandCounts[id]; i++) {
+		operandList.push_back(cloneIR(irModule->operand(id, i), cloned));
+	}
+	int category = irModule->categories[id];
+	IRId acc;
+	switch (category) {
+		case CATEGORY_LABEL:
+			acc = irModule->addLabel(getUniqueId(), operandList[0]);
+			break;
+		case CATEGORY_WORD8:
+		case CATEGORY_WORD16:
+		case CATEGORY_WORD32:
+			acc = irModule->addWord(category, irModule->word(id));
+			break;
+		case CATEGORY_WORD64: {
+			acc = irModule->addWord(category, irModule->word(id));
+			map<IRId, SymbolTree *>::const_iterator pendingFind = pendingSlots.find(id);
+			if (pendingFind != pendingSlots.end()) { // if it's a slot address that's still waiting on layout, the copy waits along with it
+				pendingSlots.insert(make_pair(acc, (*pendingFind).second));
+			}
+			break;
+		}
+		case CATEGORY_TEMP:
+			acc = foldData(irModule->addTemp(operandList[0]));
+			break;
+		default: // every other node carries nothing but its kind, its operands, and its immutable side table entry
+			acc = irModule->addNode(category, irModule->kinds[id], operandList, irModule->auxes[id]);
+			break;
+	}
+	cloned.insert(make_pair(id, acc));
+	return acc;
+}
+
+// returns the filter that the given Node applies: the Node itself if it's a filter literal, or the filter literal that the declaration it names is bound to;
+// returns NULL if it's neither
+Tree *filterNodeOf(Tree *node) {
+	if (node == NULL) {
+		return NULL;
+	} else if (*(node->child) == TOKEN_Filter) {
+		return node;
+	} else if (*(node->child) != TOKEN_NonArrayedIdentifier) {
+		return NULL;
+	}
+	SymbolTree *st = bindId(*(node->child), node->child->env).first;
+	if (st == NULL || st->kind != KIND_DECLARATION) {
+		return NULL;
+	}
+	Tree *declarationSub = st->defSite->child->next->next; // TypedStaticTerm, BlankInstantiation, or ImportIdentifier
+	if (declarationSub == NULL || *declarationSub != TOKEN_TypedStaticTerm || *(declarationSub->child) != TOKEN_Node || *(declarationSub->child->child) != TOKEN_Filter) {
+		return NULL;
+	}
+	return declarationSub->child;
+}
+
+// returns the node of the given filter Node's parameter if it has a header that declares exactly one, and NULL otherwise
+SymbolTree *singleParam(Tree *filterNode) {
+	if (*(filterNode->child->child) != TOKEN_FilterHeader) {
+		return NULL;
+	}
+	Tree *pl = filterNode->child->child->child->next; // ParamList or RetList
+	if (*pl != TOKEN_ParamList || pl->child->next != NULL) {
+		return NULL;
+	}
+	SymbolTree *filterSt = filterNode->child->env;
+	map<string, SymbolTree *>::const_iterator paramFind = filterSt->children.find(pl->child->child->next->t.s); // Param's ID
+	if (paramFind == filterSt->children.end()) {
+		return NULL;
+	}
+	return (*paramFind).second;
+}
+
+// logs every read of param in the given tree (and its right siblings) into cloned, as a read to be replaced by arg;
+// returns false if the tree names any other node (except for boolean literals), accesses, or defines a node of its own
+bool mapParamReads(Tree *tree, SymbolTree *param, IRId arg, map<IRId, IRId> &cloned) {
+	for (Tree *cur = tree; cur != NULL; cur = cur->next) {
+		if (*cur == TOKEN_NonArrayedIdentifier) {
+			if (cur->status.type == stdBoolLitType) {
+				continue;
+			}
+			if (cur->status.code == NULL_IR_ID || irModule->categories[cur->status.code] != CATEGORY_READ || bindId(*cur, cur->env).first != param) {
+				return false;
+			}
+			cloned[cur->status.code] = arg;
+		} else if (*cur == TOKEN_ArrayedIdentifier || *cur == TOKEN_SingleAccessor || *cur == TOKEN_MultiAccessor ||
+				*cur == TOKEN_Instantiation || *cur == TOKEN_Filter || *cur == TOKEN_Object) {
+			return false;
+		} else if (!mapParamReads(cur->child, param, arg, cloned)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// returns the code of the flow of a value with the given status into the given filter Term, with the filter's body inlined rather than called;
+// returns NULL_IR_ID if the filter's body isn't a single return of an expression of its one raw-stored parameter, or is over budget
+IRId inlineFilterFlow(Tree *term, const TypeStatus &argStatus, Type *flowType) {
+	unsigned int budget = inlineBudget();
+	Tree *filterNode = filterNodeOf(nodeTermOf(term));
+	if (budget == 0 || filterNode == NULL || argStatus.code == NULL_IR_ID || argStatus.type->category != CATEGORY_STDTYPE || flowType->category != CATEGORY_STDTYPE) {
+		return NULL_IR_ID;
+	}
+	int argCategory = irModule->categories[argStatus.code];
+	if (!((argCategory >= CATEGORY_WORD8 && argCategory <= CATEGORY_READ) || argCategory == CATEGORY_SLICE)) {
+		return NULL_IR_ID;
+	}
+	// the filter must take exactly one raw-stored standard parameter
+	SymbolTree *param = singleParam(filterNode);
+	if (param == NULL || param->kind != KIND_PARAMETER) {
+		return NULL_IR_ID;
+	}
+	Type *paramType = param->defSite->status.type;
+	if (paramType == NULL || paramType->category != CATEGORY_STDTYPE || param->offsetKind() != OFFSET_RAW) {
+		return NULL_IR_ID;
+	}
+	// the filter's body must be a single pipe that returns a standard value
+	Tree *bodyPipe = filterNode->child->child->next->child->next->child; // Pipe or LastPipe
+	vector<Tree *> terms;
+	if (bodyPipe == NULL || bodyPipe->next != NULL || !pipeTermList(bodyPipe, terms) || terms.size() != 2 || staticTermOf(terms[0]) == NULL ||
+			*(terms[1]->child) != TOKEN_DynamicTerm || *(terms[1]->child->child) != TOKEN_Return) {
+		return NULL_IR_ID;
+	}
+	Tree *valueTerm = terms[0];
+	if (valueTerm->code() == NULL_IR_ID || valueTerm->status.type == NULL || valueTerm->status.type->category != CATEGORY_STDTYPE) {
+		return NULL_IR_ID;
+	}
+	IRId value = valueTerm->castCode(*flowType);
+	if (irSize(value) > budget) {
+		return NULL_IR_ID;
+	}
+	// substitute the incoming value for every read of the parameter
+	IRId arg = argStatus.castCode(*paramType);
+	map<IRId, IRId> cloned;
+	if (!mapParamReads(valueTerm->child, param, arg, cloned)) {
+		return NULL_IR_ID;
+	}
+	IRId acc = cloneIR(value, cloned);
+	numInlinedFlows++;
+	if (irModule->categories[acc] >= CATEGORY_WORD8 && irModule->categories[acc] <= CATEGORY_ARRAY) { // if the body folded down to a constant
+		numSpecializedFlows++;
+	}
+	return acc;
+}
+
+// returns whether the given tree (or one of its right siblings) contains a recall identifier
+bool containsRecall(Tree *tree) {
+	for (Tree *cur = tree; cur != NULL; cur = cur->next) {
+		if (*cur == TOKEN_DPERIOD || containsRecall(cur->child)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// returns whether the given Term is a bare recall of the incoming value
+bool isRecallTerm(Tree *term) {
+	Tree *node = nodeTermOf(term);
+	if (node == NULL || *(node->child) != TOKEN_NonArrayedIdentifier) {
+		return false;
+	}
+	vector<string> id = chopId(*(node->child));
+	return (id.size() == 1 && id[0] == "..");
+}
+
 // reports errors
 TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
 	// scan the pipe left to right
 	TypeStatus curStatus = inStatus;
+	TypeStatus recallStatus(nullType, NULL); // what flows into the branches of a conditional term; the compared value, if the condition is a comparison
 	Tree *curTerm;
 	Tree *prevTerm;
 	for (curTerm = prevTerm = tree->child; curTerm != NULL; prevTerm = curTerm, curTerm = curTerm->next->child) {
 		// derive a type for the next term in the sequence
-		TypeStatus nextTermStatus = getStatusTerm(curTerm, curStatus);
+		TypeStatus nextTermStatus = getStatusTerm(curTerm, curStatus, recallStatus);
+		recallStatus = nullType;
+		recallStatus.code = NULL_IR_ID;
 		if (*nextTermStatus) { // if we managed to derive a type for this term
 			if (*(curTerm->child->child) == TOKEN_SimpleTerm &&
 					*(curTerm->child->child->child) == TOKEN_StaticTerm &&
@@ -2581,6 +3234,12 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 					stdFlowResult = ((StdType *)(nextTermStatus.type))->stdFlowDerivation(curStatus, curTerm->next->child);
 				}
 				if (*(stdFlowResult.first)) { // if we managed to derive a three-term exceptional type for this term
+					Tree *nextCondTerm = curTerm->next->child->next->child; // the Term following the comparison's third term, if any
+					if (stdFlowResult.second && *(stdFlowResult.first) == STD_BOOL && nextCondTerm != NULL && containsRecall(nextCondTerm)) { // if it's a comparison, the compared value is what a following conditional recalls
+						recallStatus = curStatus;
+						recallStatus.retType = NULL;
+						recallStatus.code = curStatus.code;
+					}
 					curStatus = TypeStatus(stdFlowResult.first, nextTermStatus); // log the three-term exceptional type as the current status
 					if (stdFlowResult.second) { // if we used a third term for the derivation, advance curTerm past it
 						curTerm = curTerm->next->child;
@@ -2602,9 +3261,12 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 						curStatus = errType;
 						break;
 					} else if (*flowResult) { // else if the type flow is valid, log it as the current status
+						IRId inlinedCode = inlineFilterFlow(curTerm, curStatus, flowResult);
 						curStatus = TypeStatus(flowResult, nextTermStatus);
-					} else if (*curStatus == *nullType) { // else if the flow is not valid, but the incoming type is null, treat it as a value injection
+						curStatus.code = inlinedCode; // if the term is a small filter, the flow's value is its inlined body
+					} else if (*curStatus == *nullType || (curTerm == tree->child && isRecallTerm(curTerm))) { // else if the flow is not valid, but the incoming type is null (or the pipe recalls it), treat it as a value injection
 						curStatus = nextTermStatus;
+						curStatus.code = nextTermStatus.code; // the injected value is the input of the next term
 					} else { // else if the type flow is not valid and the incoming type is not null, flag an error
 						Token curToken = curTerm->t; // Term
 						Token prevToken = prevTerm->t; // Term
@@ -2618,6 +3280,7 @@ TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus) {
 				}
 			} else { // else if it's not a flow-through Term, log the next term's status as the current one
 				curStatus = nextTermStatus;
+				curStatus.code = nextTermStatus.code;
 			}
 		} else { // otherwise, if we failed to derive a type for this term, flag an error
 			Token curToken = curTerm->t;
@@ -2698,50 +3361,557 @@ TypeStatus getStatusDeclaration(Tree *tree) {
 		}
 	}
 	GET_STATUS_CODE;
+	Tree *declarationSub = tree->child->next->next; // TypedStaticTerm, NonEmptyTerms, or NULL
+	if (declarationSub != NULL && *declarationSub == TOKEN_TypedStaticTerm) { // if it's a standard declaration, its code is that of its initializer
+		returnCode(declarationSub->code());
+	}
 	GET_STATUS_FOOTER;
 }
 
 TypeStatus getStatusPipe(Tree *tree, const TypeStatus &inStatus) {
 	GET_STATUS_HEADER;
 	Tree *pipec = tree->child; // Declaration or NonEmptyTerms
+	// collect the dispatch code of this pipe's value switches, which runs before anything else in the pipe
+	vector<IRId> prelude;
+	vector<IRId> *outerPrelude = pipePrelude;
+	pipePrelude = &prelude;
+	TypeStatus pipeStatus;
 	if (*pipec == TOKEN_Declaration) { // if it's a Declaration-style pipe
-		returnStatus(getStatusDeclaration(pipec));
-	} else if (*pipec == TOKEN_NonEmptyTerms) { // else if it's a raw NonEmptyTerms pipe
-		returnStatus(getStatusNonEmptyTerms(pipec, inStatus));
+		pipeStatus = getStatusDeclaration(pipec);
+	} else /* if (*pipec == TOKEN_NonEmptyTerms) */ { // else if it's a raw NonEmptyTerms pipe
+		pipeStatus = getStatusNonEmptyTerms(pipec, inStatus);
 	}
+	pipePrelude = outerPrelude;
+	returnStatus(pipeStatus);
 	GET_STATUS_CODE;
-	vector<CodeTree *> seqList;
+	vector<IRId> seqList(prelude);
+	if (*pipec == TOKEN_Declaration) { // if it's a Declaration-style pipe, initialize the declared node's storage
+		SymbolTree *st = pipec->env; // the Declaration's own SymbolTree node
+		IRId initCode = pipec->code();
+		if (initCode != NULL_IR_ID && initCode != nopCode && st->kind == KIND_DECLARATION && st->offsetKind() == OFFSET_RAW) {
+			seqList.push_back(irModule->addWrite(initCode, slotAddress(st)));
+		}
+	}
 	
-	// LOL need to actually fill seqList with the CodeTree nodes to execute in this pipe
+	// LOL need to actually fill seqList with the code nodes to execute in NonEmptyTerms pipes
 	
-	returnCode(new SeqTree(seqList));
+	returnCode(irModule->addSeq(seqList));
 	GET_STATUS_FOOTER;
 }
 
-void semPipes(Tree *treeRoot) {
+// loop conversion functions
+
+// a stream that's seeded once and then only fed by the conditional block that destreams it, as in
+//	n = [int\\];
+//	0 ->n;
+//	\\n < 10 ? { ... (.. + 1) ->n; };
+// holds at most one element at any time, so rather than scheduling the block once per element, its storage becomes a raw slot holding the loop variable
+// and the consuming pipe becomes a LOOP node that re-runs the block in place for as long as the comparison holds
+
+// returns the node that the given Node binds to if it's a plain single-component identifier, and NULL otherwise
+SymbolTree *nodeBinding(Tree *node) {
+	if (node == NULL || *(node->child) != TOKEN_NonArrayedIdentifier || *(node->child->child) != TOKEN_ID) {
+		return NULL;
+	}
+	string id = *(node->child);
+	if (chopId(id).size() != 1) {
+		return NULL;
+	}
+	return bindId(id, node->child->env).first;
+}
+
+// returns the value Term of the given pipe if it's a plain two-term send of a static term to st, and NULL otherwise
+Tree *sendValueTerm(Tree *pipe, SymbolTree *st) {
+	vector<Tree *> terms;
+	if (!pipeTermList(pipe, terms) || terms.size() != 2 || staticTermOf(terms[0]) == NULL) {
+		return NULL;
+	}
+	Tree *dtc = terms[1]->child; // DynamicTerm
+	if (*dtc != TOKEN_DynamicTerm || *(dtc->child) != TOKEN_Send || nodeBinding(dtc->child->child->next) != st) {
+		return NULL;
+	}
+	return terms[0];
+}
+
+// counts the identifiers in the given tree (and its right siblings) that bind to st
+unsigned int countBindings(Tree *tree, SymbolTree *st) {
+	unsigned int acc = 0;
+	for (Tree *cur = tree; cur != NULL; cur = cur->next) {
+		if (*cur == TOKEN_NonArrayedIdentifier || *cur == TOKEN_ArrayedIdentifier) {
+			vector<string> id = chopId(*cur);
+			if (id[0] == st->id && bindId(id[0], cur->env).first == st) {
+				acc++;
+			}
+		} else {
+			acc += countBindings(cur->child, st);
+		}
+	}
+	return acc;
+}
+
+// checks whether the given top-level pipe consumes a self-feeding stream that can be lowered into a loop, logging the pieces of the loop in ls if it can
+bool findLoopStream(Tree *pipe, Tree *pipesHead, Tree *treeRoot, LoopStream &ls) {
+	// the pipe must be a destream of a stream, a comparison, a bound, and a conditional block
+	vector<Tree *> terms;
+	if (!pipeTermList(pipe, terms) || terms.size() != 4) {
+		return false;
+	}
+	Tree *elementTerm = staticTermOf(terms[0]);
+	if (elementTerm == NULL || *(elementTerm->child) != TOKEN_MultiAccess || *(elementTerm->child->child->child) != TOKEN_DSLASH) {
+		return false;
+	}
+	SymbolTree *st = nodeBinding(elementTerm->child->child->next); // Node
+	if (st == NULL || st->kind != KIND_DECLARATION || st->defSite->child->next->next == NULL || *(st->defSite->child->next->next) != TOKEN_BlankInstantiation) {
+		return false;
+	}
+	Type *stType = st->defSite->status.type;
+	if (stType == NULL || stType->category != CATEGORY_STDTYPE || stType->suffix != SUFFIX_STREAM || stType->depth != 1 ||
+			!(((StdType *)stType)->isComparable()) || *((StdType *)stType) == STD_STRING) {
+		return false;
+	}
+	Tree *opNode = nodeTermOf(terms[1]);
+	if (opNode == NULL || *(opNode->child) != TOKEN_PrimOpNode || *(opNode->child->child) != TOKEN_InfixOp) {
+		return false;
+	}
+	Tree *op = opNode->child->child->child;
+	if (!(*op == TOKEN_DEQUALS || *op == TOKEN_NEQUALS || *op == TOKEN_LT || *op == TOKEN_GT || *op == TOKEN_LE || *op == TOKEN_GE)) {
+		return false;
+	}
+	Tree *boundNode = nodeTermOf(terms[2]);
+	if (boundNode == NULL) {
+		return false;
+	}
+	if (*(boundNode->child) != TOKEN_PrimLiteral) { // if the bound isn't a literal, it must be a raw-stored node, so that it can be re-read on every iteration
+		SymbolTree *boundSt = nodeBinding(boundNode);
+		if (boundSt == NULL || boundSt == st || boundSt->kind != KIND_DECLARATION || boundSt->offsetKind() != OFFSET_RAW) {
+			return false;
+		}
+	}
+	Tree *condTerm = terms[3]->child->child; // SimpleCondTerm, if it's a simple conditional
+	if (*(terms[3]->child) != TOKEN_OpenTerm || *condTerm != TOKEN_SimpleCondTerm) {
+		return false;
+	}
+	Tree *filterNode = nodeTermOf(condTerm->child->next); // Node
+	if (filterNode == NULL || *(filterNode->child) != TOKEN_Filter || *(filterNode->child->child) != TOKEN_Block) {
+		return false;
+	}
+	Tree *block = filterNode->child->child;
+	// the block must feed the stream exactly once, from one of its own pipes
+	Tree *producer = NULL;
+	for (Tree *blockPipe = block->child->next->child; blockPipe != NULL; blockPipe = (blockPipe->next != NULL) ? blockPipe->next->child : NULL) {
+		if (sendValueTerm(blockPipe, st) != NULL) {
+			if (producer != NULL) {
+				return false;
+			}
+			producer = blockPipe;
+		}
+	}
+	if (producer == NULL) {
+		return false;
+	}
+	// a pipe alongside this one must seed the stream exactly once
+	Tree *seed = NULL;
+	for (Tree *pipeCur = pipesHead; pipeCur != NULL; pipeCur = (pipeCur->next != NULL) ? pipeCur->next->child : NULL) {
+		Tree *seedValue = sendValueTerm(pipeCur, st);
+		if (seedValue != NULL) {
+			if (seed != NULL) {
+				return false;
+			}
+			seed = seedValue;
+		}
+	}
+	if (seed == NULL) {
+		return false;
+	}
+	// finally, the stream must be used nowhere else: once each by the seed, the destream, and the producer
+	if (countBindings(treeRoot, st) != 3) {
+		return false;
+	}
+	ls.st = st;
+	ls.pipe = pipe;
+	ls.seed = seed;
+	ls.element = terms[0];
+	ls.op = op;
+	ls.bound = terms[2];
+	ls.block = block;
+	ls.producer = producer;
+	return true;
+}
+
+// replaces the (typed) consuming pipe's code with the loop; leaves it as it is if any of the loop's pieces failed to generate code
+bool genLoopStream(const LoopStream &ls) {
+	Tree *producerValue = sendValueTerm(ls.producer, ls.st);
+	if (ls.pipe->status.code == NULL_IR_ID || ls.element->code() == NULL_IR_ID || ls.bound->code() == NULL_IR_ID || ls.seed->code() == NULL_IR_ID || producerValue->code() == NULL_IR_ID) {
+		return false;
+	}
+	unsigned int slot = ls.st->offsetByte();
+	// build the loop condition
+	int binop;
+	switch (ls.op->t.tokenType) {
+		case TOKEN_DEQUALS:
+			binop = BINOP_DEQUALS;
+			break;
+		case TOKEN_NEQUALS:
+			binop = BINOP_NEQUALS;
+			break;
+		case TOKEN_LT:
+			binop = BINOP_LT;
+			break;
+		case TOKEN_GT:
+			binop = BINOP_GT;
+			break;
+		case TOKEN_LE:
+			binop = BINOP_LE;
+			break;
+		default: // TOKEN_GE
+			binop = BINOP_GE;
+			break;
+	}
+	int compType = (foldType(ls.element->typeRef()) == foldType(ls.bound->typeRef())) ? foldType(ls.element->typeRef()) : VALUE_UNKNOWN; // the constant folding type of comparison operands
+	IRId test = foldData(irModule->addTemp(irModule->addBinOp(binop, ls.element->castCommonCode(ls.bound->typeRef()), ls.bound->castCommonCode(ls.element->typeRef()))), compType);
+	// build the loop body out of the block's pipes, with the producer's send becoming the update of the loop variable
+	vector<IRId> bodyList;
+	for (Tree *blockPipe = ls.block->child->next->child; blockPipe != NULL; blockPipe = (blockPipe->next != NULL) ? blockPipe->next->child : NULL) {
+		if (blockPipe != ls.producer && blockPipe->status.code != NULL_IR_ID) {
+			for (unsigned int i = 0; i < irModule->operandCounts[blockPipe->status.code]; i++) {
+				bodyList.push_back(irModule->operand(blockPipe->status.code, i));
+			}
+		}
+	}
+	bodyList.push_back(irModule->addWrite(producerValue->castCode(ls.element->typeRef()), irModule->addWord(slot)));
+	// the loop starts by writing the seed into the loop variable
+	vector<IRId> seqList;
+	seqList.push_back(irModule->addWrite(ls.seed->castCode(ls.element->typeRef()), irModule->addWord(slot)));
+	seqList.push_back(irModule->addLoop(test, irModule->addSeq(bodyList)));
+	// overwrite the pipe's code in place, so that the block that it belongs to picks up the loop
+	irModule->setOperands(ls.pipe->status.code, seqList);
+	return true;
+}
+
+// range conversion functions
+
+// a pipe that unpacks a std.gen stream into a block with a single int parameter, as in
+//	1000000 std.gen <| [int i] { ... };
+// runs the block once per index, so rather than streaming the indices through std.gen, the pipe becomes a RANGE node that counts through them in place
+// and writes each one straight into the parameter's raw slot; if no iteration can observe another, the range is marked as parallel,
+// and the runtime may then split it into chunks that run on separate workers (keeping their output in index order)
+
+// returns whether st is scope or one of its descendants
+bool isWithinScope(SymbolTree *st, SymbolTree *scope) {
+	for (SymbolTree *cur = st; cur != NULL; cur = cur->parent) {
+		if (cur == scope) {
+			return true;
+		}
+	}
+	return false;
+}
+
+// returns the filter or object literal that the given declaration node is bound to, or NULL if it isn't bound to one
+Tree *definitionNodeOf(SymbolTree *st) {
+	if (st->kind != KIND_DECLARATION) {
+		return NULL;
+	}
+	Tree *declarationSub = st->defSite->child->next->next; // TypedStaticTerm, BlankInstantiation, or ImportIdentifier
+	if (declarationSub == NULL || *declarationSub != TOKEN_TypedStaticTerm || *(declarationSub->child) != TOKEN_Node ||
+			!(*(declarationSub->child->child) == TOKEN_Filter || *(declarationSub->child->child) == TOKEN_Object)) {
+		return NULL;
+	}
+	return declarationSub->child->child;
+}
+
+// returns the ACCESS_ flags of the code in the given tree (and its right siblings), which tell whether it can run concurrently with other runs of itself:
+// sending to or swapping with std.out or std.err only writes output, whose order the runtime can restore, but sending to or swapping with any other node outside of scope
+// writes latches, as do destreaming a stream outside of scope and using any other standard node, since the order of std.in* reads, std.randInt draws, and std.delay sends
+// is part of the program's behaviour; merely naming a latch or stream outside of scope reads latches, while naming a filter or object outside of scope
+// has the access of its definition (logged in followed, so that recursive definitions are only followed once), or writes latches if it has none to follow;
+// the pipes must have been typed
+int getCodeAccess(Tree *tree, SymbolTree *scope, map<SymbolTree *, bool> &followed) {
+	int acc = 0;
+	for (Tree *cur = tree; cur != NULL; cur = cur->next) {
+		if (*cur == TOKEN_NonArrayedIdentifier || *cur == TOKEN_ArrayedIdentifier) {
+			SymbolTree *st = bindId(*cur, cur->env).first;
+			if (st != NULL && st->kind == KIND_STD && st->parent == stdLib) {
+				if (st->defSite->status.type != stringerType) {
+					acc |= ACCESS_WRITES_LATCHES;
+				}
+			} else if (st != NULL && !isWithinScope(st, scope)) {
+				Type *stType = st->defSite->status.type;
+				Tree *definition = definitionNodeOf(st);
+				if (definition != NULL) {
+					if (followed.find(st) == followed.end()) {
+						followed.insert(make_pair(st, true));
+						acc |= getCodeAccess(definition->child, st, followed);
+					}
+				} else if (stType == NULL || stType->category == CATEGORY_FILTERTYPE || stType->category == CATEGORY_OBJECTTYPE) {
+					acc |= ACCESS_WRITES_LATCHES;
+				} else if (stType->suffix == SUFFIX_LATCH || stType->suffix == SUFFIX_STREAM) {
+					acc |= ACCESS_READS_LATCHES;
+				}
+			}
+		} else if (*cur == TOKEN_Send || *cur == TOKEN_Swap) {
+			Tree *destination = cur->child->next->child; // NonArrayedIdentifier, ArrayedIdentifier, Instantiation, Filter, Object, or PrimOpNode
+			if (*destination == TOKEN_NonArrayedIdentifier || *destination == TOKEN_ArrayedIdentifier) {
+				SymbolTree *st = bindId(*destination, destination->env).first;
+				if (st != NULL && st->defSite->status.type == stringerType) {
+					acc |= ACCESS_WRITES_OUTPUT;
+				} else if (st == NULL || !isWithinScope(st, scope)) {
+					acc |= ACCESS_WRITES_LATCHES;
+				}
+			}
+		} else if (*cur == TOKEN_MultiAccess && *(cur->child->child) == TOKEN_DSLASH) {
+			SymbolTree *st = nodeBinding(cur->child->next); // Node
+			if (st == NULL || !isWithinScope(st, scope)) {
+				acc |= ACCESS_WRITES_LATCHES;
+			}
+		}
+		acc |= getCodeAccess(cur->child, scope, followed);
+	}
+	return acc;
+}
+int getCodeAccess(Tree *tree, SymbolTree *scope) {
+	map<SymbolTree *, bool> followed;
+	return getCodeAccess(tree, scope, followed);
+}
+
+// returns the Block of the given Term if it's a filter (or names one) that takes exactly one parameter and returns nothing,
+// logging the parameter's node in param and whether the filter was named in named
+Tree *singleParamBlock(Tree *term, SymbolTree *&param, bool &named) {
+	Tree *termNode = nodeTermOf(term);
+	Tree *filterNode = filterNodeOf(termNode);
+	if (filterNode == NULL || (param = singleParam(filterNode)) == NULL || *(filterNode->child->child->child->next->next) != TOKEN_RSQUARE) { // ParamList's successor
+		return NULL;
+	}
+	named = (filterNode != termNode);
+	return filterNode->child->child->next;
+}
+
+// builds the body of a range or batch out of the (typed) pipes of the given Block; a named filter's Block is copied in rather than shared with the filter,
+// in which case NULL_IR_ID is returned if the copy would be over budget
+IRId genBlockBody(Tree *block, bool named) {
+	vector<IRId> bodyList;
+	for (Tree *blockPipe = block->child->next->child; blockPipe != NULL; blockPipe = (blockPipe->next != NULL) ? blockPipe->next->child : NULL) {
+		if (blockPipe->status.code != NULL_IR_ID) {
+			for (unsigned int i = 0; i < irModule->operandCounts[blockPipe->status.code]; i++) {
+				bodyList.push_back(irModule->operand(blockPipe->status.code, i));
+			}
+		}
+	}
+	IRId acc = irModule->addSeq(bodyList);
+	if (named) {
+		if (irSize(acc) > inlineBudget()) {
+			return NULL_IR_ID;
+		}
+		map<IRId, IRId> cloned;
+		acc = cloneIR(acc, cloned);
+	}
+	return acc;
+}
+
+// checks whether the given top-level pipe maps a block over a std.gen range, logging the pieces of the range in gr if it does
+bool findGenRange(Tree *pipe, GenRange &gr) {
+	// the pipe must be a count, std.gen, an unpack, and a filter
+	vector<Tree *> terms;
+	if (!pipeTermList(pipe, terms) || terms.size() != 4 || staticTermOf(terms[0]) == NULL) {
+		return false;
+	}
+	Tree *genNode = nodeTermOf(terms[1]);
+	if (genNode == NULL || *(genNode->child) != TOKEN_NonArrayedIdentifier) {
+		return false;
+	}
+	SymbolTree *genSt = bindId(*(genNode->child), genNode->child->env).first;
+	if (genSt == NULL || genSt->kind != KIND_STD || genSt->parent != stdLib || genSt->id != "gen") {
+		return false;
+	}
+	if (*(terms[2]->child) != TOKEN_DynamicTerm || *(terms[2]->child->child) != TOKEN_Unpack) {
+		return false;
+	}
+	// the filter must take exactly one parameter and return nothing
+	SymbolTree *param;
+	bool named;
+	Tree *block = singleParamBlock(terms[3], param, named);
+	if (block == NULL) {
+		return false;
+	}
+	gr.pipe = pipe;
+	gr.count = terms[0];
+	gr.param = param;
+	gr.block = block;
+	gr.named = named;
+	return true;
+}
+
+// replaces the (typed) pipe's code with the range; leaves it as it is if the parameter isn't an int, any of the range's pieces failed to generate code,
+// or the range's named filter is over budget
+bool genGenRange(const GenRange &gr) {
+	Type *paramType = gr.param->defSite->status.type;
+	if (gr.pipe->status.code == NULL_IR_ID || gr.count->code() == NULL_IR_ID || paramType == NULL || paramType->category != CATEGORY_STDTYPE ||
+			paramType->suffix != SUFFIX_CONSTANT || !(*((StdType *)paramType) == STD_INT) || gr.param->offsetKind() != OFFSET_RAW) {
+		return false;
+	}
+	IRId body = genBlockBody(gr.block, gr.named);
+	if (body == NULL_IR_ID) {
+		return false;
+	}
+	vector<IRId> seqList(1, irModule->addRange(gr.count->castCode(*stdIntType), slotAddress(gr.param), body, gr.parallel));
+	// overwrite the pipe's code in place, so that the program picks up the range
+	irModule->setOperands(gr.pipe->status.code, seqList);
+	return true;
+}
+
+// batch conversion functions
+
+// a pipe that destreams a stream into a block with a single parameter, as in
+//	\\s [int x] { ... };
+// runs the block once per element, and every run only sees its own element, so rather than scheduling the block for each element as it arrives,
+// the pipe becomes a BATCH node that the runtime hands the buffered elements to in bulk; the block's ACCESS_ flags then decide how a batch is run:
+// a pure or latch-reading block runs on the elements of a batch concurrently, with its output put back into element order if it writes any,
+// while a latch-writing block runs on one element at a time, in order
+
+// checks whether the given top-level pipe destreams a stream into a block, logging the pieces of the batch in db if it does
+bool findDestreamBatch(Tree *pipe, DestreamBatch &db) {
+	// the pipe must be a destream of a stream of single words, and a filter
+	vector<Tree *> terms;
+	if (!pipeTermList(pipe, terms) || terms.size() != 2) {
+		return false;
+	}
+	Tree *elementTerm = staticTermOf(terms[0]);
+	if (elementTerm == NULL || *(elementTerm->child) != TOKEN_MultiAccess || *(elementTerm->child->child->child) != TOKEN_DSLASH) {
+		return false;
+	}
+	SymbolTree *st = nodeBinding(elementTerm->child->child->next); // Node
+	if (st == NULL || st->kind != KIND_DECLARATION) {
+		return false;
+	}
+	Type *stType = st->defSite->status.type;
+	if (stType == NULL || stType->category != CATEGORY_STDTYPE || stType->suffix != SUFFIX_STREAM || stType->depth != 1 || *((StdType *)stType) == STD_STRING) {
+		return false;
+	}
+	// the filter must take exactly one parameter and return nothing
+	SymbolTree *param;
+	bool named;
+	Tree *block = singleParamBlock(terms[1], param, named);
+	if (block == NULL) {
+		return false;
+	}
+	db.pipe = pipe;
+	db.st = st;
+	db.param = param;
+	db.block = block;
+	db.named = named;
+	return true;
+}
+
+// replaces the (typed) pipe's code with the batch; leaves it as it is if the parameter isn't a raw-stored standard constant, the pipe failed to generate code,
+// or the batch's named filter is over budget
+bool genDestreamBatch(const DestreamBatch &db) {
+	Type *paramType = db.param->defSite->status.type;
+	if (db.pipe->status.code == NULL_IR_ID || paramType == NULL || paramType->category != CATEGORY_STDTYPE || paramType->suffix != SUFFIX_CONSTANT ||
+			db.param->offsetKind() != OFFSET_RAW) {
+		return false;
+	}
+	IRId body = genBlockBody(db.block, db.named);
+	if (body == NULL_IR_ID) {
+		return false;
+	}
+	vector<IRId> seqList(1, irModule->addBatch(slotAddress(db.st), slotAddress(db.param), body, db.access));
+	// overwrite the pipe's code in place, so that the program picks up the batch
+	irModule->setOperands(db.pipe->status.code, seqList);
+	return true;
+}
+
+// finds the top-level pipes that can be lowered into loops, ranges, and batches, and moves the storage of the self-feeding streams into raw slots;
+// runs before layout, so that the streams are laid out as raws
+void findLowerings(Tree *treeRoot, vector<LoopStream> &loops, vector<GenRange> &ranges, vector<DestreamBatch> &batches) {
+	for (Tree *programCur = treeRoot; programCur != NULL; programCur = programCur->next) {
+		for (Tree *pipeCur = programCur->child->child; pipeCur != NULL; pipeCur = (pipeCur->next != NULL) ? pipeCur->next->child : NULL) {
+			LoopStream ls;
+			GenRange gr;
+			DestreamBatch db;
+			if (findLoopStream(pipeCur, programCur->child->child, treeRoot, ls)) {
+				ls.st->setRawOffset();
+				loops.push_back(ls);
+			} else if (findGenRange(pipeCur, gr)) {
+				ranges.push_back(gr);
+			} else if (findDestreamBatch(pipeCur, db)) {
+				batches.push_back(db);
+			}
+		}
+	}
+}
+
+// types all of the top-level pipes, lowering the ones that findLowerings() found; logs the number of each kind of lowering,
+// and the number of ranges and batches that inlined a named filter
+void semPipes(Tree *treeRoot, vector<LoopStream> &loops, vector<GenRange> &ranges, vector<DestreamBatch> &batches, unsigned int &numLoops, unsigned int &numRanges,
+		unsigned int &numParallelRanges, unsigned int &numPureBatches, unsigned int &numReadingBatches, unsigned int &numWritingBatches, unsigned int &numInlinedBodies) {
+	// type all of the pipes
 	TypeStatus rootStatus(nullType, stdIntType);
 	for (Tree *programCur = treeRoot; programCur != NULL; programCur = programCur->next) {
 		for (Tree *pipeCur = programCur->child->child; pipeCur != NULL; pipeCur = (pipeCur->next != NULL) ? pipeCur->next->child : NULL) {
 			getStatusPipe(pipeCur, rootStatus);
 		}
 	}
+	// now that everything that the ranges' and batches' blocks name is typed, derive their access
+	for (vector<GenRange>::iterator iter = ranges.begin(); iter != ranges.end(); iter++) {
+		(*iter).parallel = !(getCodeAccess((*iter).block->child, (*iter).param->parent) & ACCESS_WRITES_LATCHES);
+	}
+	for (vector<DestreamBatch>::iterator iter = batches.begin(); iter != batches.end(); iter++) {
+		(*iter).access = getCodeAccess((*iter).block->child, (*iter).param->parent);
+	}
+	// finally, generate the loops, ranges, and batches
+	numLoops = 0;
+	for (vector<LoopStream>::const_iterator iter = loops.begin(); iter != loops.end(); iter++) {
+		if (genLoopStream(*iter)) {
+			numLoops++;
+		}
+	}
+	numRanges = 0;
+	numParallelRanges = 0;
+	numInlinedBodies = 0;
+	for (vector<GenRange>::const_iterator iter = ranges.begin(); iter != ranges.end(); iter++) {
+		if (genGenRange(*iter)) {
+			numRanges++;
+			if ((*iter).parallel) {
+				numParallelRanges++;
+			}
+			if ((*iter).named) {
+				numInlinedBodies++;
+			}
+		}
+	}
+	numPureBatches = 0;
+	numReadingBatches = 0;
+	numWritingBatches = 0;
+	for (vector<DestreamBatch>::const_iterator iter = batches.begin(); iter != batches.end(); iter++) {
+		if (genDestreamBatch(*iter)) {
+			if ((*iter).named) {
+				numInlinedBodies++;
+			}
+			if ((*iter).access & ACCESS_WRITES_LATCHES) {
+				numWritingBatches++;
+			} else if ((*iter).access & ACCESS_READS_LATCHES) {
+				numReadingBatches++;
+			} else {
+				numPureBatches++;
+			}
+		}
+	}
 }
 
-// creates the top-level SchedTree containing all of the LabelTrees that should be initially scheduled
-SchedTree *genCodeRoot(Tree *treeRoot) {
+// creates the top-level SCHED node containing all of the LABEL nodes that should be initially scheduled
+IRId genCodeRoot(Tree *treeRoot) {
 	// build the list of labels that should be initially scheduled
-	vector<LabelTree *> labelList;
+	vector<IRId> labelList;
 	for (Tree *programCur = treeRoot; programCur != NULL; programCur = programCur->next) {
 		for (Tree *pipeCur = programCur->child->child; pipeCur != NULL; pipeCur = (pipeCur->next != NULL) ? pipeCur->next->child : NULL) {
-			labelList.push_back(new LabelTree((SeqTree *)(pipeCur->status.code)));
+			labelList.push_back(irModule->addLabel(getUniqueId(), pipeCur->status.code));
 		}
 	}
-	// finally, return the resulting SchedTree
-	return (new SchedTree(labelList));
+	// finally, return the resulting SCHED node
+	return (irModule->addSched(labelList));
 }
 
-// main semming function; makes no assumptions about stRoot and codeRoot's values; they're just return parameters
-int sem(Tree *treeRoot, SymbolTree *&stRoot, SchedTree *&codeRoot) {
+// main semming function; makes no assumptions about stRoot's value, which is just a return parameter; the intermediate code is generated into codeModule
+int sem(Tree *treeRoot, SymbolTree *&stRoot, IRModule &codeModule) {
 
 	// initialize local error code
 	semmerErrorCode = 0;
@@ -2749,6 +3919,7 @@ int sem(Tree *treeRoot, SymbolTree *&stRoot, SchedTree *&codeRoot) {
 	VERBOSE( printNotice("building symbol tree..."); )
 
 	// initialize the standard types and nodes
+	irModule = &codeModule;
 	initSemmerGlobals();
 	
 	// build the symbol tree
@@ -2761,11 +3932,36 @@ int sem(Tree *treeRoot, SymbolTree *&stRoot, SchedTree *&codeRoot) {
 
 	// perform semantic analysis (derivation of Type trees and offsets) on the entire SymbolTree
 	semSt(stRoot);
-	// perform semantic analysis (derivation of Type and IR trees) on the remaining pipes
-	semPipes(treeRoot);
+	// find the pipes that will be lowered, since some of them change how their streams are stored
+	vector<LoopStream> loops;
+	vector<GenRange> ranges;
+	vector<DestreamBatch> batches;
+	findLowerings(treeRoot, loops, ranges, batches);
+	
+	// lay out the storage of every node, now that the storage kinds are known, and fill in the slot addresses that were generated before now
+	unsigned int numLayouts = 0, hotBytes = 0, coldBytes = 0;
+	layoutSt(stRoot, numLayouts, hotBytes, coldBytes);
+	patchSlots();
+	VERBOSE( printNotice("laid out " << numLayouts << " nodes into " << hotBytes << " bytes of inline storage and " << coldBytes << " bytes of handles"); )
+	
+	// perform semantic analysis (derivation of Type trees and intermediate code) on the remaining pipes
+	unsigned int numLoops, numRanges, numParallelRanges, numPureBatches, numReadingBatches, numWritingBatches, numInlinedBodies;
+	semPipes(treeRoot, loops, ranges, batches, numLoops, numRanges, numParallelRanges, numPureBatches, numReadingBatches, numWritingBatches, numInlinedBodies);
+	VERBOSE(
+		printNotice("lowered " << (numSwitchChains + numSwitchTables + numSwitchSearches + numSwitchHashes) << " switches, " << numSwitchChains << " into equality chains, " <<
+			numSwitchTables << " into jump tables, " << numSwitchSearches << " into decision trees, and " << numSwitchHashes << " into hashed dispatch");
+		printNotice("lowered " << numLoops << " self-feeding streams into loops");
+		printNotice("lowered " << numRanges << " std.gen streams into counted ranges, " << numParallelRanges << " of them parallel");
+		printNotice("lowered " << (numPureBatches + numReadingBatches + numWritingBatches) << " destream bodies into batches, " <<
+			numPureBatches << " pure, " << numReadingBatches << " latch-reading, " << numWritingBatches << " latch-writing");
+		printNotice("inlined " << numInlinedFlows << " filter applications, " << numSpecializedFlows << " of them specialized on constant arguments, and " <<
+			numInlinedBodies << " named filters into ranges and batches");
+	)
 	
-	// build the root-level IRTree node at which assembly dumping will start
-	codeRoot = genCodeRoot(treeRoot);
+	// build the root-level code node at which assembly dumping will start
+	codeModule.root = genCodeRoot(treeRoot);
+	// drop the code that folding, cloning, and lowering left unreachable; this renumbers the module's nodes, so the code ids in the parse tree are stale from here on
+	codeModule.compact();
 	
 	VERBOSE( cout << stRoot; )
 
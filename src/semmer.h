@@ -24,6 +24,9 @@
 #define KIND_INSTANTIATION 11
 #define KIND_FAKE 12
 
+// SymbolTree byte offset of a node that hasn't been laid out yet
+#define OFFSET_BYTE_NULL 0xFFFFFFFF
+
 class SymbolTree {
 	public:
 		// data members
@@ -39,6 +42,10 @@ class SymbolTree {
 		unsigned int numBlocks; // the number of block-represented children for this node
 		unsigned int numPartitions; // the number of partition-represented children for this node
 		unsigned int numShares; // the number of share-represented children for this node
+		unsigned int offsetByteInternal; // the byte offset of this node within its lexical parent's layout, or OFFSET_BYTE_NULL if it hasn't been placed yet
+		bool laidOut; // whether this node's children have been laid out
+		unsigned int coldOffset; // the byte offset in this node's layout at which the handles of the non-raw children start
+		unsigned int layoutSize; // the number of bytes in this node's layout
 		// allocators/deallocators
 		SymbolTree(int kind, const string &id, Tree *defSite = NULL, SymbolTree *copyImportSite = NULL);
 		SymbolTree(int kind, const char *id, Tree *defSite = NULL, SymbolTree *copyImportSite = NULL);
@@ -52,9 +59,13 @@ class SymbolTree {
 		unsigned int addPartition();
 		unsigned int addShare();
 		void getOffset();
+		void setRawOffset();
 		int offsetKind();
 		Tree *offsetExp() const;
 		unsigned int offsetIndex();
+		bool hasSlot() const;
+		void getLayout();
+		unsigned int offsetByte() const;
 		string toString(unsigned int tabDepth);
 		// operators
 		SymbolTree &operator=(const SymbolTree &st);
@@ -62,6 +73,60 @@ class SymbolTree {
 		operator string();
 };
 
+// LoopStream classes
+
+// usage: a stream that is fed only by the conditional block that consumes it, and is thus lowered into an in-place loop rather than a scheduled recursion
+class LoopStream {
+	public:
+		// data members
+		SymbolTree *st; // the stream node; its storage becomes a raw slot holding the loop variable
+		Tree *pipe; // the consuming Pipe, whose code becomes the loop
+		Tree *seed; // the Term whose value is sent to the stream to start the loop
+		Tree *element; // the Term that destreams the loop variable
+		Tree *op; // the comparison operator token of the loop condition
+		Tree *bound; // the Term that the loop variable is compared against
+		Tree *block; // the Block to run on every iteration
+		Tree *producer; // the Pipe of the Block that feeds the stream; its value becomes the next value of the loop variable
+		// allocators/deallocators
+		LoopStream();
+		~LoopStream();
+};
+
+// GenRange classes
+
+// usage: a pipe that unpacks a std.gen stream into a block, and is thus lowered into a counted range rather than streaming every index through std.gen
+class GenRange {
+	public:
+		// data members
+		Tree *pipe; // the Pipe, whose code becomes the range
+		Tree *count; // the Term whose value is sent to std.gen
+		SymbolTree *param; // the block's index parameter; its raw slot receives the current index
+		Tree *block; // the Block to run for every index
+		bool named; // whether the block belongs to a filter that the pipe names, rather than a filter literal; its code is then copied into the range
+		bool parallel; // whether the block's iterations are independent of each other, so that the range may be split across threads
+		// allocators/deallocators
+		GenRange();
+		~GenRange();
+};
+
+// DestreamBatch classes
+
+// usage: a pipe that destreams a stream into a block, and is thus lowered into a batch that the runtime hands the stream's elements to in bulk,
+// rather than scheduling the block once per element
+class DestreamBatch {
+	public:
+		// data members
+		Tree *pipe; // the Pipe, whose code becomes the batch
+		SymbolTree *st; // the stream node that the pipe destreams
+		SymbolTree *param; // the block's element parameter; its raw slot receives the current element
+		Tree *block; // the Block to run for every element
+		bool named; // whether the block belongs to a filter that the pipe names, rather than a filter literal; its code is then copied into the batch
+		int access; // how the block touches state outside of itself (ACCESS_ flags in constantDefs.h)
+		// allocators/deallocators
+		DestreamBatch();
+		~DestreamBatch();
+};
+
 // forward declarations of mutually recursive typing functions
 
 TypeStatus getStatusSymbolTree(SymbolTree *root, SymbolTree *parent, const TypeStatus &inStatus = TypeStatus(nullType, errType));
@@ -74,7 +139,7 @@ TypeStatus getStatusPrimOpNode(Tree *tree, const TypeStatus &inStatus = TypeStat
 TypeStatus getStatusPrimLiteral(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusBlock(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusFilterHeader(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
-TypeStatus verifyStatusFilter(Tree *tree);
+TypeStatus verifyStatusFilter(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusFilter(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusInstructor(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus verifyStatusInstructor(Tree *tree);
@@ -94,9 +159,9 @@ TypeStatus getStatusStaticTerm(Tree *tree, const TypeStatus &inStatus = TypeStat
 TypeStatus getStatusDynamicTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusSwitchTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusSimpleTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
-TypeStatus getStatusSimpleCondTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
-TypeStatus getStatusOpenOrClosedCondTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
-TypeStatus getStatusTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
+TypeStatus getStatusSimpleCondTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType), const TypeStatus &recallStatus = TypeStatus(nullType, NULL));
+TypeStatus getStatusOpenOrClosedCondTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType), const TypeStatus &recallStatus = TypeStatus(nullType, NULL));
+TypeStatus getStatusTerm(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType), const TypeStatus &recallStatus = TypeStatus(nullType, NULL));
 TypeStatus getStatusNonEmptyTerms(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
 TypeStatus getStatusDeclaration(Tree *tree);
 TypeStatus getStatusPipe(Tree *tree, const TypeStatus &inStatus = TypeStatus(nullType, errType));
@@ -139,11 +204,11 @@ TypeStatus getStatusPipe(Tree *tree, const TypeStatus &inStatus = TypeStatus(nul
 	return (tree->status);\
 	/* label the exit point of type derivation (i.e. the entry point for code generation) */\
 	endTypeDerivation:\
-	/* if we derived a valid return status, proceed to build the intermediate code tree */\
+	/* if we derived a valid return status, proceed to generate the intermediate code */\
 	if (tree->status.type->category != CATEGORY_ERRORTYPE) {
 
 #define returnCode(x) \
-	/* memoize the intermediate code tree and return from this function */\
+	/* memoize the intermediate code node and return from this function */\
 	tree->status.code = (x);\
 	return (tree->status)
 
@@ -163,6 +228,6 @@ TypeStatus getStatusPipe(Tree *tree, const TypeStatus &inStatus = TypeStatus(nul
 	
 // main semantic analysis function
 
-int sem(Tree *treeRoot, SymbolTree *&stRoot, SchedTree *&codeRoot);
+int sem(Tree *treeRoot, SymbolTree *&stRoot, IRModule &codeModule);
 
 #endif
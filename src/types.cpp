@@ -2,6 +2,8 @@
 
 #include "outputOperators.h"
 
+#include "opter.h"
+
 // Type functions
 Type::Type(int category, int suffix, int depth, Tree *offsetExp) : category(category), suffix(suffix), depth(depth), offsetExp(offsetExp),
 	referensible(true), instantiable(true), toStringHandled(false) {}
@@ -54,6 +56,50 @@ int Type::offsetKind() const {
 		}
 	}
 }
+// returns the number of bytes (and the alignment) that a node of this type takes up in its parent's layout;
+// reads and writes carry no access width and always move a whole word, so raw bools and chars get a word-sized slot like everything else
+unsigned int Type::offsetSize() const {
+	return LAYOUT_WORD_SIZE;
+}
+// returns the number of bytes that an element of this type takes up in an array's storage; unlike in a layout, bools and chars are packed one per byte,
+// and nested arrays and pools whose extents are all constant are stored inline, as the product of their extents times the size of their scalars;
+// strings, filters, objects, lists, streams, and arrays with run-time extents are stored as pointers
+unsigned int Type::storageSize() const {
+	unsigned int scalarSize = LAYOUT_WORD_SIZE;
+	if (category == CATEGORY_STDTYPE && (((StdType *)(this))->kind == STD_BOOL || ((StdType *)(this))->kind == STD_CHAR)) {
+		scalarSize = STORAGE_BYTE_SIZE;
+	}
+	if (suffix == SUFFIX_CONSTANT || suffix == SUFFIX_LATCH) {
+		return scalarSize;
+	} else if ((suffix != SUFFIX_ARRAY && suffix != SUFFIX_POOL) || offsetExp == NULL) {
+		return LAYOUT_WORD_SIZE;
+	}
+	// collect the extents of the offset expression, outermost first
+	vector<uint64_t> extents;
+	if (*offsetExp == TOKEN_RAW_VECTOR) { // an initializer list's depths
+		deque<unsigned int> *depthList = (deque<unsigned int> *)(offsetExp->next);
+		extents.insert(extents.end(), depthList->begin(), depthList->end());
+	} else { // LSQUARE
+		for(Tree *exp = offsetExp->next; exp != NULL; exp = (exp->next->next != NULL) ? exp->next->next->child->next : NULL) { // Exp
+			if (exp->status.code == NULL_IR_ID || irModule->categories[exp->status.code] != CATEGORY_WORD64) { // if the extent isn't known until run-time, we can't store the elements inline
+				return LAYOUT_WORD_SIZE;
+			}
+			extents.push_back(irModule->word(exp->status.code));
+		}
+	}
+	// the expression may have come from a deeper type, in which case this type's extents are the innermost ones
+	if (extents.size() < (unsigned int)depth) {
+		return LAYOUT_WORD_SIZE;
+	}
+	uint64_t acc = scalarSize;
+	for (unsigned int i = extents.size() - depth; i < extents.size(); i++) {
+		acc *= extents[i];
+		if (acc > 0xFFFFFFFF) { // too big to be a stride; keep it out of line
+			return LAYOUT_WORD_SIZE;
+		}
+	}
+	return (unsigned int)acc;
+}
 string Type::suffixString() const {
 	string acc;
 	if (suffix == SUFFIX_LATCH) {
@@ -1059,7 +1105,7 @@ StructorList::iterator StructorList::begin() {return iterator(structors.begin())
 StructorList::iterator StructorList::end() {return iterator(structors.end());}
 
 // MemberListResult functions
-MemberListResult::MemberListResult(const pair<string, pair<Type *, Tree *> > &internalPair) : internalPair(internalPair) {}
+MemberListResult::MemberListResult(const pair<const string, pair<Type *, Tree *> > &internalPair) : internalPair(internalPair) {}
 MemberListResult::~MemberListResult() {}
 MemberListResult::operator string() const {return internalPair.first;}
 MemberListResult::operator Type *() const {return internalPair.second.first;}
@@ -1507,42 +1553,42 @@ string ErrorType::toString(unsigned int tabDepth) {
 ErrorType::operator string() {return toString(1);}
 
 // TypeStatus functions
-TypeStatus::TypeStatus(Type *type, Type *retType) : type(type), retType(retType), code(NULL) {}
-TypeStatus::TypeStatus(Type *type, const TypeStatus &otherStatus) : type(type), retType(otherStatus.retType), code(NULL) {}
+TypeStatus::TypeStatus(Type *type, Type *retType) : type(type), retType(retType), code(NULL_IR_ID) {}
+TypeStatus::TypeStatus(Type *type, const TypeStatus &otherStatus) : type(type), retType(otherStatus.retType), code(NULL_IR_ID) {}
 TypeStatus::~TypeStatus() {}
 TypeStatus::operator Type *() const {return type;}
 TypeStatus::operator uintptr_t() const {return (uintptr_t)type;}
-DataTree *TypeStatus::castCode(const Type &destType) const {
+IRId TypeStatus::castCode(const Type &destType) const {
 	StdType *thisType = (StdType *)type;
 	StdType *otherType = (StdType *)(&destType);
 	if (thisType->kind == otherType->kind) {
-		return (DataTree *)code;
+		return code;
 	} else if (thisType->kind == STD_INT && otherType->kind == STD_FLOAT) {
-		return (new TempTree(new ConvOpTree(CONVOP_INT2FLOAT, (DataTree *)code)));
+		return (foldData(irModule->addTemp(irModule->addConvOp(CONVOP_INT2FLOAT, code))));
 	} else if (thisType->kind == STD_FLOAT && otherType->kind == STD_INT) {
-		return (new TempTree(new ConvOpTree(CONVOP_FLOAT2INT, (DataTree *)code)));
+		return (foldData(irModule->addTemp(irModule->addConvOp(CONVOP_FLOAT2INT, code))));
 	} else if (otherType->kind == STD_STRING) {
 		switch(thisType->kind) {
 			case STD_BOOL:
-				return (new TempTree(new ConvOpTree(CONVOP_BOOL2STRING, (DataTree *)code)));
+				return (foldData(irModule->addTemp(irModule->addConvOp(CONVOP_BOOL2STRING, code))));
 			case STD_INT:
-				return (new TempTree(new ConvOpTree(CONVOP_INT2STRING, (DataTree *)code)));
+				return (foldData(irModule->addTemp(irModule->addConvOp(CONVOP_INT2STRING, code))));
 			case STD_FLOAT:
-				return (new TempTree(new ConvOpTree(CONVOP_FLOAT2STRING, (DataTree *)code)));
+				return (foldData(irModule->addTemp(irModule->addConvOp(CONVOP_FLOAT2STRING, code))));
 			case STD_CHAR:
-				return (new TempTree(new ConvOpTree(CONVOP_CHAR2STRING, (DataTree *)code)));
+				return (foldData(irModule->addTemp(irModule->addConvOp(CONVOP_CHAR2STRING, code))));
 			default: // can't happen; the above should cover all cases
-				return NULL;
+				return NULL_IR_ID;
 				break;
 		}
 	}
-	return (DataTree *)code;
+	return code;
 }
-DataTree *TypeStatus::castCommonCode(const Type &otherType) const {
+IRId TypeStatus::castCommonCode(const Type &otherType) const {
 	if (*type >> otherType) {
 		return castCode(otherType);
 	} else /* if (otherType >> *type) */ {
-		return (DataTree *)code;
+		return code;
 	}
 }
 TypeStatus &TypeStatus::operator=(const TypeStatus &otherStatus) {type = otherStatus.type; retType = otherStatus.retType; return *this;}
@@ -30,6 +30,12 @@
 #define OFFSET_SHARE 4
 #define OFFSET_FREE 5
 
+// Type layout sizes
+#define LAYOUT_WORD_SIZE 8 // raw values, and pointers (to constant strings, arrays, filters, and objects, and to the storage of non-raw nodes)
+
+// Type storage sizes
+#define STORAGE_BYTE_SIZE 1 // bools and chars, which array storage packs one per byte
+
 // core Type class
 
 class Type {
@@ -70,6 +76,8 @@ class Type {
 		bool baseEquals(const Type &otherType) const;
 		bool baseSendable(const Type &otherType) const;
 		int offsetKind() const;
+		unsigned int offsetSize() const;
+		unsigned int storageSize() const;
 		string suffixString() const;
 		// operators
 		// virtual
@@ -257,9 +265,9 @@ class StructorList {
 class MemberListResult {
 	public:
 		// data members
-		const pair<string, pair<Type *, Tree *> > &internalPair;
+		const pair<const string, pair<Type *, Tree *> > &internalPair;
 		// allocators/deallocators
-		MemberListResult(const pair<string, pair<Type *, Tree *> > &internalPair);
+		MemberListResult(const pair<const string, pair<Type *, Tree *> > &internalPair);
 		~MemberListResult();
 		// converters
 		operator string() const;
@@ -359,7 +367,7 @@ class TypeStatus {
 		// data members
 		Type *type; // the type derived for this parse tree node
 		Type *retType; // the carry-over return type derived for this parse tree node
-		IRTree *code; // the intermediate representation code tree for this parse tree node
+		IRId code; // the intermediate code node generated for this parse tree node
 		// allocators/deallocators
 		TypeStatus(Type *type = NULL, Type *retType = NULL);
 		TypeStatus(Type *type, const TypeStatus &otherStatus);
@@ -368,8 +376,8 @@ class TypeStatus {
 		operator Type *() const;
 		operator uintptr_t() const;
 		// core methods
-		DataTree *castCode(const Type &destType) const;
-		DataTree *castCommonCode(const Type &otherType) const;
+		IRId castCode(const Type &destType) const;
+		IRId castCommonCode(const Type &otherType) const;
 		// operators
 		TypeStatus &operator=(const TypeStatus &otherStatus);
 		TypeStatus &operator=(Type *otherType);
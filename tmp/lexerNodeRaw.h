@@ -0,0 +1,66050 @@
+const LexerNode lexerNode[256][256] = {
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 25, 11 },
+		{ 16, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 22, -1 },
+		{ 27, 106 },
+		{ 15, -1 },
+		{ 2, -1 },
+		{ 3, -1 },
+		{ 20, -1 },
+		{ 18, 103 },
+		{ 10, -1 },
+		{ 19, 104 },
+		{ 9, 114 },
+		{ 21, 105 },
+		{ 1, 3 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 14, 113 },
+		{ 12, -1 },
+		{ 23, 108 },
+		{ 8, 10 },
+		{ 24, 110 },
+		{ 13, 112 },
+		{ 17, -1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 4, -1 },
+		{ 11, 102 },
+		{ 5, -1 },
+		{ 29, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 6, -1 },
+		{ 28, 107 },
+		{ 7, -1 },
+		{ 26, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ -1, 0 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ 0, 1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 4 },
+		{ -1, 0 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ 1, 2 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 6 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 4 },
+		{ -1, 0 },
+		{ 31, -1 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ 32, 5 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 6 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 30, 7 },
+		{ -1, 0 },
+		{ 30, 7 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ 32, 7 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ 1, 8 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ 1, 9 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 33, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 34, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 35, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 36, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 37, 111 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 38, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 40, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 39, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 41, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 43, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 42, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 47, 109 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 44, -1 },
+		{ 45, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 46, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 48, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 50, -1 },
+		{ 49, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 51, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 52, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 53, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ 54, -1 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+	{
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+		{ -1, 0 },
+	},
+};
@@ -0,0 +1,292 @@
+#include "lexerStruct.h"
+
+/* NOTE: This file was automatically generated by src/lexerStructGen.cpp -- do not modify it */
+
+const char *tokenType2String(int tokenType) {
+	switch(tokenType) {
+		case TOKEN_AND:
+			return "AND";
+			break;
+		case TOKEN_AT:
+			return "AT";
+			break;
+		case TOKEN_COLON:
+			return "COLON";
+			break;
+		case TOKEN_COMMA:
+			return "COMMA";
+			break;
+		case TOKEN_COMPLEMENT:
+			return "COMPLEMENT";
+			break;
+		case TOKEN_CQUOTE:
+			return "CQUOTE";
+			break;
+		case TOKEN_DAND:
+			return "DAND";
+			break;
+		case TOKEN_DCOLON:
+			return "DCOLON";
+			break;
+		case TOKEN_DEQUALS:
+			return "DEQUALS";
+			break;
+		case TOKEN_DIVIDE:
+			return "DIVIDE";
+			break;
+		case TOKEN_DMINUS:
+			return "DMINUS";
+			break;
+		case TOKEN_DOR:
+			return "DOR";
+			break;
+		case TOKEN_DPERIOD:
+			return "DPERIOD";
+			break;
+		case TOKEN_DPLUS:
+			return "DPLUS";
+			break;
+		case TOKEN_DQUESTION:
+			return "DQUESTION";
+			break;
+		case TOKEN_DRARROW:
+			return "DRARROW";
+			break;
+		case TOKEN_DSLASH:
+			return "DSLASH";
+			break;
+		case TOKEN_EQUALS:
+			return "EQUALS";
+			break;
+		case TOKEN_ERROR:
+			return "ERROR";
+			break;
+		case TOKEN_FAIL:
+			return "FAIL";
+			break;
+		case TOKEN_FNUM:
+			return "FNUM";
+			break;
+		case TOKEN_GE:
+			return "GE";
+			break;
+		case TOKEN_GT:
+			return "GT";
+			break;
+		case TOKEN_ID:
+			return "ID";
+			break;
+		case TOKEN_INUM:
+			return "INUM";
+			break;
+		case TOKEN_LARROW:
+			return "LARROW";
+			break;
+		case TOKEN_LBRACKET:
+			return "LBRACKET";
+			break;
+		case TOKEN_LCURLY:
+			return "LCURLY";
+			break;
+		case TOKEN_LE:
+			return "LE";
+			break;
+		case TOKEN_LFLAG:
+			return "LFLAG";
+			break;
+		case TOKEN_LRARROW:
+			return "LRARROW";
+			break;
+		case TOKEN_LS:
+			return "LS";
+			break;
+		case TOKEN_LSQUARE:
+			return "LSQUARE";
+			break;
+		case TOKEN_LT:
+			return "LT";
+			break;
+		case TOKEN_MINUS:
+			return "MINUS";
+			break;
+		case TOKEN_MOD:
+			return "MOD";
+			break;
+		case TOKEN_NEQUALS:
+			return "NEQUALS";
+			break;
+		case TOKEN_NOT:
+			return "NOT";
+			break;
+		case TOKEN_OR:
+			return "OR";
+			break;
+		case TOKEN_PERIOD:
+			return "PERIOD";
+			break;
+		case TOKEN_PLUS:
+			return "PLUS";
+			break;
+		case TOKEN_QUESTION:
+			return "QUESTION";
+			break;
+		case TOKEN_RARROW:
+			return "RARROW";
+			break;
+		case TOKEN_RBRACKET:
+			return "RBRACKET";
+			break;
+		case TOKEN_RCURLY:
+			return "RCURLY";
+			break;
+		case TOKEN_REGCOMMENT:
+			return "REGCOMMENT";
+			break;
+		case TOKEN_RFLAG:
+			return "RFLAG";
+			break;
+		case TOKEN_RS:
+			return "RS";
+			break;
+		case TOKEN_RSQUARE:
+			return "RSQUARE";
+			break;
+		case TOKEN_SEMICOLON:
+			return "SEMICOLON";
+			break;
+		case TOKEN_SLASH:
+			return "SLASH";
+			break;
+		case TOKEN_SQUOTE:
+			return "SQUOTE";
+			break;
+		case TOKEN_STARCOMMENT:
+			return "STARCOMMENT";
+			break;
+		case TOKEN_TIMES:
+			return "TIMES";
+			break;
+		case TOKEN_XOR:
+			return "XOR";
+			break;
+		case TOKEN_END:
+			return "END";
+			break;
+	}
+	return NULL; // can't happen if the above covers all cases, which it should
+}
+unsigned int string2TokenType(string s) {
+	if (s == "TOKEN_AND")
+		return TOKEN_AND;
+	if (s == "TOKEN_AT")
+		return TOKEN_AT;
+	if (s == "TOKEN_COLON")
+		return TOKEN_COLON;
+	if (s == "TOKEN_COMMA")
+		return TOKEN_COMMA;
+	if (s == "TOKEN_COMPLEMENT")
+		return TOKEN_COMPLEMENT;
+	if (s == "TOKEN_CQUOTE")
+		return TOKEN_CQUOTE;
+	if (s == "TOKEN_DAND")
+		return TOKEN_DAND;
+	if (s == "TOKEN_DCOLON")
+		return TOKEN_DCOLON;
+	if (s == "TOKEN_DEQUALS")
+		return TOKEN_DEQUALS;
+	if (s == "TOKEN_DIVIDE")
+		return TOKEN_DIVIDE;
+	if (s == "TOKEN_DMINUS")
+		return TOKEN_DMINUS;
+	if (s == "TOKEN_DOR")
+		return TOKEN_DOR;
+	if (s == "TOKEN_DPERIOD")
+		return TOKEN_DPERIOD;
+	if (s == "TOKEN_DPLUS")
+		return TOKEN_DPLUS;
+	if (s == "TOKEN_DQUESTION")
+		return TOKEN_DQUESTION;
+	if (s == "TOKEN_DRARROW")
+		return TOKEN_DRARROW;
+	if (s == "TOKEN_DSLASH")
+		return TOKEN_DSLASH;
+	if (s == "TOKEN_EQUALS")
+		return TOKEN_EQUALS;
+	if (s == "TOKEN_ERROR")
+		return TOKEN_ERROR;
+	if (s == "TOKEN_FAIL")
+		return TOKEN_FAIL;
+	if (s == "TOKEN_FNUM")
+		return TOKEN_FNUM;
+	if (s == "TOKEN_GE")
+		return TOKEN_GE;
+	if (s == "TOKEN_GT")
+		return TOKEN_GT;
+	if (s == "TOKEN_ID")
+		return TOKEN_ID;
+	if (s == "TOKEN_INUM")
+		return TOKEN_INUM;
+	if (s == "TOKEN_LARROW")
+		return TOKEN_LARROW;
+	if (s == "TOKEN_LBRACKET")
+		return TOKEN_LBRACKET;
+	if (s == "TOKEN_LCURLY")
+		return TOKEN_LCURLY;
+	if (s == "TOKEN_LE")
+		return TOKEN_LE;
+	if (s == "TOKEN_LFLAG")
+		return TOKEN_LFLAG;
+	if (s == "TOKEN_LRARROW")
+		return TOKEN_LRARROW;
+	if (s == "TOKEN_LS")
+		return TOKEN_LS;
+	if (s == "TOKEN_LSQUARE")
+		return TOKEN_LSQUARE;
+	if (s == "TOKEN_LT")
+		return TOKEN_LT;
+	if (s == "TOKEN_MINUS")
+		return TOKEN_MINUS;
+	if (s == "TOKEN_MOD")
+		return TOKEN_MOD;
+	if (s == "TOKEN_NEQUALS")
+		return TOKEN_NEQUALS;
+	if (s == "TOKEN_NOT")
+		return TOKEN_NOT;
+	if (s == "TOKEN_OR")
+		return TOKEN_OR;
+	if (s == "TOKEN_PERIOD")
+		return TOKEN_PERIOD;
+	if (s == "TOKEN_PLUS")
+		return TOKEN_PLUS;
+	if (s == "TOKEN_QUESTION")
+		return TOKEN_QUESTION;
+	if (s == "TOKEN_RARROW")
+		return TOKEN_RARROW;
+	if (s == "TOKEN_RBRACKET")
+		return TOKEN_RBRACKET;
+	if (s == "TOKEN_RCURLY")
+		return TOKEN_RCURLY;
+	if (s == "TOKEN_REGCOMMENT")
+		return TOKEN_REGCOMMENT;
+	if (s == "TOKEN_RFLAG")
+		return TOKEN_RFLAG;
+	if (s == "TOKEN_RS")
+		return TOKEN_RS;
+	if (s == "TOKEN_RSQUARE")
+		return TOKEN_RSQUARE;
+	if (s == "TOKEN_SEMICOLON")
+		return TOKEN_SEMICOLON;
+	if (s == "TOKEN_SLASH")
+		return TOKEN_SLASH;
+	if (s == "TOKEN_SQUOTE")
+		return TOKEN_SQUOTE;
+	if (s == "TOKEN_STARCOMMENT")
+		return TOKEN_STARCOMMENT;
+	if (s == "TOKEN_TIMES")
+		return TOKEN_TIMES;
+	if (s == "TOKEN_XOR")
+		return TOKEN_XOR;
+	if (s == "TOKEN_END")
+		return TOKEN_END;
+	return NUM_TOKENS; // can't happen if the above covers all cases, which it should
+}
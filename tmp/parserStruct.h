@@ -0,0 +1,115 @@
+/* NOTE: This file was automatically generated by src/parserStructGen.cpp -- do not modify it */
+
+#ifndef _PARSER_STRUCT_H_
+#define _PARSER_STRUCT_H_
+
+#include "../tmp/lexerStruct.h"
+#include "../src/parserNodeStruct.h"
+
+#define NUM_RULES 512
+
+#define TOKEN_Program NUM_TOKENS + 0
+#define TOKEN_Pipes NUM_TOKENS + 1
+#define TOKEN_NonEmptyPipes NUM_TOKENS + 2
+#define TOKEN_Pipe NUM_TOKENS + 3
+#define TOKEN_LastPipe NUM_TOKENS + 4
+#define TOKEN_Declaration NUM_TOKENS + 5
+#define TOKEN_ImportIdentifier NUM_TOKENS + 6
+#define TOKEN_NonEmptyTerms NUM_TOKENS + 7
+#define TOKEN_Terms NUM_TOKENS + 8
+#define TOKEN_Term NUM_TOKENS + 9
+#define TOKEN_ClosedTerm NUM_TOKENS + 10
+#define TOKEN_OpenTerm NUM_TOKENS + 11
+#define TOKEN_SimpleCondTerm NUM_TOKENS + 12
+#define TOKEN_ClosedCondTerm NUM_TOKENS + 13
+#define TOKEN_OpenCondTerm NUM_TOKENS + 14
+#define TOKEN_SimpleTerm NUM_TOKENS + 15
+#define TOKEN_StaticTerm NUM_TOKENS + 16
+#define TOKEN_SingleStaticTerm NUM_TOKENS + 17
+#define TOKEN_SwitchTerm NUM_TOKENS + 18
+#define TOKEN_LabeledTerms NUM_TOKENS + 19
+#define TOKEN_LabeledTerm NUM_TOKENS + 20
+#define TOKEN_LastLabeledTerm NUM_TOKENS + 21
+#define TOKEN_DynamicTerm NUM_TOKENS + 22
+#define TOKEN_TypedStaticTerm NUM_TOKENS + 23
+#define TOKEN_BracketedExp NUM_TOKENS + 24
+#define TOKEN_CurlyBracketedExpList NUM_TOKENS + 25
+#define TOKEN_CurlyBracketedExp NUM_TOKENS + 26
+#define TOKEN_ExpList NUM_TOKENS + 27
+#define TOKEN_Exp NUM_TOKENS + 28
+#define TOKEN_Primary NUM_TOKENS + 29
+#define TOKEN_PrimaryBase NUM_TOKENS + 30
+#define TOKEN_Node NUM_TOKENS + 31
+#define TOKEN_NonArrayedIdentifier NUM_TOKENS + 32
+#define TOKEN_ArrayedIdentifier NUM_TOKENS + 33
+#define TOKEN_OpenIdentifier NUM_TOKENS + 34
+#define TOKEN_NonArrayedIdentifierSuffix NUM_TOKENS + 35
+#define TOKEN_ArrayedIdentifierSuffix NUM_TOKENS + 36
+#define TOKEN_OpenIdentifierSuffix NUM_TOKENS + 37
+#define TOKEN_IdentifierSuffix NUM_TOKENS + 38
+#define TOKEN_BlankInstantiation NUM_TOKENS + 39
+#define TOKEN_Instantiation NUM_TOKENS + 40
+#define TOKEN_BlankInstantiationSource NUM_TOKENS + 41
+#define TOKEN_SingleInitInstantiationSource NUM_TOKENS + 42
+#define TOKEN_MultiInitInstantiationSource NUM_TOKENS + 43
+#define TOKEN_SingleFlowInitInstantiationSource NUM_TOKENS + 44
+#define TOKEN_MultiFlowInitInstantiationSource NUM_TOKENS + 45
+#define TOKEN_CopyInstantiationSource NUM_TOKENS + 46
+#define TOKEN_CloneInstantiationSource NUM_TOKENS + 47
+#define TOKEN_ArrayAccess NUM_TOKENS + 48
+#define TOKEN_PrimOpNode NUM_TOKENS + 49
+#define TOKEN_PrefixOp NUM_TOKENS + 50
+#define TOKEN_InfixOp NUM_TOKENS + 51
+#define TOKEN_MultiOp NUM_TOKENS + 52
+#define TOKEN_PostfixOp NUM_TOKENS + 53
+#define TOKEN_PrefixOrMultiOp NUM_TOKENS + 54
+#define TOKEN_InfixOrMultiOp NUM_TOKENS + 55
+#define TOKEN_PrimLiteral NUM_TOKENS + 56
+#define TOKEN_Filter NUM_TOKENS + 57
+#define TOKEN_ExplicitFilter NUM_TOKENS + 58
+#define TOKEN_FilterHeader NUM_TOKENS + 59
+#define TOKEN_NonRetFilterHeader NUM_TOKENS + 60
+#define TOKEN_RetFilterHeader NUM_TOKENS + 61
+#define TOKEN_ParamList NUM_TOKENS + 62
+#define TOKEN_RetList NUM_TOKENS + 63
+#define TOKEN_ExplicitRetList NUM_TOKENS + 64
+#define TOKEN_Param NUM_TOKENS + 65
+#define TOKEN_Type NUM_TOKENS + 66
+#define TOKEN_TypeSuffix NUM_TOKENS + 67
+#define TOKEN_BlankInstantiationTypeSuffix NUM_TOKENS + 68
+#define TOKEN_MultiInitInstantiationTypeSuffix NUM_TOKENS + 69
+#define TOKEN_ListTypeSuffix NUM_TOKENS + 70
+#define TOKEN_StreamTypeSuffix NUM_TOKENS + 71
+#define TOKEN_ArrayTypeSuffix NUM_TOKENS + 72
+#define TOKEN_PoolTypeSuffix NUM_TOKENS + 73
+#define TOKEN_FilterType NUM_TOKENS + 74
+#define TOKEN_ObjectType NUM_TOKENS + 75
+#define TOKEN_ObjectTypeList NUM_TOKENS + 76
+#define TOKEN_InstructorType NUM_TOKENS + 77
+#define TOKEN_OutstructorType NUM_TOKENS + 78
+#define TOKEN_MemberType NUM_TOKENS + 79
+#define TOKEN_TypeList NUM_TOKENS + 80
+#define TOKEN_Block NUM_TOKENS + 81
+#define TOKEN_Object NUM_TOKENS + 82
+#define TOKEN_ObjectPipes NUM_TOKENS + 83
+#define TOKEN_Instructor NUM_TOKENS + 84
+#define TOKEN_LastInstructor NUM_TOKENS + 85
+#define TOKEN_Outstructor NUM_TOKENS + 86
+#define TOKEN_SingleAccess NUM_TOKENS + 87
+#define TOKEN_MultiAccess NUM_TOKENS + 88
+#define TOKEN_SingleAccessor NUM_TOKENS + 89
+#define TOKEN_MultiAccessor NUM_TOKENS + 90
+#define TOKEN_Compound NUM_TOKENS + 91
+#define TOKEN_Pack NUM_TOKENS + 92
+#define TOKEN_Unpack NUM_TOKENS + 93
+#define TOKEN_Link NUM_TOKENS + 94
+#define TOKEN_Loopback NUM_TOKENS + 95
+#define TOKEN_Send NUM_TOKENS + 96
+#define TOKEN_Swap NUM_TOKENS + 97
+#define TOKEN_Return NUM_TOKENS + 98
+
+#define NUM_NONTERMS 99
+
+#define NUM_LABELS NUM_TOKENS + NUM_NONTERMS
+
+#endif